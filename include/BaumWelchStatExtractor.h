@@ -0,0 +1,166 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_BaumWelchStatExtractor_h)
+#define ALIZE_BaumWelchStatExtractor_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "alizeString.h"
+
+namespace alize
+{
+  class BaumWelchStats;
+  class Config;
+  class FeatureFileList;
+  class FeatureInputStream;
+  class MixtureGD;
+  class ThreadPool;
+
+  /// Computes the Baum-Welch statistics (see BaumWelchStats) of
+  /// utterances against a world model.\n
+  /// The occupations are computed like for EM (see
+  /// MixtureGDStat::computeAndAccumulateEM()) : the config parameters
+  /// emTopDistribsCount and emOccThreshold keep only the top
+  /// distributions of each frame, computeLLKInLogDomain applies.\n
+  /// A list of feature files is processed with one job per file : each
+  /// thread of the pool reads its own files and writes one statistics file
+  /// per feature file.
+  ///
+  /// @version 1.0
+
+  class ALIZE_API BaumWelchStatExtractor : public Object
+  {
+
+  public :
+
+    /// Creates an extractor
+    /// @param c the config. The extractor stores a reference to it.
+    /// @param world the world model. The extractor stores a reference to
+    ///     it. It must not be modified while the extractor is used.
+    /// @param pool the threads. The extractor stores a reference to it.
+    ///
+    explicit BaumWelchStatExtractor(const Config& c, const MixtureGD& world,
+                                    ThreadPool& pool);
+    virtual ~BaumWelchStatExtractor();
+
+    /// Keeps or not the second order statistics. Default : false.
+    /// @param b true to keep them
+    ///
+    void setSecondOrder(bool b);
+    bool getSecondOrder() const;
+
+    /// Computes the statistics of some frames of a stream in the calling
+    /// thread
+    /// @param fs the stream
+    /// @param begin index of the first frame
+    /// @param count number of frames
+    /// @param s the statistics
+    /// @exception Exception if the stream ends before the last frame or if
+    ///     its dimension is not the dimension of the world model
+    ///
+    void computeStats(FeatureInputStream& fs, unsigned long begin,
+                      unsigned long count, BaumWelchStats& s) const;
+
+    /// Computes the statistics of all the frames of a stream in the
+    /// calling thread
+    /// @param fs the stream
+    /// @param s the statistics
+    /// @exception Exception like computeStats(FeatureInputStream&,
+    ///     unsigned long, unsigned long, BaumWelchStats&)
+    ///
+    void computeStats(FeatureInputStream& fs, BaumWelchStats& s) const;
+
+    /// Computes the statistics of each file of a list with the threads of
+    /// the pool and saves them in the files path + name + extension
+    /// @param l the feature files
+    /// @param path path of the statistics files
+    /// @param extension extension of the statistics files
+    /// @exception Exception if a file cannot be read or written. The
+    ///     files not yet started are not processed.
+    ///
+    void computeAndSaveStats(const FeatureFileList& l, const String& path,
+                             const String& extension) const;
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    const Config&    _config;
+    const MixtureGD& _world;
+    ThreadPool&      _pool;
+    bool             _secondOrder;
+    unsigned long    _worldChecksum;
+
+    BaumWelchStatExtractor(const BaumWelchStatExtractor&); /*!Not implemented*/
+    const BaumWelchStatExtractor& operator=(
+                const BaumWelchStatExtractor&); /*!Not implemented*/
+    bool operator==(const BaumWelchStatExtractor&) const; /*!Not implemented*/
+    bool operator!=(const BaumWelchStatExtractor&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_BaumWelchStatExtractor_h)
@@ -0,0 +1,202 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_BaumWelchStats_h)
+#define ALIZE_BaumWelchStats_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "RealVector.h"
+
+namespace alize
+{
+  class MixtureGDStat;
+
+  /// Zero, first and (optionally) second order Baum-Welch statistics of
+  /// an utterance against a world model, for supervector, factor analysis
+  /// or PLDA back-ends. For a distribution c :\n
+  ///   N(c) = sum of the occupations of c\n
+  ///   F(c) = sum of the frames weighted by the occupations of c\n
+  ///   S(c) = sum of the squared frames weighted by the occupations of c
+  ///   (diagonal)\n
+  /// The statistics are not centered on the means of the world model.\n
+  /// Binary file (little endian on x86, float32 values) :\n
+  ///   bytes 0-63 : header = "BWS1", then 32 bits unsigned integers :
+  ///   worldChecksum, distribCount, vectSize, secondOrder (0 or 1),
+  ///   frameCount, then zeros\n
+  ///   then N, F and S (if secondOrder), each one starting at a multiple
+  ///   of 64 bytes and padded with zeros. F and S are stored distribution
+  ///   by distribution (distribCount x vectSize values).\n
+  /// The file can be mapped in memory : see getFileSize() and
+  ///   getFirstOrderOffset().
+  ///
+  /// @version 1.0
+
+  class ALIZE_API BaumWelchStats : public Object
+  {
+
+  public :
+
+    /// Creates empty statistics
+    /// @param distribCount number of distributions of the world model
+    /// @param vectSize dimension of the frames
+    /// @param secondOrder true to keep the second order statistics
+    ///
+    explicit BaumWelchStats(unsigned long distribCount = 0,
+                            unsigned long vectSize = 0,
+                            bool secondOrder = false);
+    virtual ~BaumWelchStats();
+
+    /// Sets the dimensions and sets all the statistics to 0
+    /// @param distribCount number of distributions of the world model
+    /// @param vectSize dimension of the frames
+    /// @param secondOrder true to keep the second order statistics
+    ///
+    void reset(unsigned long distribCount, unsigned long vectSize,
+               bool secondOrder);
+
+    /// Copies the statistics accumulated by EM in a MixtureGDStat
+    /// (see MixtureGDStat::getAccumulatedMeanVect()). The pruning of
+    /// the occupations (emOccThreshold, emTopDistribsCount) applies.
+    /// @param s the accumulator
+    /// @param worldChecksum checksum of the world model (see
+    ///     Mixture::computeChecksum())
+    /// @exception Exception if the dimensions are not the same
+    ///
+    void setStats(const MixtureGDStat& s, unsigned long worldChecksum);
+
+    unsigned long getDistribCount() const;
+    unsigned long getVectSize() const;
+    bool hasSecondOrder() const;
+    unsigned long getFrameCount() const;
+    unsigned long getWorldChecksum() const;
+
+    /// Returns the zero order statistics
+    /// @return distribCount values
+    ///
+    const FloatVector& getZeroOrderVect() const;
+
+    /// Returns the first order statistics
+    /// @return distribCount x vectSize values
+    ///
+    const FloatVector& getFirstOrderVect() const;
+
+    /// Returns the second order statistics
+    /// @return distribCount x vectSize values (empty if
+    ///     hasSecondOrder() is false)
+    ///
+    const FloatVector& getSecondOrderVect() const;
+
+    /// Saves the statistics in a binary file
+    /// @param f the file name
+    /// @exception IOException if an I/O error occurs
+    ///
+    void save(const FileName& f) const;
+
+    /// Reads a file written by save()
+    /// @param f the file name
+    /// @exception IOException if the file cannot be read or is not a
+    ///     statistics file
+    ///
+    void load(const FileName& f);
+
+    /// Returns the offset of the first order statistics in a file
+    /// @param distribCount number of distributions
+    /// @return the offset in bytes
+    ///
+    static unsigned long getFirstOrderOffset(unsigned long distribCount);
+
+    /// Returns the size of a file
+    /// @param distribCount number of distributions
+    /// @param vectSize dimension of the frames
+    /// @param secondOrder true if the file has second order statistics
+    /// @return the size in bytes
+    ///
+    static unsigned long getFileSize(unsigned long distribCount,
+                           unsigned long vectSize, bool secondOrder);
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    unsigned long _distribCount;
+    unsigned long _vectSize;
+    bool          _secondOrder;
+    unsigned long _frameCount;
+    unsigned long _worldChecksum;
+    FloatVector   _zeroOrderVect;
+    FloatVector   _firstOrderVect;
+    FloatVector   _secondOrderVect;
+
+    BaumWelchStats(const BaumWelchStats&); /*!Not implemented*/
+    const BaumWelchStats& operator=(
+                const BaumWelchStats&); /*!Not implemented*/
+    bool operator==(const BaumWelchStats&) const; /*!Not implemented*/
+    bool operator!=(const BaumWelchStats&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_BaumWelchStats_h)
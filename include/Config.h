@@ -177,6 +177,53 @@ namespace alize
     ///
     bool getParam_computeLLKWithTopDistribs() const;
 
+    /// Likelihoods of GD mixtures computed in the log domain
+    /// @return false if the param does not exist
+    ///
+    bool getParam_computeLLKInLogDomain() const;
+
+    /// Top distributions of GD mixtures determined with the gaussian
+    /// selection index of the mixture (see MixtureGDSelector)
+    /// @return false if the param does not exist
+    ///
+    bool getParam_gaussianSelection() const;
+
+    /// Number of clusters of the gaussian selection indexes
+    /// @return 0 (automatic) if the param does not exist
+    ///
+    unsigned long getParam_gaussianSelectionClusterCount() const;
+
+    /// Number of clusters searched to determine the top distributions
+    /// @return 0 (automatic) if the param does not exist
+    ///
+    unsigned long getParam_gaussianSelectionSearchedClusterCount() const;
+
+    /// Extension of the gaussian selection index files
+    /// @return ".gsi" if the param does not exist
+    ///
+    const String& getParam_gaussianSelectionFileExtension() const;
+
+    /// Top distributions of GD mixtures determined with a partial distance
+    /// search : a distribution is rejected as soon as its partial distance
+    /// shows that it cannot be among the best ones. The likelihood of the
+    /// frame is then computed with the top distributions only.
+    /// @return false if the param does not exist
+    ///
+    bool getParam_topDistribsPruning() const;
+
+    /// Minimum occupation of a distribution for a frame to be accumulated
+    /// by the EM of GD mixtures. The remaining occupations are normalized
+    /// again.
+    /// @return 0.0 (all the distributions) if the param does not exist
+    ///
+    real_t getParam_emOccThreshold() const;
+
+    /// Maximum number of distributions accumulated for a frame by the EM
+    /// of GD mixtures (the distributions with the highest occupations)
+    /// @return 0 (all the distributions) if the param does not exist
+    ///
+    unsigned long getParam_emTopDistribsCount() const;
+
     ///
     bool getParam_debug() const;
 
@@ -244,6 +291,19 @@ namespace alize
     ///
     unsigned long getParam_loadFeatureFileMemAlloc() const;
 
+    /// Feature files with a fixed layout (SPro3, SPro4, HTK, RAW) mapped
+    /// in memory and read in place instead of being copied in a buffer.
+    /// @return false if the param does not exist
+    ///
+    bool getParam_loadFeatureFileMemoryMap() const;
+
+    /// When loadFeatureFileMemAlloc limits the buffer of a feature file,
+    /// the next block of features is loaded by a background thread
+    /// (THREAD defined, not on Windows).
+    /// @return false if the param does not exist
+    ///
+    bool getParam_loadFeatureFilePrefetch() const;
+
     /// @exception if the param does not exist
     ///
     unsigned long getParam_featureServerMemAlloc() const;
@@ -349,8 +409,18 @@ namespace alize
     bool  existsParam_minCov;
     bool  existsParam_vectSize;
     bool  existsParam_loadFeatureFileMemAlloc;
+    bool  existsParam_loadFeatureFileMemoryMap;
+    bool  existsParam_loadFeatureFilePrefetch;
     bool  existsParam_featureServerMemAlloc;
     bool  existsParam_computeLLKWithTopDistribs;
+    bool  existsParam_computeLLKInLogDomain;
+    bool  existsParam_gaussianSelection;
+    bool  existsParam_gaussianSelectionClusterCount;
+    bool  existsParam_gaussianSelectionSearchedClusterCount;
+    bool  existsParam_gaussianSelectionFileExtension;
+    bool  existsParam_topDistribsPruning;
+    bool  existsParam_emOccThreshold;
+    bool  existsParam_emTopDistribsCount;
     bool  existsParam_debug;
     bool  existsParam_topDistribsCount;
     bool  existsParam_featureServerBufferSize;
@@ -394,8 +464,18 @@ namespace alize
     real_t              _param_minCov;
     unsigned long       _param_vectSize;
     unsigned long       _param_loadFeatureFileMemAlloc;
+    bool                _param_loadFeatureFileMemoryMap;
+    bool                _param_loadFeatureFilePrefetch;
     unsigned long       _param_featureServerMemAlloc;
     bool                _param_computeLLKWithTopDistribs;
+    bool                _param_computeLLKInLogDomain;
+    bool                _param_gaussianSelection;
+    unsigned long       _param_gaussianSelectionClusterCount;
+    unsigned long       _param_gaussianSelectionSearchedClusterCount;
+    String              _param_gaussianSelectionFileExtension;
+    bool                _param_topDistribsPruning;
+    real_t              _param_emOccThreshold;
+    unsigned long       _param_emTopDistribsCount;
     bool                _param_debug;
     unsigned long       _param_topDistribsCount;
     String              _param_featureServerBufferSize; // can be a number
@@ -71,6 +71,7 @@
 namespace alize
 {
   class Feature;
+  class FeatureView;
 
   /// Abstract base class for all distribution classes.
   ///
@@ -134,7 +135,8 @@ namespace alize
     ///
     real_t getMean(unsigned long index) const;
     
-    /// Returns a reference to the mean vector
+    /// Returns a reference to the mean vector. Does not change
+    /// getVersion() : call markModified() after writing through it.
     /// @return a reference to the mean vector
     /// 
     DoubleVector& getMeanVect();
@@ -164,6 +166,14 @@ namespace alize
     virtual lk_t computeLK(const Feature&) const = 0;
     virtual lk_t computeLK(const Feature&, unsigned long idx) const = 0;
 
+    /// Compute the likelihood between this distribution and a frame that
+    /// is not copied in a Feature object. The default implementation
+    /// copies the frame in a temporary Feature : the derived classes can
+    /// read the single precision values directly.
+    /// @return the likelihood
+    ///
+    virtual lk_t computeLK(const FeatureView&) const;
+
     /// Returns the constante used to compute likelihood.
     /// @return the value of the constant
     ///
@@ -197,6 +207,26 @@ namespace alize
     unsigned long& dictIndex(const K&);
     unsigned long& refCounter(const K&);
 
+    /// Returns a counter incremented each time the parameters of this
+    /// distribution are modified by a setter, computeAll(), operator=()
+    /// or markModified(). Used to detect stale copies of the parameters
+    /// (see MixtureGDCompiled).
+    /// @return the value of the counter
+    ///
+    unsigned long getVersion() const;
+
+    /// Increments the version counters. Must be called after writing the
+    /// parameters through a reference returned by a non constant accessor
+    /// (getMeanVect(), ...) unless computeAll() is called.
+    ///
+    virtual void markModified();
+
+    /// Returns a counter incremented each time the parameters of any
+    /// distribution can have been modified
+    /// @return the value of the counter
+    ///
+    static unsigned long getGlobalVersion();
+
     static Distrib& create(const K&, const DistribType,
                            unsigned long vectSize);
   protected:
@@ -205,9 +235,16 @@ namespace alize
     real_t              _det;        /*!< determinant */
     real_t              _cst;        /*!< constante */
     DoubleVector        _meanVect;   /*!< mean vector */
+
+    /// Increments the version counters. Must be called by each method that
+    /// modifies the parameters
+    ///
+    void incrementVersion();
   private :
     unsigned long _refCounter;
     unsigned long _dictIndex;
+    unsigned long _version;
+    static unsigned long _globalVersion;
 
     virtual Distrib& clone() const = 0;
   };
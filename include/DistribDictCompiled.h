@@ -0,0 +1,215 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_DistribDictCompiled_h)
+#define ALIZE_DistribDictCompiled_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "ULongVector.h"
+
+namespace alize
+{
+  class Distrib;
+  class Feature;
+  class FrameBlock;
+  class MixtureServer;
+  class ThreadPool;
+
+  /// Read-only packed copy of the GD distributions of the dictionary of a
+  /// MixtureServer, used to compute the likelihoods of all the
+  /// distributions shared by the mixtures of the server (see
+  /// StatServer::computeAllDistribLK()) without a virtual call per
+  /// distribution.\n
+  /// Means and inverse covariances are stored in two matrices (one row per
+  /// distribution, in the order of the dictionary, each row aligned on a
+  /// cache line). The copy is updated when distributions have been added,
+  /// removed or modified (see Distrib::getVersion()).\n
+  /// If the dictionary contains a distribution which is not a GD, nothing
+  /// is packed and isPacked() returns false.\n
+  /// Do not create this object yourself, use
+  /// MixtureServer::getCompiledDistribs().
+  ///
+  /// @version 1.0
+
+  class ALIZE_API DistribDictCompiled : public Object
+  {
+
+  public :
+
+    /// Creates a packed copy of the distributions of a server
+    /// @param ms the server
+    ///
+    explicit DistribDictCompiled(const MixtureServer& ms);
+    virtual ~DistribDictCompiled();
+
+    /// Tests whether the packed copy matches the current distributions of
+    /// a server. Only reads (see MixtureGDCompiled::isUpToDate()).
+    /// @param ms the server
+    /// @return true if the copy is up to date
+    ///
+    bool isUpToDate(const MixtureServer& ms) const;
+
+    /// Copies the distributions of the server if they have been modified
+    /// since the last call
+    /// @param ms the server
+    ///
+    void update(const MixtureServer& ms);
+
+    /// Like update(), also records the current
+    /// Distrib::getGlobalVersion() when the copy is up to date (see
+    /// MixtureGDCompiled::prepare())
+    /// @param ms the server
+    ///
+    void prepare(const MixtureServer& ms);
+
+    /// Tests whether the distributions have been packed
+    /// @return false if a distribution of the server is not a GD
+    ///
+    bool isPacked() const;
+
+    unsigned long getDistribCount() const;
+    unsigned long getVectSize() const;
+
+    /// Computes the likelihoods of all the distributions for a feature.
+    /// lk[d] is exactly the result of DistribGD::computeLK() for the
+    /// distribution d of the dictionary.
+    /// @param f the feature
+    /// @param lk array of getDistribCount() values to store the results
+    /// @exception Exception if the distributions are not packed or if the
+    ///      feature vectSize does not match the distributions vectSize
+    ///
+    void computeLK(const Feature& f, lk_t* lk) const;
+
+    /// Like computeLK(const Feature&, lk_t*) with the distributions shared
+    /// between the threads of a pool. Gives the same results.
+    /// @param f the feature
+    /// @param lk array of getDistribCount() values to store the results
+    /// @param pool the threads
+    /// @exception Exception if the distributions are not packed or if the
+    ///      feature vectSize does not match the distributions vectSize
+    ///
+    void computeLK(const Feature& f, lk_t* lk, ThreadPool& pool) const;
+
+    /// Computes the likelihoods of all the distributions for each frame of
+    /// a block. The likelihood of distribution d for frame t is stored in
+    /// lk[t*getDistribCount()+d]. The distributions are processed by
+    /// groups small enough to stay in the processor cache while a group of
+    /// frames is computed.
+    /// @param b the block of frames
+    /// @param lk array of b.getFrameCount()*getDistribCount() values
+    /// @exception Exception if the distributions are not packed or if the
+    ///      block vectSize does not match the distributions vectSize
+    ///
+    void computeLK(const FrameBlock& b, lk_t* lk) const;
+
+    /// Like computeLK(const FrameBlock&, lk_t*) with the groups of frames
+    /// shared between the threads of a pool. Gives the same results.
+    /// @param b the block of frames
+    /// @param lk array of b.getFrameCount()*getDistribCount() values
+    /// @param pool the threads
+    /// @exception Exception if the distributions are not packed or if the
+    ///      block vectSize does not match the distributions vectSize
+    ///
+    void computeLK(const FrameBlock& b, lk_t* lk, ThreadPool& pool) const;
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    bool          _packed;
+    unsigned long _distribCount;
+    unsigned long _vectSize;
+    unsigned long _stride;
+    unsigned long _capacity;
+    real_t*       _meanArray;
+    real_t*       _covInvArray;
+    real_t*       _cstArray;
+
+    unsigned long _globalVersion;
+    const Distrib** _distribArray; // the packed distributions and
+    ULongVector     _distribVersionVect; // their versions
+
+    void build(const MixtureServer& ms);
+    void freeArrays();
+    void assertPacked(unsigned long vectSize) const;
+    unsigned long getDistribBlockSize() const;
+    void computeLK(const real_t* data, unsigned long first,
+                   unsigned long last, lk_t* lk) const;
+    void computeLK(const FrameBlock& b, unsigned long first,
+                   unsigned long last, lk_t* lk) const;
+
+    friend class DistribDictCompiledTask;
+
+    DistribDictCompiled(const DistribDictCompiled&); /*!Not implemented*/
+    const DistribDictCompiled& operator=(
+                const DistribDictCompiled&); /*!Not implemented*/
+    bool operator==(const DistribDictCompiled&) const; /*!Not implemented*/
+    bool operator!=(const DistribDictCompiled&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_DistribDictCompiled_h)
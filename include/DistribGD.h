@@ -159,6 +159,11 @@ namespace alize
     virtual lk_t computeLK(const Feature&) const;
     virtual lk_t computeLK(const Feature&, unsigned long idx) const;
 
+    /// Like computeLK(const Feature&) : the single precision values of the
+    /// frame are read directly by the vectorized kernel.
+    ///
+    virtual lk_t computeLK(const FeatureView&) const;
+
     /// Sets a value in the covariance vector.
     /// A zero value is automatically replaced by a positive-and-non-zero
     /// value near to zero.
@@ -195,7 +200,8 @@ namespace alize
     DoubleVector& getCovVect();
     const DoubleVector& getCovVect() const;
 
-    /// Returns a reference to the inverse covariance vector
+    /// Returns a reference to the inverse covariance vector. Does not
+    /// change getVersion() : call markModified() after writing through it.
     /// @return a reference to the inverse covariance vector
     ///
     DoubleVector& getCovInvVect();
@@ -82,7 +82,14 @@ namespace alize
   /// A temporary array is used to store covariance values. This array
   /// is destroyed after calling computeAll().
   /// Before calling computeAll(), the distribution is not valid for some
-  /// methods.
+  /// methods.\n
+  /// The likelihood is computed with the Cholesky factor L of the inverse
+  /// covariance matrix (covInv = L*L'), stored in packed form : the
+  /// quadratic form is the squared norm of L'*(x-mean). The factor is
+  /// computed by computeAll() or, after setCovInv() or markModified(),
+  /// by the next call to computeLK() or updateCholesky(). Once it is up to
+  /// date, computeLK() does not modify the object and can be called by
+  /// several threads at the same time.
   ///
   /// @author Frederic Wils  frederic.wils@lia.univ-avignon.fr
   /// @date 2003
@@ -159,6 +166,18 @@ namespace alize
     ///
     virtual lk_t computeLK(const Feature&) const;
     virtual lk_t computeLK(const Feature&, unsigned long idx) const;
+    virtual lk_t computeLK(const FeatureView&) const;
+
+    /// Computes the Cholesky factor of the inverse covariance matrix if it
+    /// has been modified since the last computation. If the matrix is not
+    /// positive definite, the likelihood is computed with the full matrix.
+    ///
+    void updateCholesky() const;
+
+    /// Like Distrib::markModified(), also marks the Cholesky factor as
+    /// stale
+    ///
+    virtual void markModified();
 
     /// Sets a value in the covariance matrix.
     /// WARNING : contrary to class Matrix, colum index is FIRST
@@ -206,7 +225,9 @@ namespace alize
     DoubleSquareMatrix& getCovMatrix();
     const DoubleSquareMatrix& getCovMatrix() const;
 
-    /// Returns a reference to the inverse covariance matrix
+    /// Returns a reference to the inverse covariance matrix. Call
+    /// markModified() after writing through it : the Cholesky factor is
+    /// then recomputed.
     /// @return a reference to the inverse covariance matrix
     ///
     DoubleSquareMatrix& getCovInvMatrix();
@@ -255,8 +276,14 @@ namespace alize
                                           matrix. The matrix is cleared
                                           after calling computeAll()*/
     DoubleSquareMatrix  _covInvMatr; /*!< inverse covariance matrix */
-    real_t              _cst;        /*!< constante */
-    DoubleVector        _tmpVect;
+    mutable DoubleVector _cholVect;  /*!< Cholesky factor L of the inverse
+                                          covariance matrix, stored column
+                                          by column (lower triangle) */
+    mutable bool        _cholUpToDate;
+    mutable bool        _cholDefined; /*!< false if the inverse covariance
+                                          matrix is not positive definite */
+
+    real_t computeQuadraticForm(const real_t* f) const;
 
   };
 
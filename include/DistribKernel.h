@@ -0,0 +1,232 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_DistribKernel_h)
+#define ALIZE_DistribKernel_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "alizeString.h"
+
+namespace alize
+{
+  /// Low-level computation kernels used by the distribution classes to
+  /// compute likelihoods.\n
+  /// Several implementations of each kernel are compiled in the library
+  /// (portable C, SSE2, AVX2 and AVX-512 on x86 processors). The best one
+  /// supported by the processor is selected when the library is
+  /// initialized, so the threads which call the kernels never write the
+  /// selection. It can be forced with setInstructionSet().\n
+  /// The vectorized kernels do not add the terms in the same order as the
+  /// portable one, so results can differ in the last bits.
+  ///
+  /// @version 1.0
+
+  class ALIZE_API DistribKernel
+  {
+  public :
+
+    enum InstructionSet
+    {
+      InstructionSet_SCALAR,
+      InstructionSet_SSE2,
+      InstructionSet_AVX2,
+      InstructionSet_AVX512
+    };
+
+    /// Computes the weighted squared distance between a feature and a mean
+    /// vector : sum of (f[i]-m[i])*(f[i]-m[i])*c[i]
+    /// @param f feature data
+    /// @param m mean vector
+    /// @param c inverse covariance vector
+    /// @param n dimension of the vectors
+    /// @return the weighted squared distance
+    ///
+    static real_t computeWeightedDist(const real_t* f, const real_t* m,
+                                      const real_t* c, unsigned long n);
+
+    /// Like computeWeightedDist() with single precision feature data. The
+    /// values are converted in the registers, in the same order as the
+    /// double precision kernel : the result is exactly the one of the
+    /// feature converted beforehand.
+    ///
+    static real_t computeWeightedDist(const float* f, const real_t* m,
+                                      const real_t* c, unsigned long n);
+
+    /// Computes the dot product between a vector and the difference between
+    /// a feature and a mean vector : sum of a[i]*(f[i]-m[i]). Used to
+    /// multiply a triangular matrix stored by rows by f-m without a
+    /// temporary vector.
+    /// @param a the vector
+    /// @param f feature data
+    /// @param m mean vector
+    /// @param n dimension of the vectors
+    /// @return the dot product
+    ///
+    static real_t computeDotDiff(const real_t* a, const real_t* f,
+                                 const real_t* m, unsigned long n);
+
+    /// Replaces each value of an array by its exponential. The vectorized
+    /// versions are accurate to a few units in the last place. With AVX2,
+    /// results smaller than exp(-708) are set to 0 and arguments larger
+    /// than 709 are saturated.
+    /// @param v the array
+    /// @param n number of values
+    ///
+    static void computeExp(real_t* v, unsigned long n);
+
+    /// Computes log(sum of exp(v[i])) without overflow nor underflow : the
+    /// largest value max is subtracted before the exponentials are
+    /// computed. On return, v[i] contains exp(v[i]-max), or 0 for each
+    /// value if max is infinite (or NaN) : then max is returned.
+    /// @param v the array (modified)
+    /// @param n number of values
+    /// @return the logarithm of the sum of the exponentials
+    ///
+    static real_t computeLogSumExp(real_t* v, unsigned long n);
+
+    /// Tests the exponent bits of a value. Unlike isnan() and the
+    /// comparisons with HUGE_VAL, these tests are not removed by
+    /// -ffast-math, which assumes that the values are finite.
+    /// @param x the value
+    /// @return false for an infinite value or a NaN
+    ///
+    static bool isFinite(real_t x);
+
+    /// Like isFinite()
+    /// @param x the value
+    /// @return true for a NaN
+    ///
+    static bool isNaN(real_t x);
+
+    /// Returns the instruction set used by the kernels
+    /// @return the instruction set
+    ///
+    static InstructionSet getInstructionSet();
+
+    /// Forces the instruction set used by the kernels. Not thread-safe :
+    /// to call before the threads which compute likelihoods are started.
+    /// @param s the instruction set
+    /// @exception Exception if the processor does not support s
+    ///
+    static void setInstructionSet(InstructionSet s);
+
+    /// Tests whether the processor supports an instruction set
+    /// @param s the instruction set
+    /// @return true if s is supported; false otherwise
+    ///
+    static bool isSupported(InstructionSet s);
+
+    static String getInstructionSetName(InstructionSet s);
+
+    /// Allocates an array of real values aligned on a cache line
+    /// @param n number of values
+    /// @return a pointer to the first value. Must be released with
+    ///    freeArray()
+    /// @exception OutOfMemoryException
+    ///
+    static real_t* allocArray(unsigned long n);
+
+    /// Releases an array allocated with allocArray()
+    /// @param p the array (can be NULL)
+    ///
+    static void freeArray(real_t* p);
+
+    /// Returns n rounded up to a whole number of cache lines of real values.
+    /// Used as the row length of packed matrices so that each row starts
+    /// on a cache line.
+    /// @param n number of values
+    /// @return the padded size
+    ///
+    static unsigned long getPaddedSize(unsigned long n);
+
+  private :
+
+    typedef real_t (*WeightedDistFunc)(const real_t*, const real_t*,
+                                       const real_t*, unsigned long);
+
+    typedef real_t (*WeightedDistFloatFunc)(const float*, const real_t*,
+                                            const real_t*, unsigned long);
+    typedef WeightedDistFunc DotDiffFunc;
+    typedef void (*ExpFunc)(real_t*, unsigned long);
+
+    static WeightedDistFunc _weightedDist;
+    static WeightedDistFloatFunc _weightedDistFloat;
+    static DotDiffFunc      _dotDiff;
+    static ExpFunc          _exp;
+    static InstructionSet   _instructionSet;
+
+    static real_t resolveWeightedDist(const real_t*, const real_t*,
+                                      const real_t*, unsigned long);
+    static real_t resolveWeightedDistFloat(const float*, const real_t*,
+                                           const real_t*, unsigned long);
+    static real_t resolveDotDiff(const real_t*, const real_t*,
+                                 const real_t*, unsigned long);
+    static void resolveExp(real_t*, unsigned long);
+    static InstructionSet detectInstructionSet();
+    DistribKernel(); /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_DistribKernel_h)
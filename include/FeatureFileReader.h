@@ -145,6 +145,9 @@ namespace alize
                              const String& srcName = "");
     virtual bool addFeature(const Feature& f);
     virtual bool readFeature(Feature& f, unsigned long s = 1);
+    virtual bool readFeature(FeatureView& v, unsigned long s = 1);
+    virtual unsigned long readFeatures(FrameBlock& b,
+                                       unsigned long maxFrames);
 
     virtual bool writeFeature(const Feature& f, unsigned long step = 1);
 
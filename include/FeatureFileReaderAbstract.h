@@ -73,6 +73,7 @@ namespace alize
   class Config;
   class FileReader;
   class Feature;
+  class FeatureView;
   
   /// Abstract base class for feature file readers
   /// @author Frederic Wils  frederic.wils@lia.univ-avignon.fr
@@ -95,6 +96,18 @@ namespace alize
     ///
     virtual void setExternalBufferToUse(FloatVector& v);
 
+    virtual bool readFeature(Feature& f, unsigned long step = 1) = 0;
+
+    /// Reads a feature without copying it : the view points at the frame
+    /// in the buffer of the reader (or in the mapped file) and is valid
+    /// until the next read.
+    /// @param v the view
+    /// @param step step of the feature index
+    /// @return false if the end of the stream is reached
+    /// @exception Exception if the reader does not support views
+    ///
+    virtual bool readFeature(FeatureView& v, unsigned long step = 1);
+
     virtual void reset();
     virtual void seekFeature(unsigned long featureNbr,
                              const String& srcName = "");
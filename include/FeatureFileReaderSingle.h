@@ -67,6 +67,7 @@
 
 #include "FeatureFileReaderAbstract.h"
 #include "Feature.h"
+#include "FrameBlock.h"
 #include "RealVector.h"
 
 namespace alize
@@ -95,6 +96,13 @@ namespace alize
     virtual void close();
 
     virtual bool readFeature(Feature&, unsigned long step = 1);
+    virtual bool readFeature(FeatureView&, unsigned long step = 1);
+
+    /// Reads a block of features directly from the buffer or from the
+    /// mapped file (see FeatureInputStream::readFeatures())
+    ///
+    virtual unsigned long readFeatures(FrameBlock& b,
+                                       unsigned long maxFrames);
     virtual bool addFeature(const Feature& f);
     virtual bool writeFeature(const Feature& f, unsigned long step = 1);
     virtual unsigned long getSourceCount();
@@ -124,7 +132,14 @@ namespace alize
     unsigned long   _featureIndexOfBuffer;
     unsigned long   _nbStored;
     FloatVector*    _pBuffer;
-    Feature         _f;
+    FrameBlock      _block; // features read from _pFeatureInputStream
+    // memory mapped file (param loadFeatureFileMemoryMap)
+    bool            _mapTried;
+    const char*     _pMappedData; /*! first frame in the mapping or NULL */
+    // next block of features loaded in the background
+    // (param loadFeatureFilePrefetch)
+    struct Prefetch;
+    Prefetch*       _pPrefetch;
 
     String getPath(const FileName&, const Config&) const;
     String getExt(const FileName&, const Config&) const;
@@ -134,6 +149,46 @@ namespace alize
 
     virtual unsigned long getHeaderLength();
     bool featureWantedIsInHistoric() const;
+    void loadBuffer(unsigned long featureCount);
+    unsigned long addSourceLabel();
+
+    /// Fills the buffer with the features read by blocks from
+    /// _pFeatureInputStream. Stops at the end of the stream or at an
+    /// invalid feature; the stream is then repositioned just after the
+    /// last feature stored.
+    /// @param start index of the first feature read
+    /// @return the number of features stored
+    ///
+    unsigned long loadBufferFromStream(unsigned long start);
+
+    /// Maps the file in memory if the param loadFeatureFileMemoryMap is
+    /// set. Tried once : the buffer is used when the file cannot be mapped.
+    /// @return true if the features are read from the mapped file
+    ///
+    bool mapFile();
+
+    /// Leaves the mapped file and comes back to the buffer, which is
+    /// needed to modify the features.
+    ///
+    void unmapFile();
+
+    /// Starts the loading of the block which follows the buffer in a
+    /// background thread. The file must not be used by the caller
+    /// until joinPrefetch() has been called.
+    ///
+    void startPrefetch(unsigned long featureCount);
+
+    /// Waits for the end of the background loading
+    ///
+    void joinPrefetch();
+
+    /// Swaps the buffer with the block loaded in the background if it
+    /// contains _featureIndex
+    /// @return false if the block must be loaded by the caller
+    ///
+    bool usePrefetch();
+    void deletePrefetch();
+    static void* prefetchMain(void*);
   };
 
 } // end namespace alize
@@ -72,6 +72,8 @@
 namespace alize
 {
   class Feature;
+  class FeatureView;
+  class FrameBlock;
   class LabelServer;
   class Config;
   
@@ -126,6 +128,32 @@ namespace alize
     ///
     virtual bool readFeature(Feature& f, unsigned long s = 1) = 0;
 
+    /// Reads a feature without copying it : the view points at the frame
+    /// stored by the stream (see FeatureFileReaderAbstract) and is valid
+    /// until the next read
+    /// @param v the view
+    /// @param s step (default value = 1)
+    /// @return false if there is no more data because the end of the
+    ///     file has been reached
+    /// @exception Exception if the stream does not support views
+    ///
+    virtual bool readFeature(FeatureView& v, unsigned long s = 1);
+
+    /// Reads at most maxFrames consecutive features in the stream and
+    /// stores their data in a block (one row per feature). The block is
+    /// cleared and takes the vectSize of the stream. The result is the
+    /// same as calling readFeature() for each feature, but the streams
+    /// of a chain do their work once per block instead of once per
+    /// feature. The label codes are not stored. Reading stops before an
+    /// invalid feature (see getError()).
+    /// @param b the block
+    /// @param maxFrames maximum number of features to read
+    /// @return the number of features read (0 at the end of the stream)
+    /// @exception IOException if an I/O error occurs
+    ///
+    virtual unsigned long readFeatures(FrameBlock& b,
+                                       unsigned long maxFrames);
+
     /// adds a feature in the buffer is enougth memory have been allocated by 
     /// featureServerMemAlloc option
     /// @param f the feature to add in the buffer
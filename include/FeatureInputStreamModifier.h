@@ -68,6 +68,7 @@
 #include "FeatureInputStream.h"
 #include "alizeString.h"
 #include "Feature.h"
+#include "FrameBlock.h"
 #include "ULongVector.h"
 
 namespace alize
@@ -116,6 +117,12 @@ namespace alize
 
     virtual bool readFeature(Feature& f, unsigned long step = 1);
 
+    /// Reads a block in the input stream and applies the mask to the
+    /// whole block
+    ///
+    virtual unsigned long readFeatures(FrameBlock& b,
+                                       unsigned long maxFrames);
+
     virtual bool writeFeature(const Feature& f, unsigned long step = 1);
 
     /// Returns the number of features in the file.
@@ -200,6 +207,7 @@ namespace alize
 
     FeatureInputStream* _pInput;
     Feature             _feature;
+    FrameBlock          _block;
     String              _mask;
     String              _tmpMask;
     ULongVector         _selection;
@@ -231,6 +231,23 @@ namespace alize
     ///    
     virtual bool readFeature(Feature& f, unsigned long s = 1);
 
+    /// Reads a feature without copying it (see
+    /// FeatureInputStream::readFeature(FeatureView&...)). The input stream
+    /// must support views.
+    /// @param v the view
+    /// @param s step
+    /// @return false if end of stream met; true otherwise
+    ///
+    virtual bool readFeature(FeatureView& v, unsigned long s = 1);
+
+    /// Reads a block of features (see FeatureInputStream::readFeatures())
+    /// @param b the block to store the data read
+    /// @param maxFrames maximum number of features to read
+    /// @return the number of features read
+    ///
+    virtual unsigned long readFeatures(FrameBlock& b,
+                                       unsigned long maxFrames);
+
     /// adds a feature
     /// @param f the feature to store the data read
     /// @return false not possible to add feature
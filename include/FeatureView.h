@@ -0,0 +1,156 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_FeatureView_h)
+#define ALIZE_FeatureView_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+
+namespace alize
+{
+  class Feature;
+
+  /// A feature that does not own its acoustic parameters : it points at
+  /// a frame of single precision values stored elsewhere (the buffer of a
+  /// feature file reader, a mapped file...). Reading a frame through a
+  /// view does not copy or convert anything. The distributions compute
+  /// their likelihood directly from the view (see Distrib::computeLK()).\n
+  /// The view is valid as long as the storage it points at : a reader
+  /// can reuse its buffer at the next read.
+  ///
+  /// @version 1.0
+
+  class ALIZE_API FeatureView : public Object
+  {
+
+  public :
+
+    /// Creates an empty view
+    ///
+    FeatureView();
+
+    /// Creates a view
+    /// @param data first acoustic parameter of the frame
+    /// @param vectSize size of the acoustic parameters vector
+    ///
+    FeatureView(const float* data, unsigned long vectSize);
+
+    FeatureView(const FeatureView&);
+
+    /// Copies the view (not the data it points at), the validity flag
+    /// and the label code
+    ///
+    const FeatureView& operator=(const FeatureView&);
+
+    virtual ~FeatureView();
+
+    /// Points the view at another frame
+    /// @param data first acoustic parameter of the frame
+    /// @param vectSize size of the acoustic parameters vector
+    ///
+    void setData(const float* data, unsigned long vectSize);
+
+    unsigned long getVectSize() const;
+
+    /// Overloaded operator[] to read an element in the acoustic
+    /// parameters vector
+    /// @param index index of the element to read
+    /// @return the value of the element
+    /// @exception IndexOutOfBoundsException
+    ///
+    float operator[](unsigned long index) const;
+
+    /// Use this method to access directly to the frame
+    /// @return a pointer on the first acoustic parameter
+    ///
+    const float* getDataVector() const;
+
+    bool isValid() const;
+    void setValidity(bool validity);
+    unsigned long getLabelCode() const;
+    void setLabelCode(unsigned long code);
+
+    /// Copies the acoustic parameters, the validity and the label code
+    /// into a feature. The feature is resized if necessary.
+    /// @param f the feature
+    ///
+    void copyTo(Feature& f) const;
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    const float*  _dataVector;
+    unsigned long _vectSize;
+    bool          _isValid;
+    unsigned long _labelCode;
+
+    bool operator==(const FeatureView&) const; /*!Not implemented*/
+    bool operator!=(const FeatureView&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_FeatureView_h)
@@ -226,6 +226,24 @@ namespace alize
     ///
     void open();
 
+    /// Maps the whole file read-only in memory. The mapping is
+    /// independent of the opened stream : it remains valid after close()
+    /// and is released by unmap() or by the destructor.
+    /// @return the address of the first byte of the file, or NULL if the
+    ///         file is empty or cannot be mapped on this system
+    /// @exception FileNotFoundException
+    ///
+    const char* map();
+
+    /// Releases the mapping created by map(), if any.
+    ///
+    void unmap();
+
+    /// Tests whether the file is mapped in memory
+    /// @return true if the file is mapped; false otherwise
+    ///
+    bool isMapped() const;
+
     /// Reads and returns the file length
     /// @exception IOException if an I/O error occurs
     /// @return the length of the file in bytes
@@ -263,6 +281,9 @@ namespace alize
     bool           _fileLengthDefined;
     mutable String _string; /*! to store temporary data */
     bool           _swap; /*! flag for numeric data */
+    const char*    _pMap; /*! address of the mapped file. Can be NULL */
+    unsigned long  _mapLength;
+    void*          _mapHandle; /*! file mapping object (Windows only) */
 
     /// Low-level method to read bytes from a file.
     /// @param buffer A pointer to a memory area to store the data
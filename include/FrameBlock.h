@@ -0,0 +1,175 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_FrameBlock_h)
+#define ALIZE_FrameBlock_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+
+namespace alize
+{
+  class Feature;
+
+  /// A block of consecutive frames stored in one contiguous array (one row
+  /// per frame, each row aligned on a cache line).\n
+  /// Used to compute the likelihoods of many frames in one call (see
+  /// StatServer::computeLLKBatch()) : the parameters of a mixture are then
+  /// loaded once for the whole block instead of once per frame.
+  ///
+  /// @version 1.0
+
+  class ALIZE_API FrameBlock : public Object
+  {
+
+  public :
+
+    /// Creates an empty block
+    /// @param vectSize dimension of the frames
+    /// @param capacity number of frames allocated
+    ///
+    explicit FrameBlock(unsigned long vectSize = 0,
+                        unsigned long capacity = 0);
+    virtual ~FrameBlock();
+
+    unsigned long getVectSize() const;
+
+    /// Sets the dimension of the frames. All the frames are lost.
+    /// @param vectSize dimension of the frames
+    ///
+    void setVectSize(unsigned long vectSize);
+
+    /// Returns the number of frames in the block
+    /// @return the number of frames
+    ///
+    unsigned long getFrameCount() const;
+
+    /// Sets the number of frames in the block. Used to fill the block
+    /// directly with getFrame(). The capacity grows if necessary and the
+    /// values of the new frames are undefined.
+    /// @param n the number of frames
+    ///
+    void setFrameCount(unsigned long n);
+
+    unsigned long getCapacity() const;
+
+    /// Sets the number of frames allocated. The frames already stored are
+    /// kept.
+    /// @param capacity the number of frames
+    ///
+    void setCapacity(unsigned long capacity);
+
+    /// Returns the length of a row (vectSize rounded up to a cache line)
+    /// @return the length of a row
+    ///
+    unsigned long getStride() const;
+
+    /// Removes all the frames. The memory is not released.
+    ///
+    void clear();
+
+    /// Appends a copy of the data of a feature at the end of the block
+    /// @param f the feature
+    /// @exception Exception if the feature vectSize does not match the
+    ///      block vectSize
+    ///
+    void addFeature(const Feature& f);
+
+    /// Copies a frame of the block into a feature
+    /// @param t index of the frame
+    /// @param f the feature
+    /// @exception Exception if the feature vectSize does not match the
+    ///      block vectSize
+    ///
+    void getFeature(unsigned long t, Feature& f) const;
+
+    /// Returns a pointer to the first value of a frame
+    /// @param t index of the frame
+    /// @return the pointer
+    /// @warning Fast but dangerous ! No bounds checking.
+    ///
+    real_t* getFrame(unsigned long t);
+    const real_t* getFrame(unsigned long t) const;
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    unsigned long _vectSize;
+    unsigned long _stride;
+    unsigned long _frameCount;
+    unsigned long _capacity;
+    real_t*       _array;
+
+    void assertVectSize(const Feature& f) const;
+
+    FrameBlock(const FrameBlock&); /*!Not implemented*/
+    const FrameBlock& operator=(const FrameBlock&); /*!Not implemented*/
+    bool operator==(const FrameBlock&) const; /*!Not implemented*/
+    bool operator!=(const FrameBlock&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_FrameBlock_h)
@@ -134,6 +134,14 @@ namespace alize
     ///
     void descendingSort() const;
 
+    /// Moves the n largest values at the beginning of the vector, sorted in
+    /// descending order. The order of the other values is undefined.
+    /// Much faster than descendingSort() when n is small compared to the
+    /// size of the vector.
+    /// @param n number of values to sort
+    ///
+    void descendingPartialSort(unsigned long n) const;
+
     /// Use this method to access directly to the internal vector
     /// @return a pointer on the first element
     /// @warning Fast but dangerous ! Use preferably operator [].
@@ -155,7 +163,6 @@ namespace alize
     type*         _array;
 
     type* createArray() const;
-    static int compare(const void*, const void*);
 
 
     bool operator==(const LKVector&) const;
@@ -0,0 +1,160 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_LinearScorer_h)
+#define ALIZE_LinearScorer_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "RealVector.h"
+
+namespace alize
+{
+  class BaumWelchStats;
+  class Mixture;
+  class MixtureGD;
+
+  /// Scores speaker models with the linear (first order) approximation of
+  /// the log-likelihood ratio between a model and the world model.\n
+  /// The first order statistics of the test segment are centered on the
+  /// world means and normalized once (see setTestStats()). The score of a
+  /// model is then the dot product of these statistics with the offsets
+  /// of the model means from the world means :\n
+  ///   score = sum over c, i of (m(c,i)-mw(c,i)) * covInvw(c,i) *
+  ///   (F(c,i)-N(c)*mw(c,i)) / frameCount\n
+  /// where m are the model means and mw, covInvw the world parameters.
+  /// Only the means of the models are used : this is meant for models
+  /// MAP-adapted from the world model (means only).\n
+  /// The offsets of a model can be computed once with computeOffsetVect()
+  /// to score it against many segments.
+  ///
+  /// @version 1.0
+
+  class ALIZE_API LinearScorer : public Object
+  {
+
+  public :
+
+    /// Creates a scorer
+    /// @param world the world model. The scorer stores a reference to
+    ///     it. It must not be modified while the scorer is used.
+    /// @exception Exception if the world model is not a MixtureGD
+    ///
+    explicit LinearScorer(const Mixture& world);
+    virtual ~LinearScorer();
+
+    /// Sets the statistics of the test segment
+    /// @param s the statistics computed with the world model (see
+    ///     BaumWelchStatExtractor)
+    /// @exception Exception if the statistics have been computed with
+    ///     another world model or contain no frame
+    ///
+    void setTestStats(const BaumWelchStats& s);
+
+    /// Computes the offsets of the means of a model from the means of
+    /// the world model
+    /// @param m the model
+    /// @param v the offsets (distribCount x vectSize values)
+    /// @exception Exception if the model is not a MixtureGD with the
+    ///     dimensions of the world model
+    ///
+    void computeOffsetVect(const Mixture& m, DoubleVector& v) const;
+
+    /// Computes the score of a model on the test segment
+    /// @param m the model
+    /// @return the score
+    /// @exception Exception like computeOffsetVect() or if no statistics
+    ///     have been set
+    ///
+    real_t computeScore(const Mixture& m) const;
+
+    /// Computes the score of a model given by its offsets
+    /// @param v the offsets computed with computeOffsetVect()
+    /// @return the score
+    /// @exception Exception if the size of v is not correct or if no
+    ///     statistics have been set
+    ///
+    real_t computeScore(const DoubleVector& v) const;
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    const MixtureGD& _world;
+    unsigned long    _worldChecksum;
+    DoubleVector     _testVect; // centered and normalized statistics
+    mutable DoubleVector _offsetVect;
+
+    static const MixtureGD& assertIsGD(const Mixture& m);
+
+    LinearScorer(const LinearScorer&); /*!Not implemented*/
+    const LinearScorer& operator=(const LinearScorer&); /*!Not implemented*/
+    bool operator==(const LinearScorer&) const; /*!Not implemented*/
+    bool operator!=(const LinearScorer&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_LinearScorer_h)
@@ -134,7 +134,8 @@ namespace alize
     ///
     Distrib& getDistrib(unsigned long index) const;
 
-    /// Returns a reference to the weight of a distribution
+    /// Returns a reference to the weight of a distribution. Does not
+    /// change getVersion() : call markModified() after writing through it.
     /// @param index position of the distribution
     /// @return a reference to the weight
     /// @exception IndexOutOfBoundsException
@@ -178,11 +179,18 @@ namespace alize
     void equalizeWeights();
 
     /// Computes distributions internal data (determinant of the matrix,
-    /// inverse covariance and a constante used for likelihood computation)
+    /// inverse covariance and a constante used for likelihood computation).
+    /// Calls markModified().
     ///
     void computeAll();
 
-    /// Returns a reference to the weight vector
+    /// Increments getVersion(). Must be called after writing the weights
+    /// through weight() or getTabWeight() unless computeAll() is called.
+    ///
+    void markModified();
+
+    /// Returns a reference to the weight vector. Does not change
+    /// getVersion() : call markModified() after writing through it.
     /// @return a reference to the weight vector
     ///
     DoubleVector& getTabWeight();
@@ -203,6 +211,28 @@ namespace alize
 
     virtual DistribType getType() const = 0;
 
+    /// Returns a counter incremented each time the list of distributions of
+    /// this mixture is modified, and by equalizeWeights(), computeAll(),
+    /// operator=() and markModified()
+    /// @return the value of the counter
+    ///
+    unsigned long getVersion() const;
+
+    /// Computes a checksum of the parameters of the mixture (see
+    /// Object::updateChecksum()), used to detect that a file has been
+    /// saved from another mixture
+    /// @return the checksum
+    ///
+    virtual unsigned long computeChecksum() const;
+
+    /// Computes the data that are otherwise computed the first time a
+    /// likelihood is needed (packed copy, Cholesky factors...). After this
+    /// call, and as long as the mixture is not modified, the likelihood
+    /// methods do not modify the mixture and several threads can use it
+    /// at the same time.
+    ///
+    virtual void prepare() const;
+
     /// Internal usage
     ///
     virtual MixtureStat& createNewMixtureStatObject(const K&,
@@ -229,6 +259,7 @@ namespace alize
     DoubleVector   _weightVect;  // a vector for weights
     DistribRefVector _distribVect; // a vector for distributions
     String       _id;      // identifier of the mixture
+    unsigned long _version; // see getVersion()
     
     virtual Mixture& clone(DuplDistrib) const = 0;
   };
@@ -0,0 +1,211 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_MixtureEMTrainer_h)
+#define ALIZE_MixtureEMTrainer_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "RefVector.h"
+#include "ULongVector.h"
+#include "RealVector.h"
+
+namespace alize
+{
+  class Config;
+  class FeatureInputStream;
+  class MixtureGD;
+  class ThreadPool;
+
+  /// Trains a MixtureGD with the EM algorithm on segments of one or many
+  /// feature streams, using all the threads of a ThreadPool.\n
+  /// For each iteration, the frames are read by the calling thread and
+  /// shared equally among getAccumulatorCount() jobs. Each job accumulates
+  /// its frames in its own MixtureGDStat (with its own StatServer), then
+  /// the accumulators are merged with MixtureGDStat::addAccEM() in the
+  /// order of the jobs : the result does not depend on the scheduling,
+  /// and does not depend on the number of threads if the number of
+  /// accumulators is set by setAccumulatorCount().\n
+  /// After each iteration the variances are floored (see
+  /// setVarianceFloor()).
+  ///
+  /// @version 1.0
+
+  class ALIZE_API MixtureEMTrainer : public Object
+  {
+
+  public :
+
+    /// Creates a trainer
+    /// @param c configuration used for the statistic servers of the jobs.
+    ///     The trainer stores a reference to it.
+    /// @param pool the threads. The trainer stores a reference to it.
+    ///
+    explicit MixtureEMTrainer(const Config& c, ThreadPool& pool);
+    virtual ~MixtureEMTrainer();
+
+    /// Adds frames to the training data
+    /// @param fs the feature stream. The trainer stores a reference to it.
+    /// @param begin index of the first frame
+    /// @param count number of frames
+    ///
+    void addSegment(FeatureInputStream& fs, unsigned long begin,
+                    unsigned long count);
+
+    /// Adds all the frames of a stream to the training data
+    /// @param fs the feature stream. The trainer stores a reference to it.
+    ///
+    void addFeatureStream(FeatureInputStream& fs);
+
+    /// Returns the number of frames of the training data
+    /// @return the number of frames
+    ///
+    unsigned long getFeatureCount() const;
+
+    /// Sets the number of accumulators, i.e. of jobs for each block of
+    /// frames. By default, one per thread of the pool. With a fixed
+    /// number, the results are the same whatever the number of threads.
+    /// @param n the number of accumulators, 0 for the number of threads
+    ///
+    void setAccumulatorCount(unsigned long n);
+
+    /// Returns the number of accumulators used by iterate()
+    /// @return the number of accumulators
+    ///
+    unsigned long getAccumulatorCount() const;
+
+    /// Sets the same variance floor for all the coefficients. The
+    /// default floor is Object::MIN_COV.
+    /// @param v the floor
+    ///
+    void setVarianceFloor(real_t v);
+
+    /// Sets a variance floor for each coefficient
+    /// @param v the floors (one per coefficient)
+    ///
+    void setVarianceFloor(const DoubleVector& v);
+
+    /// Sets the variance floor of each coefficient to a fraction of the
+    /// variance of this coefficient on the training data (one more pass
+    /// on the data)
+    /// @param factor the fraction, for example 0.01
+    /// @exception Exception if there is no training data
+    ///
+    void computeVarianceFloor(real_t factor);
+
+    /// Returns the variance floors. The vector is empty if the same floor
+    /// is used for all the coefficients.
+    /// @return the floors
+    ///
+    const DoubleVector& getVarianceFloorVect() const;
+
+    /// Runs one EM iteration and replaces the parameters of the mixture by
+    /// the new ones
+    /// @param m the mixture
+    /// @return the mean log-likelihood of the frames computed with the
+    ///     parameters before the iteration
+    /// @exception Exception if there is no training data or if the
+    ///      dimension of the mixture is not the dimension of the frames
+    ///
+    lk_t iterate(MixtureGD& m);
+
+    /// Runs several EM iterations
+    /// @param m the mixture
+    /// @param iterationCount number of iterations
+    /// @return the mean log-likelihood computed by the last iteration
+    /// @exception Exception like iterate()
+    ///
+    lk_t train(MixtureGD& m, unsigned long iterationCount);
+
+    /// Returns the number of variances floored by the last iteration
+    /// @return the number of variances
+    ///
+    unsigned long getFlooredVarianceCount() const;
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    const Config&                 _config;
+    ThreadPool&                   _pool;
+    RefVector<FeatureInputStream> _streamVect;
+    ULongVector                   _beginVect;
+    ULongVector                   _countVect;
+    real_t                        _varianceFloor;
+    DoubleVector                  _varianceFloorVect;
+    unsigned long                 _flooredVarianceCount;
+    unsigned long                 _accumulatorCount; // 0 : thread count
+
+    unsigned long floorVariances(MixtureGD& m);
+
+    MixtureEMTrainer(const MixtureEMTrainer&); /*!Not implemented*/
+    const MixtureEMTrainer& operator=(
+                const MixtureEMTrainer&); /*!Not implemented*/
+    bool operator==(const MixtureEMTrainer&) const; /*!Not implemented*/
+    bool operator!=(const MixtureEMTrainer&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_MixtureEMTrainer_h)
@@ -73,6 +73,8 @@ namespace alize
   class MixtureStat; // TODO : garder ici ?
   class Config;
   class StatServer;
+  class MixtureGDCompiled;
+  class MixtureGDSelector;
 
   /// Class for a mixture of gaussian distributions with diagonal vector
   /// of covariance (DistribGD objects).
@@ -158,12 +160,85 @@ namespace alize
 
     virtual DistribType getType() const;
 
+    /// Checksum of the weights, means and inverse covariances
+    /// @return the checksum
+    ///
+    virtual unsigned long computeChecksum() const;
+
+    /// Builds or updates the packed copy and the gaussian selection index.
+    /// Records the current Distrib::getGlobalVersion() so that the checks
+    /// done by the scoring threads only read.
+    ///
+    virtual void prepare() const;
+
+    /// Like prepare(), also prepares what the determination of the top
+    /// distributions needs with the params gaussianSelection (see
+    /// getSelector()) and topDistribsPruning (see
+    /// MixtureGDCompiled::prepareSearch()). To call before the threads
+    /// which determine the top distributions of the mixture.
+    /// @param c the config
+    ///
+    void prepareTopDistribs(const Config& c) const;
+
+    /// Returns a packed copy of the parameters of the mixture used for
+    /// fast likelihood computation. The copy is created the first time
+    /// and updated when the parameters have been modified.
+    /// @return the packed copy
+    ///
+    const MixtureGDCompiled& getCompiled() const;
+
+    /// Returns the gaussian selection index of the mixture, built again
+    /// if the parameters have been modified since it was built or loaded.
+    /// The index requested by setSelectorFile() is loaded or built by the
+    /// first call, which must not be made by several threads at once.
+    /// @return a pointer to the index or NULL if the mixture has no index
+    ///
+    const MixtureGDSelector* getSelector() const;
+
+    /// Requests a gaussian selection index without building it. The
+    /// first getSelector() reads it from the file or, if the file does not
+    /// match the mixture, builds it and saves it in the file.
+    /// @param f the file name
+    /// @param clusterCount number of clusters. 0 means the square root of
+    ///     the number of distributions or the count of the file
+    ///
+    void setSelectorFile(const FileName& f, unsigned long clusterCount) const;
+
+    /// Builds a gaussian selection index for the mixture (replaces the
+    /// current one)
+    /// @param clusterCount number of clusters. 0 means the square root of
+    ///     the number of distributions
+    /// @return the index
+    ///
+    const MixtureGDSelector& createSelector(
+                               unsigned long clusterCount = 0) const;
+
+    /// Reads the gaussian selection index of the mixture from a file
+    /// written by MixtureGDSelector::save()
+    /// @param f the file name
+    /// @return false if the file does not exist or has been saved from a
+    ///     mixture with other parameters. The current index is kept.
+    /// @exception IOException if the file cannot be read
+    ///
+    bool loadSelector(const FileName& f) const;
+
+    /// Deletes the gaussian selection index of the mixture
+    ///
+    void deleteSelector() const;
+
     virtual String getClassName() const;
     virtual String toString() const;
         
 
   private :
 
+    mutable MixtureGDCompiled* _pCompiled;
+    mutable MixtureGDSelector* _pSelector;
+    // index requested by setSelectorFile() and not read yet
+    mutable bool          _selectorPending;
+    mutable FileName      _selectorFileName;
+    mutable unsigned long _selectorClusterCount;
+
     virtual Mixture& clone(DuplDistrib) const;
     virtual MixtureStat& createNewMixtureStatObject(
                      const K&, StatServer&, const Config&) const;
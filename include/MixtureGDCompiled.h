@@ -0,0 +1,407 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_MixtureGDCompiled_h)
+#define ALIZE_MixtureGDCompiled_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "ULongVector.h"
+#include "RealVector.h"
+
+namespace alize
+{
+  class Feature;
+  class FeatureView;
+  class FrameBlock;
+  class LKVector;
+  class MixtureGD;
+
+  /// Read-only packed copy of the parameters of a MixtureGD, used to
+  /// compute likelihoods without virtual calls and without following
+  /// a pointer per distribution.\n
+  /// Means and inverse covariances are stored in two matrices (one row per
+  /// distribution, each row aligned on a cache line). Weights, constantes
+  /// and their logarithms are stored in arrays.\n
+  /// The object keeps the version counters of the mixture and of its
+  /// distributions (see Mixture::getVersion() and Distrib::getVersion())
+  /// so that update() copies the parameters again only when they have
+  /// been modified.\n
+  /// Do not create this object yourself, use MixtureGD::getCompiled().
+  ///
+  /// @version 1.0
+
+  class ALIZE_API MixtureGDCompiled : public Object
+  {
+
+  public :
+
+    /// Creates a packed copy of a mixture
+    /// @param m the mixture
+    ///
+    explicit MixtureGDCompiled(const MixtureGD& m);
+    virtual ~MixtureGDCompiled();
+
+    /// Tests whether the packed copy matches the current parameters of
+    /// a mixture. Only reads : the distributions are checked one by one
+    /// when Distrib::getGlobalVersion() has changed since the last build()
+    /// or prepare().
+    /// @param m the mixture
+    /// @return true if the copy is up to date
+    ///
+    bool isUpToDate(const MixtureGD& m) const;
+
+    /// Copies the parameters of the mixture if they have been modified since
+    /// the last call
+    /// @param m the mixture
+    ///
+    void update(const MixtureGD& m);
+
+    /// Like update(), also records the current Distrib::getGlobalVersion()
+    /// when the copy is up to date so that the next isUpToDate() calls do
+    /// not check each distribution again. To call before the threads which
+    /// share the mixture are started.
+    /// @param m the mixture
+    ///
+    void prepare(const MixtureGD& m);
+
+    unsigned long getDistribCount() const;
+    unsigned long getVectSize() const;
+
+    /// Returns the length of a row of the mean and inverse covariance
+    /// matrices (vectSize rounded up to a cache line)
+    /// @return the length of a row
+    ///
+    unsigned long getStride() const;
+
+    /// Returns the matrix of means. The mean of distribution c begins at
+    /// index c*getStride()
+    /// @return a pointer to the first value
+    ///
+    const real_t* getMeanArray() const;
+
+    /// Returns the matrix of inverse covariances. The inverse covariance
+    /// of distribution c begins at index c*getStride()
+    /// @return a pointer to the first value
+    ///
+    const real_t* getCovInvArray() const;
+
+    const real_t* getWeightArray() const;
+    const real_t* getCstArray() const;
+
+    /// Returns the logarithms of the weights. A null weight gives a very
+    /// large negative value
+    /// @return a pointer to the first value
+    ///
+    const real_t* getLogWeightArray() const;
+    const real_t* getLogCstArray() const;
+
+    /// Returns the sums of the logarithms of the weights and of the
+    /// constantes, the part of the weighted log-likelihood which does not
+    /// depend on the feature
+    /// @return a pointer to the first value
+    ///
+    const real_t* getLogWeightCstArray() const;
+
+    /// Returns the order in which the dimensions are added by
+    /// searchTopDistribs() : by decreasing sum of the inverse covariances,
+    /// so that the dimensions with the smallest variances come first.
+    /// Calls prepareSearch().
+    /// @return the indices of the dimensions
+    ///
+    const ULongVector& getDimOrderVect() const;
+
+    /// Computes the likelihood between a distribution and a feature.
+    /// Gives exactly the same result as DistribGD::computeLK()
+    /// @param f the feature
+    /// @param c index of the distribution
+    /// @return the likelihood
+    /// @exception Exception if the feature vectSize does not match the
+    ///      mixture vectSize
+    ///
+    lk_t computeLK(const Feature& f, unsigned long c) const;
+
+    /// Computes the sum of the weighted likelihoods of all the
+    /// distributions
+    /// @param f the feature
+    /// @return the likelihood of the mixture
+    /// @exception Exception if the feature vectSize does not match the
+    ///      mixture vectSize
+    ///
+    lk_t computeWeightedLKSum(const Feature& f) const;
+
+    /// Computes the sum of the weighted likelihoods of all the
+    /// distributions for each frame of a block. The block is processed by
+    /// groups of distributions small enough to stay in the processor cache.
+    /// Gives exactly the same results as computeWeightedLKSum(const
+    /// Feature&) called on each frame.
+    /// @param b the block of frames
+    /// @param lk array of b.getFrameCount() values to store the results
+    /// @exception Exception if the block vectSize does not match the
+    ///      mixture vectSize
+    ///
+    void computeWeightedLKSum(const FrameBlock& b, lk_t* lk) const;
+
+    /// Like computeWeightedLKSum(const Feature&) for a frame read without
+    /// copy. The single precision values are converted by the kernel
+    /// (see DistribKernel) : gives exactly the same result as the frame
+    /// copied into a Feature.
+    /// @param f the view
+    /// @return the likelihood of the mixture
+    /// @exception Exception if the view vectSize does not match the
+    ///      mixture vectSize
+    ///
+    lk_t computeWeightedLKSum(const FeatureView& f) const;
+
+    /// Computes the weighted likelihoods of all the distributions for a
+    /// feature : getWeightArray()[c]*computeLK(f, c) is stored in lk[c].
+    /// Uses the same code as computeWeightedLK(const FrameBlock&...), so
+    /// the per-frame and the batch callers get the same values whatever
+    /// the optimizations of the compiler.
+    /// @param f the feature
+    /// @param lk array of getDistribCount() values
+    /// @exception Exception if the feature vectSize does not match the
+    ///      mixture vectSize
+    ///
+    void computeWeightedLK(const Feature& f, lk_t* lk) const;
+
+    /// Computes the weighted likelihoods of all the distributions for some
+    /// frames of a block. The likelihood of distribution c for frame
+    /// first+t is stored in lk[t*getDistribCount()+c] and is
+    /// getWeightArray()[c]*computeLK(frame, c).
+    /// @param b the block of frames
+    /// @param first index of the first frame
+    /// @param count number of frames
+    /// @param lk array of count*getDistribCount() values
+    /// @exception Exception if the block vectSize does not match the
+    ///      mixture vectSize
+    ///
+    void computeWeightedLK(const FrameBlock& b, unsigned long first,
+                           unsigned long count, lk_t* lk) const;
+
+    /// Computes the log-likelihood between a distribution and a feature in
+    /// the log domain (log-constant minus half the weighted distance).
+    /// Does not underflow, even with many dimensions. A NaN gives
+    /// log(EPS_LK) like computeLK() gives EPS_LK.
+    /// @param f the feature
+    /// @param c index of the distribution
+    /// @return the log-likelihood
+    /// @exception Exception if the feature vectSize does not match the
+    ///      mixture vectSize
+    ///
+    lk_t computeLogLK(const Feature& f, unsigned long c) const;
+
+    /// Computes the logarithm of the sum of the weighted likelihoods of all
+    /// the distributions with a log-sum-exp shifted by the largest term
+    /// (see DistribKernel::computeLogSumExp()). Uses a buffer of the object :
+    /// several threads must call the other version.
+    /// @param f the feature
+    /// @return the log-likelihood of the mixture
+    /// @exception Exception if the feature vectSize does not match the
+    ///      mixture vectSize
+    ///
+    lk_t computeWeightedLogLKSum(const Feature& f) const;
+
+    /// Like computeWeightedLogLKSum(const Feature&) with a buffer given by
+    /// the caller. Does not modify the object.
+    /// @param f the feature
+    /// @param tmp buffer, resized to getDistribCount()
+    /// @return the log-likelihood of the mixture
+    /// @exception Exception if the feature vectSize does not match the
+    ///      mixture vectSize
+    ///
+    lk_t computeWeightedLogLKSum(const Feature& f, DoubleVector& tmp) const;
+
+    /// Like computeWeightedLogLKSum(const Feature&, DoubleVector&) for a
+    /// frame read without copy
+    /// @param f the view
+    /// @param tmp buffer, resized to getDistribCount()
+    /// @return the log-likelihood of the mixture
+    /// @exception Exception if the view vectSize does not match the
+    ///      mixture vectSize
+    ///
+    lk_t computeWeightedLogLKSum(const FeatureView& f,
+                                 DoubleVector& tmp) const;
+
+    /// Like computeWeightedLogLKSum(const Feature&) for each frame of a
+    /// block
+    /// @param b the block of frames
+    /// @param llk array of b.getFrameCount() values to store the results
+    /// @exception Exception if the block vectSize does not match the
+    ///      mixture vectSize
+    ///
+    void computeWeightedLogLKSum(const FrameBlock& b, lk_t* llk) const;
+
+    /// Like computeWeightedLK(const Feature&, lk_t*) in the log domain :
+    /// stores getLogWeightArray()[c]+computeLogLK(f, c) in logLK[c]
+    /// @param f the feature
+    /// @param logLK array of getDistribCount() values
+    /// @exception Exception if the feature vectSize does not match the
+    ///      mixture vectSize
+    ///
+    void computeWeightedLogLK(const Feature& f, lk_t* logLK) const;
+
+    /// Like computeWeightedLK() in the log domain : stores
+    /// getLogWeightArray()[c]+computeLogLK(frame, c) in
+    /// logLK[t*getDistribCount()+c]
+    /// @param b the block of frames
+    /// @param first index of the first frame
+    /// @param count number of frames
+    /// @param logLK array of count*getDistribCount() values
+    /// @exception Exception if the block vectSize does not match the
+    ///      mixture vectSize
+    ///
+    void computeWeightedLogLK(const FrameBlock& b, unsigned long first,
+                              unsigned long count, lk_t* logLK) const;
+
+    /// Searches the n distributions with the highest weighted
+    /// log-likelihoods for a feature. The weighted distance of a
+    /// distribution is added by groups of dimensions (see getDimOrderVect())
+    /// and the distribution is rejected as soon as getLogWeightCstArray()[c]
+    /// minus half the partial distance is lower than the n-th best
+    /// log-likelihood of a few promising distributions. Gives the same
+    /// distributions as a complete computation ; the log-likelihoods differ
+    /// from computeLogLK() only by rounding.
+    /// @param f the feature
+    /// @param n number of distributions to find
+    /// @param topVect receives min(n, getDistribCount()) distributions
+    ///      sorted by decreasing weighted log-likelihood (index and value)
+    /// @param tmp buffer, resized to getVectSize()
+    /// @return the number of distributions whose distance has been
+    ///      computed on all the dimensions
+    /// @exception Exception if the feature vectSize does not match the
+    ///      mixture vectSize
+    ///
+    unsigned long searchTopDistribs(const Feature& f, unsigned long n,
+                          LKVector& topVect, DoubleVector& tmp) const;
+
+    /// Copies the parameters in the order of getDimOrderVect() for
+    /// searchTopDistribs(). Done by the first search : call it before the
+    /// copy is shared by several threads. The copies which never search
+    /// do not keep this second layout.
+    ///
+    void prepareSearch() const;
+
+    /// Returns the number of frames that the callers of
+    /// computeWeightedLK() and computeWeightedLogLK() should process in one
+    /// call. Keeps the matrix
+    /// of results small.
+    /// @return the number of frames
+    ///
+    static unsigned long getFrameBlockSize();
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    unsigned long _distribCount;
+    unsigned long _vectSize;
+    unsigned long _stride;
+    real_t*       _meanArray;
+    real_t*       _covInvArray;
+    real_t*       _weightArray;
+    real_t*       _cstArray;
+    real_t*       _logWeightArray;
+    real_t*       _logCstArray;
+    real_t*       _logWeightCstArray;
+    // dimensions in the order of _dimOrderVect, by segments. Allocated
+    // by prepareSearch() only, then updated by build().
+    mutable real_t*     _sortedMeanArray;
+    mutable real_t*     _sortedCovInvArray;
+    mutable ULongVector _dimOrderVect;
+
+    unsigned long _mixtureVersion;
+    unsigned long _globalVersion;
+    ULongVector   _distribVersionVect;
+    mutable DoubleVector _tmpVect;
+
+    void build(const MixtureGD& m);
+    void sortDims() const;
+    void freeArrays();
+    unsigned long getDistribBlockSize() const;
+    lk_t computeLKFromDist(real_t dist, unsigned long c) const;
+    lk_t computeLogLKFromDist(real_t dist, unsigned long c) const;
+    lk_t computeLK(const real_t* data, unsigned long c) const;
+    lk_t computeLK(const float* data, unsigned long c) const;
+    lk_t computeLogLK(const real_t* data, unsigned long c) const;
+    lk_t computeLogLK(const float* data, unsigned long c) const;
+    void computeWeightedLK(const real_t* data, unsigned long c0,
+                           unsigned long c1, lk_t* lk) const;
+    void computeWeightedLogLK(const real_t* data, unsigned long c0,
+                              unsigned long c1, lk_t* logLK) const;
+    void computeWeightedLogLK(const float* data, unsigned long c0,
+                              unsigned long c1, lk_t* logLK) const;
+    lk_t computeSortedLogLK(const real_t* x, unsigned long c) const;
+    void assertVectSize(unsigned long vectSize) const;
+
+    MixtureGDCompiled(const MixtureGDCompiled&); /*!Not implemented*/
+    const MixtureGDCompiled& operator=(
+                const MixtureGDCompiled&); /*!Not implemented*/
+    bool operator==(const MixtureGDCompiled&) const; /*!Not implemented*/
+    bool operator!=(const MixtureGDCompiled&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_MixtureGDCompiled_h)
@@ -0,0 +1,230 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_MixtureGDSelector_h)
+#define ALIZE_MixtureGDSelector_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "ULongVector.h"
+#include "LKVector.h"
+
+namespace alize
+{
+  class Feature;
+  class MixtureGD;
+
+  /// Gaussian selection index of a MixtureGD, used to find the top
+  /// distributions of a frame without computing the likelihoods of all
+  /// the distributions.\n
+  /// The distributions are grouped in clusters (k-means with the
+  /// Kullback-Leibler divergence between gaussians). Each cluster is
+  /// represented by one gaussian that merges the gaussians of its members.
+  /// For a frame, the likelihoods of the cluster gaussians are computed
+  /// first and only the members of the best clusters are candidates. The
+  /// more clusters are searched, the more likely the true top
+  /// distributions are found and the slower the search.\n
+  /// The object keeps the version counters of the mixture (like
+  /// MixtureGDCompiled) to detect that it must be built again.\n
+  /// Do not create this object yourself, use MixtureGD::createSelector()
+  /// or MixtureGD::loadSelector().
+  ///
+  /// @version 1.0
+
+  class ALIZE_API MixtureGDSelector : public Object
+  {
+
+  public :
+
+    /// Groups the distributions of a mixture in clusters
+    /// @param m the mixture
+    /// @param clusterCount number of clusters. 0 means the square root of
+    ///     the number of distributions
+    ///
+    explicit MixtureGDSelector(const MixtureGD& m,
+                               unsigned long clusterCount = 0);
+    virtual ~MixtureGDSelector();
+
+    /// Tests whether the index has been built from the current parameters
+    /// of a mixture. Only reads (see MixtureGDCompiled::isUpToDate()).
+    /// @param m the mixture
+    /// @return true if the index is up to date
+    ///
+    bool isUpToDate(const MixtureGD& m) const;
+
+    /// Builds the index again if the mixture has been modified, else
+    /// records the current Distrib::getGlobalVersion() (see
+    /// MixtureGDCompiled::prepare())
+    /// @param m the mixture
+    ///
+    void prepare(const MixtureGD& m);
+
+    /// Groups the distributions of a mixture again with the same number of
+    /// clusters
+    /// @param m the mixture
+    ///
+    void build(const MixtureGD& m);
+
+    unsigned long getDistribCount() const;
+    unsigned long getClusterCount() const;
+
+    /// Returns the number of clusters searched by selectDistribs() when
+    /// 0 is given : a quarter of the clusters
+    /// @return the number of clusters
+    ///
+    unsigned long getDefaultSearchedClusterCount() const;
+
+    /// Returns the index of the cluster of a distribution
+    /// @param c index of the distribution
+    /// @return the index of the cluster
+    /// @exception IndexOutOfBoundsException
+    ///
+    unsigned long getCluster(unsigned long c) const;
+
+    /// Finds the distributions that are candidates to be top distributions
+    /// of a frame : the members of the n clusters whose gaussians give the
+    /// best likelihoods
+    /// @param f the feature
+    /// @param n number of clusters to search (0 for
+    ///     getDefaultSearchedClusterCount())
+    /// @return the indices of the candidate distributions. The vector is
+    ///     modified by the next call
+    /// @exception Exception if the feature vectSize does not match the
+    ///      mixture vectSize
+    ///
+    const ULongVector& selectDistribs(const Feature& f,
+                                      unsigned long n = 0) const;
+
+    /// Like selectDistribs(const Feature&, unsigned long) with buffers
+    /// given by the caller. Does not modify the object : several threads
+    /// can call it at the same time.
+    /// @param f the feature
+    /// @param clusterLKVect buffer, resized to getClusterCount()
+    /// @param selectedVect receives the indices of the candidate
+    ///     distributions
+    /// @param n number of clusters to search (0 for
+    ///     getDefaultSearchedClusterCount())
+    /// @exception Exception if the feature vectSize does not match the
+    ///      mixture vectSize
+    ///
+    void selectDistribs(const Feature& f, LKVector& clusterLKVect,
+                        ULongVector& selectedVect, unsigned long n = 0) const;
+
+    /// Saves the clusters in a binary file. The file is only valid for the
+    /// parameters of the mixture the index has been built from.
+    /// @param f the file name
+    /// @exception IOException if an I/O error occurs
+    ///
+    void save(const FileName& f) const;
+
+    /// Reads the clusters from a file written by save()
+    /// @param f the file name
+    /// @param m the mixture
+    /// @return false if the file does not exist or has been saved from a
+    ///     mixture with other parameters. The index is not modified.
+    /// @exception IOException if the file cannot be read
+    ///
+    bool load(const FileName& f, const MixtureGD& m);
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    unsigned long _distribCount;
+    unsigned long _vectSize;
+    unsigned long _clusterCount;
+    unsigned long _stride;
+    real_t*       _meanArray;   // cluster gaussians
+    real_t*       _covInvArray;
+    real_t*       _logCstArray; // with the log of the cluster weight
+    ULongVector   _clusterVect; // cluster of each distribution
+    ULongVector   _memberVect;  // distributions sorted by cluster
+    ULongVector   _firstMemberVect;
+    unsigned long _checksum;
+
+    unsigned long _mixtureVersion;
+    unsigned long _globalVersion;
+    ULongVector   _distribVersionVect;
+
+    mutable LKVector    _clusterLKVect;
+    mutable ULongVector _selectedVect;
+
+    void cluster(const MixtureGD& m);
+    void computeClusterGaussians(const MixtureGD& m);
+    void sortMembers();
+    void setVersions(const MixtureGD& m);
+    void allocArrays();
+    void freeArrays();
+
+    MixtureGDSelector(const MixtureGDSelector&); /*!Not implemented*/
+    const MixtureGDSelector& operator=(
+                const MixtureGDSelector&); /*!Not implemented*/
+    bool operator==(const MixtureGDSelector&) const; /*!Not implemented*/
+    bool operator!=(const MixtureGDSelector&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_MixtureGDSelector_h)
@@ -92,6 +92,9 @@ namespace alize
 
     virtual void resetEM();
 
+    /// If the config sets emOccThreshold or emTopDistribsCount, only the
+    /// distributions kept for the frame are accumulated (the
+    /// occupations of the others are set to 0)
     /// @return sum of occupations BEFORE normalization
     virtual occ_t computeAndAccumulateEM(const Feature&, double w = 1.0);
 
@@ -99,19 +102,38 @@ namespace alize
 
     virtual const Mixture& getEM();
 
-    /// Returns the internal mixture used to accumulate data for EM
-    /// @return the internal mixture used to accumulate data for EM
+    /// Returns a mixture with the data accumulated for EM : the means
+    /// and the covs of the distributions are the sums of the weighted
+    /// frames and squared frames. The mixture is a copy, updated by each
+    /// call.
+    /// @return the mixture
     /// @exception Exception if resetEM() have not been called beforehand
     ///
     MixtureGD& getInternalAccumEM(); /* NOT VIRTUAL */
 
+    /// Returns the sums of the weighted frames accumulated for EM : one
+    /// row of vectSize values per distribution
+    /// @return the sums (distribCount x vectSize values)
+    /// @exception Exception if resetEM() have not been called beforehand
+    ///
+    const DoubleVector& getAccumulatedMeanVect() const;
+
+    /// Returns the sums of the weighted squared frames accumulated for EM,
+    /// with the same layout as getAccumulatedMeanVect()
+    /// @return the sums (distribCount x vectSize values)
+    /// @exception Exception if resetEM() have not been called beforehand
+    ///
+    const DoubleVector& getAccumulatedCovVect() const;
+
     virtual String getClassName() const;
   
   
   private :
 
-    MixtureGD* _pMixForAccumulation;
-    MixtureGD* _pMixtureForEM;
+    MixtureGD*   _pMixForAccumulation; // see getInternalAccumEM()
+    MixtureGD*   _pMixtureForEM;
+    DoubleVector _accMeanVect; // distribCount x vectSize
+    DoubleVector _accCovVect;  // distribCount x vectSize
 
     MixtureGDStat(const MixtureGDStat&); /*!Not implemented*/
     const MixtureGDStat& operator=(
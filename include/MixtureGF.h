@@ -157,6 +157,15 @@ namespace alize
 
     virtual DistribType getType() const;
 
+    /// Checksum of the weights, means and inverse covariance matrices
+    /// @return the checksum
+    ///
+    virtual unsigned long computeChecksum() const;
+
+    /// Computes the Cholesky factors of the distributions
+    ///
+    virtual void prepare() const;
+
     virtual String getClassName() const;
     virtual String toString() const;
         
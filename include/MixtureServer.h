@@ -77,6 +77,7 @@
 namespace alize
 {
   class XLine;
+  class DistribDictCompiled;
 
   /// Class used to store and manage Mixture and Distrib objects.
   /// This class is responsible for creating and deleting these objects.
@@ -375,7 +376,13 @@ namespace alize
 
     //-------------------------------------------------------------------
 
-    /// Creates a new mixture in the server and loads data from a file
+    /// Creates a new mixture in the server and loads data from a file.
+
+    /// If the parameter gaussianSelection is true, the gaussian selection
+    /// index of a GD mixture is read from the file f plus
+    /// gaussianSelectionFileExtension in the same directory. The index is
+    /// built and saved in this file if the file does not exist or does not
+    /// match the mixture.
     /// @param f the mixture file to read
     /// @return a reference to the mixture
     /// @exception IOException if an I/O error occurs
@@ -402,7 +409,8 @@ namespace alize
     ///
     MixtureGF& loadMixtureGF(const FileName& f);
 
-    /// Loads data from a mixture file into an existing mixture
+    /// Loads data from a mixture file into an existing mixture (and its
+    /// gaussian selection index, see loadMixture(const FileName&))
     /// @param f the file to read
     /// @exception IOException if an I/O error occurs
     /// @exception FileNotFoundException
@@ -438,6 +446,21 @@ namespace alize
     ///
     unsigned long getMixtureCount() const;
 
+    /// Calls Mixture::prepare() for each mixture of the server and updates
+    /// the packed copy of the distributions if it has been created. Must be
+    /// called before sharing the server between several threads.
+    ///
+    void prepareMixtures() const;
+
+    /// Returns a packed copy of all the distributions of the server used
+    /// to compute their likelihoods at once (see
+    /// StatServer::computeAllDistribLK()). The copy is created the first
+    /// time and updated when distributions have been added, removed or
+    /// modified.
+    /// @return the packed copy
+    ///
+    const DistribDictCompiled& getCompiledDistribs() const;
+
     /// Tests whether a mixture with a particular identifier exists inside
     /// the server
     /// @param id identifier to find
@@ -488,12 +511,14 @@ namespace alize
     unsigned long     _lastMixtureId;
     mutable unsigned long _vectSize;
     mutable bool      _vectSizeDefined;
+    mutable DistribDictCompiled* _pCompiledDistribs;
 
     void addDistribToDict(Distrib&);
     void addMixtureToDict(Mixture&);
     String newId();
     Mixture& loadMixture(const FileName& f, DistribType);
     void autoSetMixtureId(Mixture& m, String id);
+    void loadSelector(const Mixture& m, const FileName& f);
 
 
     ///
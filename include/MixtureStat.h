@@ -68,12 +68,17 @@
 #include "Object.h"
 #include "StatServer.h"
 #include "RealVector.h"
+#include "ULongVector.h"
 
 namespace alize
 {
   class Config;
   class Feature;
+  class FeatureInputStream;
+  class FeatureView;
+  class FrameBlock;
   class LKVector;
+  class ThreadPool;
 
   /// Abstract class used to make calculation in a Mixture object
   /// and to store and accumulate results
@@ -119,6 +124,15 @@ namespace alize
     ///
     lk_t computeLLK(const Feature& f, unsigned long idx);
 
+    /// Computes log-likelihoods between the mixture and all the frames of
+    /// a block (see StatServer::computeLLKBatch()). getLLK() then returns
+    /// the log-likelihood of the last frame.
+    /// @param b the block of frames
+    /// @param llk array of b.getFrameCount() values to store the
+    ///     log-likelihoods
+    ///
+    void computeLLKBatch(const FrameBlock& b, lk_t* llk);
+
     /// Returns the last log-likelihood computation stored for the mixture
     /// @return the log-likelihood computed between the mixture and the
     ///     last feature
@@ -145,6 +159,17 @@ namespace alize
     lk_t computeAndAccumulateLLK(const Feature& f, double w = 1.0f,
                 const TopDistribsAction& a = TOP_DISTRIBS_NO_ACTION);
 
+    /// Like computeAndAccumulateLLK(const Feature&, double,
+    /// TOP_DISTRIBS_NO_ACTION) for a frame read without copy (see
+    /// StatServer::computeLLK(const Mixture&, const FeatureView&))
+    /// @param f the view
+    /// @param w the weight of the feature
+    /// @return the log-likelihood for this feature (not multiplied by w)
+    /// @exception Exception if the dimension of the mixture is not
+    ///      equals to the dimension of the feature
+    ///
+    lk_t computeAndAccumulateLLK(const FeatureView& f, double w = 1.0);
+
     // LIUM, Sylvain
 	/// Like computeLLK() and, in addition, accumulate the log-likelihood.
     /// The internal feature counter increases by w.
@@ -165,6 +190,21 @@ namespace alize
     ///      stat server (the log-likelihood array is not computed)
     ///
     lk_t computeAndAccumulateLLK();
+
+    /// Like computeAndAccumulateLLK(const Feature&...) called on each frame
+    /// of a block, in the same order. The internal feature counter
+    /// increases by w for each frame.
+    /// @param b the block of frames
+    /// @param llk array of b.getFrameCount() values to store the
+    ///     log-likelihoods (not multiplied by w)
+    /// @param w the weight of each frame
+    /// @param a flag used to deal with top distributions
+    /// @exception Exception if the dimension of the mixture is not
+    ///      equals to the dimension of the frames
+    ///
+    void computeAndAccumulateLLKBatch(const FrameBlock& b, lk_t* llk,
+                double w = 1.0,
+                const TopDistribsAction& a = TOP_DISTRIBS_NO_ACTION);
     
     /// Accumulates the log-likelihood.
     /// @param llk the value to accumulate
@@ -182,6 +222,32 @@ namespace alize
     ///
     lk_t getMeanLLK() const;
 
+    /// Like computeAndAccumulateLLK(const Feature&, double,
+    /// TOP_DISTRIBS_NO_ACTION) called on some frames of a stream, with the
+    /// frames shared among the threads of a pool. The frames are read by
+    /// the calling thread and processed by chunks of
+    /// getParallelChunkSize() frames, each chunk with its own accumulator.
+    /// The chunks are then added in the order of the frames : the result
+    /// does not depend on the number of threads.
+    /// @param fs the feature stream
+    /// @param begin index of the first frame
+    /// @param count number of frames
+    /// @param pool the threads
+    /// @param w the weight of each frame
+    /// @return the sum of the log-likelihoods of the frames multiplied by w
+    /// @exception Exception if the stream ends before the last frame
+    ///
+    lk_t computeAndAccumulateLLKParallel(FeatureInputStream& fs,
+                 unsigned long begin, unsigned long count, ThreadPool& pool,
+                 double w = 1.0);
+
+    /// Returns the number of frames of a job of
+    /// computeAndAccumulateLLKParallel() and
+    /// computeAndAccumulateOccParallel()
+    /// @return the number of frames
+    ///
+    static unsigned long getParallelChunkSize();
+
     /// Returns the count of accumulated features for llk
     /// @return the count of accumulated features for llk
     ///
@@ -227,6 +293,29 @@ namespace alize
     ///
     real_t computeAndAccumulateOcc(const Feature& f, weight_t w = 1.0);
 
+    /// Like computeAndAccumulateOcc() called on each frame of a block, in
+    /// the same order. getOccVect() then returns the occupations of the
+    /// last frame.
+    /// @param b the block of frames
+    /// @param w the weight of each frame
+    ///
+    void computeAndAccumulateOccBatch(const FrameBlock& b, weight_t w = 1.0);
+
+    /// Like computeAndAccumulateOcc() called on some frames of a stream,
+    /// with the frames shared among the threads of a pool (see
+    /// computeAndAccumulateLLKParallel()). getOccVect() then returns the
+    /// occupations of the last frame.
+    /// @param fs the feature stream
+    /// @param begin index of the first frame
+    /// @param count number of frames
+    /// @param pool the threads
+    /// @param w the weight of each frame
+    /// @exception Exception if the stream ends before the last frame
+    ///
+    void computeAndAccumulateOccParallel(FeatureInputStream& fs,
+                 unsigned long begin, unsigned long count, ThreadPool& pool,
+                 weight_t w = 1.0);
+
     /// Gets a reference to the vector of mean occupations.
     /// @return a reference to the vector of mean occupations.
     /// @exception Exception if no occ accumulated
@@ -272,6 +361,9 @@ namespace alize
     const Config&       _config;
     const lk_t          _minLLK;
     const lk_t          _maxLLK;
+    const bool          _logDomain;
+    const occ_t         _emOccThreshold;
+    const unsigned long _emTopDistribsCount;
 
     lk_t                _llk;
     lk_t                _accumulatedLLK;
@@ -285,9 +377,19 @@ namespace alize
     bool                _resetedEM;
     StatServer*         _pStatServer;
     real_t              _featureCounterForEM;
+    ULongVector         _emDistribVect; // distribs kept by pruneOccVect()
+    ULongVector         _emSortVect;
 
     real_t computeOccVect(const Feature&);
+    real_t normalizeOccVect(occ_t sum);
+    real_t normalizeLKOccVect();
+    real_t normalizeLogOccVect();
+    bool isEMPruned() const;
+    real_t computeAndAccumulateOccForEM(const Feature&, weight_t w);
+    void pruneOccVect();
     void assertResetEMDone() const;
+    lk_t accumulateParallel(FeatureInputStream&, unsigned long,
+                            unsigned long, ThreadPool&, double, bool);
 
   private:
     bool operator==(const MixtureStat&) const;/*!Not implemented*/
@@ -265,6 +265,30 @@ namespace alize
 
     static unsigned long max(unsigned long, unsigned long);
 
+    /// Adds the bytes of an array to a checksum (32 bits FNV-1a hash).
+    /// Used to detect that a file has been saved from other data.
+    /// @param p the array
+    /// @param size size of the array in bytes
+    /// @param h checksum of the previous arrays (initial value by default)
+    /// @return the new checksum
+    ///
+    static unsigned long updateChecksum(const void* p, unsigned long size,
+                                        unsigned long h = 2166136261UL);
+
+    /// Increments a counter shared by several objects. The increment is
+    /// atomic when the library is compiled with THREAD defined.
+    /// @param v the counter
+    /// @return the new value of the counter
+    ///
+    static unsigned long incrementCounter(unsigned long& v);
+
+    /// Like incrementCounter() but adds any value
+    /// @param v the counter
+    /// @param n the value to add
+    /// @return the new value of the counter
+    ///
+    static unsigned long addToCounter(unsigned long& v, unsigned long n);
+
 #if !defined NDEBUG
   public:
     /// @return the value of the created objects counter
@@ -369,6 +393,7 @@ namespace alize
     friend class FeatureFileReaderSingle;
     friend class FeatureInputStreamModifier;
     friend class FeatureServer;
+    friend class FeatureView;
 
   private :
     K(){}; /*! private constructor */
@@ -0,0 +1,154 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_ScoreCache_h)
+#define ALIZE_ScoreCache_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "alizeString.h"
+using alize::String; // before #include <map>
+#include <map>
+
+namespace alize
+{
+  /// Scores of (model, segment) pairs, kept to avoid scoring the same
+  /// pairs again, for example the cohort scores used by score
+  /// normalization (see ScoreNormalizer).\n
+  /// The scores are saved in a binary file with the checksum of the world
+  /// model used to compute them : load() refuses a file saved for another
+  /// world model.
+  ///
+  /// @version 1.0
+
+  class ALIZE_API ScoreCache : public Object
+  {
+
+  public :
+
+    /// Creates an empty cache
+    /// @param worldChecksum checksum of the world model (see
+    ///     Mixture::computeChecksum())
+    ///
+    explicit ScoreCache(unsigned long worldChecksum = 0);
+    virtual ~ScoreCache();
+
+    /// Removes all the scores and sets the checksum
+    /// @param worldChecksum checksum of the world model
+    ///
+    void reset(unsigned long worldChecksum);
+
+    /// Sets the score of a pair
+    /// @param model identifier of the model
+    /// @param segment name of the segment
+    /// @param score the score
+    ///
+    void setScore(const String& model, const String& segment, real_t score);
+
+    /// Searches the score of a pair
+    /// @param model identifier of the model
+    /// @param segment name of the segment
+    /// @param score on return, the score if found
+    /// @return true if the score is in the cache
+    ///
+    bool getScore(const String& model, const String& segment,
+                  real_t& score) const;
+
+    unsigned long getScoreCount() const;
+    unsigned long getWorldChecksum() const;
+
+    /// Saves the cache in a binary file
+    /// @param f the file name
+    /// @exception IOException if an I/O error occurs
+    ///
+    void save(const FileName& f) const;
+
+    /// Reads a file written by save() and adds its scores to the cache
+    /// @param f the file name
+    /// @return false if the file does not exist or has been saved for
+    ///     another world model. The cache is not modified.
+    /// @exception IOException if the file cannot be read
+    ///
+    bool load(const FileName& f);
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    typedef std::pair<String, String> key_t;
+    typedef std::map<key_t, real_t> map_t;
+
+    unsigned long _worldChecksum;
+    map_t         _map;
+
+    ScoreCache(const ScoreCache&); /*!Not implemented*/
+    const ScoreCache& operator=(const ScoreCache&); /*!Not implemented*/
+    bool operator==(const ScoreCache&) const; /*!Not implemented*/
+    bool operator!=(const ScoreCache&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_ScoreCache_h)
@@ -0,0 +1,199 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_ScoreNormalizer_h)
+#define ALIZE_ScoreNormalizer_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "alizeString.h"
+#include "XLine.h"
+using alize::String; // before #include <map>
+#include <map>
+
+namespace alize
+{
+  class Config;
+  class Mixture;
+  class MixtureServer;
+  class ScoreCache;
+  class ThreadPool;
+
+  enum ScoreNorm
+  {
+    ScoreNorm_Z,  // (s - mean(model)) / dev(model) on the Z-norm segments
+    ScoreNorm_T,  // (s - mean(segment)) / dev(segment) on the T-norm models
+    ScoreNorm_ZT  // Z-norm, then T-norm with Z-normed cohort scores
+  };
+
+  /// Normalizes scores with Z-norm, T-norm or ZT-norm.\n
+  /// The cohort scores (targets against the Z-norm impostor segments, T-norm
+  /// impostor models against the test segments) are computed in batch with
+  /// a TrialScorer, so the top distributions of the world model are
+  /// computed once per segment for all the models. They are kept in a
+  /// ScoreCache : only the pairs not yet in the cache are scored, and the
+  /// cache can be saved to re-run a campaign with new targets or new test
+  /// segments.\n
+  /// Usage : setZNormSegments(), setTNormModels(), prepare() with all the
+  /// models and segments of the trials, then normalize() for each trial.
+  ///
+  /// @version 1.0
+
+  class ALIZE_API ScoreNormalizer : public Object
+  {
+
+  public :
+
+    /// Creates a normalizer
+    /// @param c the config. The normalizer stores a reference to it.
+    /// @param ms the mixture server used to find and load the models.
+    ///     The normalizer stores a reference to it.
+    /// @param world the world model. The normalizer stores a reference to
+    ///     it.
+    /// @param pool the threads. The normalizer stores a reference to it.
+    /// @param cache the cohort scores. The normalizer stores a reference to
+    ///     it. It is reset if its world checksum is not the checksum of
+    ///     the world model.
+    ///
+    explicit ScoreNormalizer(const Config& c, MixtureServer& ms,
+                             const Mixture& world, ThreadPool& pool,
+                             ScoreCache& cache);
+    virtual ~ScoreNormalizer();
+
+    /// Sets the impostor segments used by Z-norm
+    /// @param l the names of the feature files
+    ///
+    void setZNormSegments(const XLine& l);
+
+    /// Sets the impostor models used by T-norm
+    /// @param l the identifiers of the models
+    ///
+    void setTNormModels(const XLine& l);
+
+    /// Computes the scores of the pairs of a set of models and a set of
+    /// segments that are not in the cache, and adds them to the cache
+    /// @param models the identifiers of the models
+    /// @param segments the names of the feature files
+    /// @return the number of scores computed
+    ///
+    unsigned long computeScores(const XLine& models, const XLine& segments);
+
+    /// Computes the normalization parameters of models and segments
+    /// @param models the identifiers of the target models (for Z-norm
+    ///     and ZT-norm)
+    /// @param segments the names of the test segments (for T-norm and
+    ///     ZT-norm)
+    /// @param n the normalization
+    /// @exception Exception if the impostor set needed by n is empty
+    ///
+    void prepare(const XLine& models, const XLine& segments, ScoreNorm n);
+
+    /// Normalizes a score. If a standard deviation is 0, only the mean is
+    /// subtracted.
+    /// @param score the raw score of the trial
+    /// @param model identifier of the model
+    /// @param segment name of the test segment
+    /// @param n the normalization
+    /// @return the normalized score
+    /// @exception Exception if prepare() has not been called for the model
+    ///     or the segment
+    ///
+    real_t normalize(real_t score, const String& model,
+                     const String& segment, ScoreNorm n) const;
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    typedef std::pair<real_t, real_t> param_t; // mean, standard deviation
+    typedef std::map<String, param_t> map_t;
+
+    const Config&  _config;
+    MixtureServer& _ms;
+    const Mixture& _world;
+    ThreadPool&    _pool;
+    ScoreCache&    _cache;
+    XLine          _zNormSegmentLine;
+    XLine          _tNormModelLine;
+    map_t          _zNormMap; // per model
+    map_t          _tNormMap; // per segment
+    map_t          _ztNormMap; // per segment, on Z-normed cohort scores
+
+    void computeZNormParams(const XLine& models);
+    const param_t& getParam(const map_t& m, const String& id,
+                            const char* name) const;
+    real_t getCachedScore(const String& model, const String& segment) const;
+    static real_t apply(real_t score, const param_t& p);
+
+    ScoreNormalizer(const ScoreNormalizer&); /*!Not implemented*/
+    const ScoreNormalizer& operator=(
+                const ScoreNormalizer&); /*!Not implemented*/
+    bool operator==(const ScoreNormalizer&) const; /*!Not implemented*/
+    bool operator!=(const ScoreNormalizer&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_ScoreNormalizer_h)
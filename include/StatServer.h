@@ -68,6 +68,8 @@
 #include "Object.h"
 #include "alizeString.h"
 #include "LKVector.h"
+#include "ULongVector.h"
+#include "RefVector.h"
 #include "ViterbiAccum.h"
 #include "MixtureStat.h"
 
@@ -83,19 +85,29 @@
 namespace alize
 {
   class Config;
+  class FeatureInputStream;
+  class FeatureView;
+  class FrameBlock;
   class FrameAcc;
   class FrameAccGD;
   class FrameAccGF;
   class MixtureGDStat;
   class MixtureGFStat;
   class MixtureServer;
+  class ThreadPool;
   class Mixture;
   class MixtureGF;
   class MixtureGD;
   class MixtureStat;
 
   /// This class is used to compute all the statistics needed for models
-  /// training and adapting algorithms as well as for decoding algorithms.
+  /// training and adapting algorithms as well as for decoding algorithms.\n
+  /// A StatServer is not thread-safe : it holds the top distributions,
+  /// the statistic objects and the temporary buffers of its caller. To
+  /// score with several threads, give each thread its own StatServer and
+  /// FeatureServer. They can share one MixtureServer if
+  /// MixtureServer::prepareMixtures() has been called before starting the
+  /// threads and if the mixtures are not modified while they are used.
   ///
   /// @author Frederic Wils  frederic.wils@lia.univ-avignon.fr
   /// @version 1.0
@@ -143,21 +155,145 @@ namespace alize
     ///
     lk_t computeLLK(const Mixture& m, const Feature& f, unsigned long idx) const;
 
+    /// Like computeLLK(const Mixture&, const Feature&) for a frame read
+    /// without copy (see FeatureInputStream::readFeature(FeatureView&...)).
+    /// Gives exactly the same result as the frame copied into a Feature.
+    /// @param m the mixture
+    /// @param f the view
+    /// @return the log-likelihood
+    ///
+    lk_t computeLLK(const Mixture& m, const FeatureView& f) const;
+
+    /// Computes log-likelihoods between a mixture and all the frames of a
+    /// block. For a GD mixture, the parameters are loaded once for the
+    /// whole block. The results are exactly the same as
+    /// computeLLK(const Mixture&, const Feature&) called on each frame.
+    /// @param m the mixture
+    /// @param b the block of frames
+    /// @param llk array of b.getFrameCount() values to store the
+    ///     log-likelihoods
+    /// @exception Exception if the dimension of the mixture is not
+    ///      equals to the dimension of the frames
+    ///
+    void computeLLKBatch(const Mixture& m, const FrameBlock& b,
+                         lk_t* llk) const;
+
+    /// Like computeLLKBatch(const Mixture&, const FrameBlock&, lk_t*) but
+    /// deals with top distributions.\n
+    /// With DETERMINE_TOP_DISTRIBS, the top distributions of each frame are
+    /// stored in the server (see getTopDistribIndexVector(unsigned long))
+    /// and used by a next call with USE_TOP_DISTRIBS on the same block.
+    /// The results are exactly the same as the per-frame computation.
+    /// After the call, getTopDistribIndexVector() returns the top
+    /// distributions of the last frame.
+    /// @param m the mixture
+    /// @param b the block of frames
+    /// @param llk array of b.getFrameCount() values to store the
+    ///     log-likelihoods
+    /// @param a flag used to deal with top distributions
+    /// @exception Exception if the dimension of the mixture is not
+    ///      equals to the dimension of the frames
+    /// @exception Exception with USE_TOP_DISTRIBS if the top
+    ///      distributions have not been determined for all the frames
+    ///
+    void computeLLKBatch(const Mixture& m, const FrameBlock& b, lk_t* llk,
+                         const TopDistribsAction& a);
+
+    /// Scores a segment against a world model and many models in a single
+    /// pass on the features. For each frame, the top distributions of the
+    /// world are determined once (like DETERMINE_TOP_DISTRIBS) and all the
+    /// models are scored on them (like USE_TOP_DISTRIBS). The results are
+    /// the same as one pass with computeAndAccumulateLLK(world, f, w,
+    /// DETERMINE_TOP_DISTRIBS) followed by computeAndAccumulateLLK(model,
+    /// f, w, USE_TOP_DISTRIBS) for each model.
+    /// @param world the world model
+    /// @param modelVect the models
+    /// @param fs the feature stream
+    /// @param begin index of the first feature of the segment
+    /// @param count number of features of the segment
+    /// @param llkVect on return, the sum over the frames of the
+    ///     log-likelihoods of each model
+    /// @return the sum over the frames of the log-likelihoods of the world
+    ///     model
+    /// @exception Exception if a model does not have the same number of
+    ///     distributions as the world model
+    /// @exception Exception if the stream ends before the end of the
+    ///     segment
+    ///
+    lk_t computeMultiModelLLK(const Mixture& world,
+                  const RefVector<Mixture>& modelVect, FeatureInputStream& fs,
+                  unsigned long begin, unsigned long count,
+                  DoubleVector& llkVect);
+
     /// Computes the log-likelihood between ALL the distributions of the
     /// server and the feature. The results are store in an array.\n
     /// That is useful when many distributions are shared by mixtures.
     /// The log-likelihood is just computed once for each distribution.
+    /// GD distributions are computed from a packed copy (see
+    /// MixtureServer::getCompiledDistribs()).
     /// @param f the feature
     ///
     void computeAllDistribLK(const Feature& f);
 
+    /// Like computeAllDistribLK(const Feature&) with the distributions
+    /// shared between the threads of a pool. Useful when the server
+    /// contains a large pool of distributions.
+    /// @param f the feature
+    /// @param pool the threads
+    ///
+    void computeAllDistribLK(const Feature& f, ThreadPool& pool);
+
+    /// Computes the likelihoods of ALL the distributions of the server for
+    /// each frame of a block and stores them. The log-likelihoods of the
+    /// mixtures which share these distributions are then computed with
+    /// computeSharedLLKBatch().
+    /// @param b the block of frames
+    ///
+    void computeAllDistribLK(const FrameBlock& b);
+
+    /// Like computeAllDistribLK(const FrameBlock&) with the frames shared
+    /// between the threads of a pool
+    /// @param b the block of frames
+    /// @param pool the threads
+    ///
+    void computeAllDistribLK(const FrameBlock& b, ThreadPool& pool);
+
+    /// Computes the log-likelihood of a mixture for each frame of the last
+    /// block given to computeAllDistribLK(const FrameBlock&), from the
+    /// stored likelihoods of the distributions. Gives the same results as
+    /// computeAllDistribLK(const Feature&) followed by
+    /// MixtureStat::computeAndAccumulateLLK() for each frame, without
+    /// accumulation.
+    /// @param m the mixture. Its distributions must be in the server.
+    /// @param llk array of frameCount values to store the results
+    ///
+    void computeSharedLLKBatch(const Mixture& m, lk_t* llk) const;
+
     /// Returns the best distributions index vector defined after calling
-    /// computeAndAccumulateLLK(...)
+    /// computeAndAccumulateLLK(...). Only the first topDistribsCount
+    /// elements are sorted.\n
+    /// If the parameter gaussianSelection is true and the GD mixture has a
+    /// gaussian selection index (see MixtureGD::getSelector()), only the
+    /// likelihoods of the distributions selected by the index are computed
+    /// (all of them for a frame with less than topDistribsCount
+    /// candidates). Likewise with the parameter topDistribsPruning, only
+    /// the top distributions are computed. The other distributions get the
+    /// likelihood EPS_LK, which is also counted in the likelihood of the
+    /// frame and in the likelihood of the non-top distributions.
     /// @return the best distributions index vector
     /// 
     const LKVector& getTopDistribIndexVector() const;
 
-	/// Sets indexes of internal top distrib vector
+    /// Returns the best distributions index vector of a frame of the last
+    /// block given to computeLLKBatch(...) with DETERMINE_TOP_DISTRIBS
+    /// @param t index of the frame in the block
+    /// @return the best distributions index vector
+    /// 
+    const LKVector& getTopDistribIndexVector(unsigned long t) const;
+
+	/// Sets indexes of internal top distrib vector. Can be called
+    /// without any previous DETERMINE_TOP_DISTRIBS computation, e.g. with
+    /// top distributions read from a file (see TopDistribsCache)
     /// @param indexVect vector of indexes
     /// @param sumNonTopDistribWeights
     /// @param sumNonTopDistribLK
@@ -453,16 +589,37 @@ namespace alize
     String                  _serverName;
     const Config&           _config;
     DoubleVector            _distribLKVect;
+    DoubleVector            _distribLKMatrix; // one row per frame
+    unsigned long           _distribLKFrameCount;
     MixtureServer*          _pMixtureServer;
     RefVector<MixtureStat>  _mixtureStatVect;
     RefVector<ViterbiAccum> _viterbiAccumVect;
     const Mixture*          _pLastMixture;
     MixtureStat*            _pLastMixtureStat;
     LKVector                _topDistribsVect; // For top distributions management
+    RefVector<LKVector>     _topDistribsBlockVect; // one per frame of a block
     const lk_t              _minLLK;
     const lk_t              _maxLLK;
+    const bool              _logDomain;
+    const bool              _gaussianSelection;
+    const unsigned long     _searchedClusterCount;
+    const bool              _topDistribsPruning;
+    mutable DoubleVector    _tmpVect;        // buffers given to the shared
+    mutable LKVector        _clusterLKVect;  // mixtures
+    mutable ULongVector     _selectedVect;
+    mutable LKVector        _searchVect;
 
     lk_t computeLLK(lk_t lk) const;
+    lk_t computeLogLLK(lk_t llk) const;
+    void computeAllDistribLK(const Feature&, ThreadPool*);
+    void computeAllDistribLK(const FrameBlock&, ThreadPool*);
+    lk_t useTopDistribs(const Mixture&, const Feature&, LKVector&) const;
+    lk_t determineTopDistribs(const Mixture&, const Feature&,
+                              LKVector&) const;
+    lk_t determineTopDistribs(const Mixture&, const lk_t*,
+                              LKVector&) const;
+    lk_t sortTopDistribs(const Mixture&, LKVector&, lk_t) const;
+    LKVector& getTopDistribsBlockVect(unsigned long);
 
     /// @param m
     ///
@@ -0,0 +1,166 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_ThreadPool_h)
+#define ALIZE_ThreadPool_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "alizeString.h"
+
+namespace alize
+{
+  /// Work given to a ThreadPool : a number of independent jobs. Each job
+  /// must only write data that belong to the job or to the thread that
+  /// runs it.
+  ///
+  /// @version 1.0
+
+  class ALIZE_API ThreadTask
+  {
+  public :
+
+    virtual ~ThreadTask();
+
+    /// Runs one job
+    /// @param job index of the job
+    /// @param thread index of the thread, from 0 to
+    ///     ThreadPool::getThreadCount()-1. Can be used to select
+    ///     temporary objects owned by the thread.
+    ///
+    virtual void runJob(unsigned long job, unsigned long thread) = 0;
+  };
+
+  /// A set of threads created once and used to run many tasks. The jobs of
+  /// a task are distributed dynamically : a thread takes the next job as
+  /// soon as it has finished the previous one.\n
+  /// The library must be compiled with THREAD defined (configure
+  /// --enable-thread). The threads use pthreads and are not available
+  /// on Windows. Otherwise there is only one thread, the caller,
+  /// and run() simply executes the jobs in order.
+  ///
+  /// @version 1.0
+
+  class ALIZE_API ThreadPool : public Object
+  {
+
+  public :
+
+    /// Creates the threads
+    /// @param threadCount number of threads, including the thread that
+    ///     calls run(). 0 for the number of processors.
+    /// @exception Exception if a thread cannot be created
+    ///
+    explicit ThreadPool(unsigned long threadCount = 0);
+    virtual ~ThreadPool();
+
+    unsigned long getThreadCount() const;
+
+    /// Runs all the jobs of a task and returns when they are all finished.
+    /// The calling thread runs jobs too.
+    /// @param t the task
+    /// @param jobCount number of jobs
+    /// @exception Exception if a job has thrown an exception. The jobs not
+    ///     yet started are not run. The message of the first exception
+    ///     is kept.
+    ///
+    void run(ThreadTask& t, unsigned long jobCount);
+
+    /// Returns the number of processors of the computer
+    /// @return the number of processors (1 if THREAD is not defined or
+    ///     on Windows)
+    ///
+    static unsigned long getProcessorCount();
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    struct Workers;
+
+    unsigned long _threadCount;
+    Workers*      _pWorkers;
+    ThreadTask*   _pTask;
+    unsigned long _jobCount;
+    unsigned long _nextJob;
+    bool          _failed;
+    String        _errorMsg;
+    String        _errorSourceFile;
+    int           _errorLine;
+
+    bool getNextJob(unsigned long& job);
+    void runJobs(unsigned long thread);
+    void setError(const String& msg, const String& sourceFile, int line);
+    void stopThreads();
+    static void* threadMain(void* p);
+
+    ThreadPool(const ThreadPool&); /*!Not implemented*/
+    const ThreadPool& operator=(const ThreadPool&); /*!Not implemented*/
+    bool operator==(const ThreadPool&) const; /*!Not implemented*/
+    bool operator!=(const ThreadPool&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_ThreadPool_h)
@@ -0,0 +1,200 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_TopDistribsCache_h)
+#define ALIZE_TopDistribsCache_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "ULongVector.h"
+#include "RealVector.h"
+
+namespace alize
+{
+  class FeatureInputStream;
+  class LKVector;
+  class StatServer;
+
+  /// Top distributions of a world model for each frame of a feature
+  /// stream, kept to score models again without computing the likelihoods
+  /// of the world model.\n
+  /// The cache is filled after each DETERMINE_TOP_DISTRIBS computation
+  /// (see addFrame()) and saved in a binary file. The file is identified by
+  /// a checksum of the world model and a checksum of the features : load()
+  /// refuses a file saved for another model or for other features.\n
+  /// Usage on a run :\n
+  ///   if the file is loaded, for each frame t :
+  ///   cache.setTopDistribIndexVector(ss, t) then
+  ///   ss.computeAndAccumulateLLK(model, f, USE_TOP_DISTRIBS)\n
+  ///   otherwise, for each frame : ss.computeAndAccumulateLLK(world, f,
+  ///   DETERMINE_TOP_DISTRIBS) then
+  ///   cache.addFrame(ss.getTopDistribIndexVector()), and save the file
+  ///   at the end
+  ///
+  /// @version 1.0
+
+  class ALIZE_API TopDistribsCache : public Object
+  {
+
+  public :
+
+    /// Creates an empty cache
+    /// @param worldChecksum checksum of the world model (see
+    ///     Mixture::computeChecksum())
+    /// @param featureChecksum checksum of the features (see
+    ///     computeChecksum(FeatureInputStream&))
+    ///
+    explicit TopDistribsCache(unsigned long worldChecksum = 0,
+                              unsigned long featureChecksum = 0);
+    virtual ~TopDistribsCache();
+
+    /// Removes all the frames and sets the checksums
+    /// @param worldChecksum checksum of the world model
+    /// @param featureChecksum checksum of the features
+    ///
+    void reset(unsigned long worldChecksum, unsigned long featureChecksum);
+
+    /// Adds the top distributions of the next frame
+    /// @param v the top distributions of the frame (see
+    ///     StatServer::getTopDistribIndexVector())
+    /// @exception Exception if the number of top distributions is not the
+    ///     same as for the previous frames
+    ///
+    void addFrame(const LKVector& v);
+
+    unsigned long getFrameCount() const;
+    unsigned long getTopDistribsCount() const;
+    unsigned long getWorldChecksum() const;
+    unsigned long getFeatureChecksum() const;
+
+    /// Returns the index of a top distribution of a frame
+    /// @param t index of the frame
+    /// @param i rank of the distribution
+    /// @return the index of the distribution
+    /// @exception IndexOutOfBoundsException
+    ///
+    unsigned long getTopDistribIndex(unsigned long t, unsigned long i) const;
+
+    real_t getSumNonTopDistribWeights(unsigned long t) const;
+    real_t getSumNonTopDistribLK(unsigned long t) const;
+
+    /// Gives the top distributions of a frame to a stat server (see
+    /// StatServer::setTopDistribIndexVector()) to compute log-likelihoods
+    /// with USE_TOP_DISTRIBS
+    /// @param ss the stat server
+    /// @param t index of the frame
+    /// @exception IndexOutOfBoundsException
+    ///
+    void setTopDistribIndexVector(StatServer& ss, unsigned long t) const;
+
+    /// Computes a checksum of all the features of a stream. The stream is
+    /// read from the beginning and is positioned at the beginning on
+    /// return.
+    /// @param fs the stream
+    /// @return the checksum
+    ///
+    static unsigned long computeChecksum(FeatureInputStream& fs);
+
+    /// Saves the cache in a binary file
+    /// @param f the file name
+    /// @exception IOException if an I/O error occurs
+    ///
+    void save(const FileName& f) const;
+
+    /// Reads a file written by save()
+    /// @param f the file name
+    /// @param worldChecksum checksum of the world model
+    /// @param featureChecksum checksum of the features
+    /// @return false if the file does not exist or has been saved for
+    ///     another world model or for other features. The cache is not
+    ///     modified.
+    /// @exception IOException if the file cannot be read
+    ///
+    bool load(const FileName& f, unsigned long worldChecksum,
+              unsigned long featureChecksum);
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    unsigned long _worldChecksum;
+    unsigned long _featureChecksum;
+    unsigned long _frameCount;
+    unsigned long _topDistribsCount;
+    ULongVector   _indexVect; // _topDistribsCount indices per frame
+    DoubleVector  _sumNonTopDistribWeightsVect;
+    DoubleVector  _sumNonTopDistribLKVect;
+    mutable ULongVector _tmpVect;
+
+    TopDistribsCache(const TopDistribsCache&); /*!Not implemented*/
+    const TopDistribsCache& operator=(
+                const TopDistribsCache&); /*!Not implemented*/
+    bool operator==(const TopDistribsCache&) const; /*!Not implemented*/
+    bool operator!=(const TopDistribsCache&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_TopDistribsCache_h)
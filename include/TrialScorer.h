@@ -0,0 +1,238 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_TrialScorer_h)
+#define ALIZE_TrialScorer_h
+
+#if defined(_WIN32)
+#if defined(ALIZE_EXPORTS)
+#define ALIZE_API __declspec(dllexport)
+#else
+#define ALIZE_API __declspec(dllimport)
+#endif
+#else
+#define ALIZE_API
+#endif
+
+#include "Object.h"
+#include "RefVector.h"
+#include "ULongVector.h"
+#include "RealVector.h"
+#include "XLine.h"
+
+namespace alize
+{
+  class Config;
+  class Mixture;
+  class MixtureServer;
+  class ThreadPool;
+  class TrialScorer;
+  class XList;
+
+  /// Receives the progress of a TrialScorer
+  ///
+  /// @version 1.0
+
+  class ALIZE_API TrialScorerListener
+  {
+  public :
+
+    virtual ~TrialScorerListener();
+
+    /// Called when all the trials of a test file have been scored. Called
+    /// by the threads of the pool : must be thread-safe.
+    /// @param s the scorer (see TrialScorer::getProcessedTestCount()...)
+    /// @param test index of the test file
+    ///
+    virtual void testScored(const TrialScorer& s, unsigned long test) = 0;
+  };
+
+  /// Scores a list of trials (model, test file). The trials are grouped by
+  /// test file : each test file is read once and scored against all its
+  /// models in a single pass (see StatServer::computeMultiModelLLK()), the
+  /// top distributions of the world model being computed once per
+  /// frame.\n
+  /// The test files are shared among the threads of a pool, each thread
+  /// with its own StatServer. All the frames of a test file are used.\n
+  /// The score of a trial is the mean log-likelihood ratio between the
+  /// model and the world model on the frames of the test file.
+  ///
+  /// @version 1.0
+
+  class ALIZE_API TrialScorer : public Object
+  {
+
+  public :
+
+    /// Creates a scorer
+    /// @param c the config. The scorer stores a reference to it.
+    /// @param ms the mixture server used to find and load the models.
+    ///     The scorer stores a reference to it.
+    /// @param world the world model. The scorer stores a reference to it.
+    /// @param pool the threads. The scorer stores a reference to it.
+    ///
+    explicit TrialScorer(const Config& c, MixtureServer& ms,
+                         const Mixture& world, ThreadPool& pool);
+    virtual ~TrialScorer();
+
+    /// Adds a trial. The model is searched in the mixture server and
+    /// loaded if it is not found.
+    /// @param test name of the test feature file
+    /// @param model identifier of the model
+    /// @return the index of the trial
+    ///
+    unsigned long addTrial(const String& test, const String& model);
+
+    /// Adds trials given by a NDX list : each line contains a test file
+    /// followed by the identifiers of the models
+    /// @param l the list
+    ///
+    void addTrials(const XList& l);
+
+    unsigned long getTrialCount() const;
+    unsigned long getTestCount() const;
+    const String& getTestName(unsigned long test) const;
+
+    /// Returns the test file of a trial
+    /// @param trial index of the trial
+    /// @return the index of the test file
+    ///
+    unsigned long getTrialTest(unsigned long trial) const;
+
+    /// Returns the model of a trial
+    /// @param trial index of the trial
+    /// @return the model
+    ///
+    const Mixture& getTrialModel(unsigned long trial) const;
+
+    /// Sets the object that receives the progress of run()
+    /// @param p the listener or NULL. The scorer stores a pointer to it.
+    ///
+    void setListener(TrialScorerListener* p);
+
+    /// Scores all the trials
+    /// @exception Exception if a test file cannot be read. The test files
+    ///     not yet started are not scored.
+    ///
+    void run();
+
+    /// Returns the score of a trial computed by run()
+    /// @param trial index of the trial
+    /// @return the score
+    ///
+    real_t getScore(unsigned long trial) const;
+
+    /// Returns the number of frames of a test file read by run()
+    /// @param test index of the test file
+    /// @return the number of frames
+    ///
+    unsigned long getTestFrameCount(unsigned long test) const;
+
+    /// Counters of the current or last run(). They can be read by any
+    /// thread during run().
+    unsigned long getProcessedTestCount() const;
+    unsigned long getProcessedTrialCount() const;
+    unsigned long getProcessedFrameCount() const;
+
+    /// Returns the time since the beginning of the current run() or the
+    /// duration of the last one
+    /// @return the time in seconds
+    ///
+    real_t getElapsedTime() const;
+
+    /// Returns the number of trials scored per second by run()
+    /// @return the throughput
+    ///
+    real_t getTrialThroughput() const;
+
+    /// Returns the number of test frames read per second by run()
+    /// @return the throughput
+    ///
+    real_t getFrameThroughput() const;
+
+    virtual String getClassName() const;
+    virtual String toString() const;
+
+  private :
+
+    const Config&        _config;
+    MixtureServer&       _ms;
+    const Mixture&       _world;
+    ThreadPool&          _pool;
+    TrialScorerListener* _pListener;
+    XLine                _testNameLine;
+    ULongVector          _trialTestVect;
+    RefVector<Mixture>   _trialModelVect;
+    DoubleVector         _scoreVect;
+    ULongVector          _testFrameCountVect;
+    unsigned long        _processedTestCount;
+    unsigned long        _processedTrialCount;
+    unsigned long        _processedFrameCount;
+    double               _startTime;
+    double               _endTime;
+    bool                 _running;
+
+    friend class TrialScorerTask;
+    static double getTime();
+
+    TrialScorer(const TrialScorer&); /*!Not implemented*/
+    const TrialScorer& operator=(const TrialScorer&); /*!Not implemented*/
+    bool operator==(const TrialScorer&) const; /*!Not implemented*/
+    bool operator!=(const TrialScorer&) const; /*!Not implemented*/
+  };
+
+} // end namespace alize
+
+#endif // !defined(ALIZE_TrialScorer_h)
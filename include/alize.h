@@ -81,10 +81,16 @@
 
 #include "DistribGD.h"
 #include "DistribGF.h"
+#include "DistribKernel.h"
 #include "MixtureGD.h"
+#include "MixtureGDCompiled.h"
+#include "DistribDictCompiled.h"
+#include "MixtureGDSelector.h"
 #include "MixtureGF.h"
 #include "FeatureFlags.h"
 #include "Feature.h"
+#include "FeatureView.h"
+#include "FrameBlock.h"
 
 #include "LabelServer.h"
 #include "MixtureServer.h"
@@ -96,6 +102,15 @@
 #include "FrameAccGD.h"
 #include "FrameAccGF.h"
 #include "StatServer.h"
+#include "TopDistribsCache.h"
+#include "ThreadPool.h"
+#include "MixtureEMTrainer.h"
+#include "BaumWelchStats.h"
+#include "BaumWelchStatExtractor.h"
+#include "LinearScorer.h"
+#include "TrialScorer.h"
+#include "ScoreCache.h"
+#include "ScoreNormalizer.h"
 
 #include "FeatureMultipleFileReader.h"
 #include "FeatureFileReaderRaw.h"
@@ -0,0 +1,202 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_BaumWelchStatExtractor_cpp)
+#define ALIZE_BaumWelchStatExtractor_cpp
+
+#include <new>
+#include "BaumWelchStatExtractor.h"
+#include "BaumWelchStats.h"
+#include "MixtureGD.h"
+#include "MixtureGDStat.h"
+#include "StatServer.h"
+#include "FeatureInputStream.h"
+#include "FeatureFileReader.h"
+#include "FeatureFileList.h"
+#include "XLine.h"
+#include "Feature.h"
+#include "ThreadPool.h"
+#include "RefVector.h"
+#include "Config.h"
+#include "Exception.h"
+
+using namespace alize;
+typedef BaumWelchStatExtractor T;
+
+namespace
+{
+  // Accumulates the frames in s then copies the result in stats
+  void accumulate(MixtureGDStat& s, FeatureInputStream& fs,
+                  unsigned long begin, unsigned long count,
+                  unsigned long worldChecksum, BaumWelchStats& stats)
+  {
+    const unsigned long vectSize = s.getMixture().getVectSize();
+    if (fs.getVectSize() != vectSize)
+      throw Exception("world vectSize (" + String::valueOf(vectSize)
+          + ") != feature vectSize (" + String::valueOf(fs.getVectSize())
+          + ")", __FILE__, __LINE__);
+    Feature f(vectSize);
+    s.resetEM();
+    fs.seekFeature(begin);
+    for (unsigned long t=0; t<count; t++)
+    {
+      if (!fs.readFeature(f))
+        throw Exception("End of the feature stream before the end of the"
+                        " segment", __FILE__, __LINE__);
+      s.computeAndAccumulateEM(f);
+    }
+    stats.setStats(s, worldChecksum);
+  }
+}
+
+// One job per file of the list. Each thread has its own stat server and
+// statistics
+class BWStatExtractorTask : public ThreadTask
+{
+public :
+  BWStatExtractorTask(const Config& c, const MixtureGD& m,
+                      unsigned long threadCount, bool secondOrder,
+                      unsigned long worldChecksum, const FeatureFileList& l,
+                      const String& path, const String& extension)
+    :_config(c), _worldChecksum(worldChecksum), _path(path),
+     _extension(extension)
+  {
+    // copied here : FeatureFileList::getFileName() is not thread-safe
+    for (unsigned long i=0; i<l.size(); i++)
+      _fileNameLine.addElement(l.getFileName(i));
+    for (unsigned long i=0; i<threadCount; i++)
+    {
+      StatServer* p = new (std::nothrow) StatServer(c);
+      Object::assertMemoryIsAllocated(p, __FILE__, __LINE__);
+      _ssVect.addObject(*p);
+      _statVect.addObject(static_cast<MixtureGDStat&>(
+                p->createAndStoreMixtureStat(static_cast<const Mixture&>(m))));
+      BaumWelchStats* s = new (std::nothrow) BaumWelchStats(
+                m.getDistribCount(), m.getVectSize(), secondOrder);
+      Object::assertMemoryIsAllocated(s, __FILE__, __LINE__);
+      _bwVect.addObject(*s);
+    }
+  }
+  ~BWStatExtractorTask()
+  {
+    _bwVect.deleteAllObjects();
+    _ssVect.deleteAllObjects(); // deletes the MixtureGDStat objects
+  }
+  void runJob(unsigned long job, unsigned long thread)
+  {
+    const FileName& fileName = _fileNameLine.getElement(job, false);
+    FeatureFileReader r(fileName, _config);
+    BaumWelchStats& stats = _bwVect.getObject(thread);
+    accumulate(_statVect.getObject(thread), r, 0, r.getFeatureCount(),
+               _worldChecksum, stats);
+    stats.save(_path + fileName + _extension);
+  }
+private :
+  const Config&            _config;
+  const unsigned long      _worldChecksum;
+  XLine                    _fileNameLine;
+  const String             _path;
+  const String             _extension;
+  RefVector<StatServer>     _ssVect;
+  RefVector<MixtureGDStat>  _statVect;
+  RefVector<BaumWelchStats> _bwVect;
+};
+
+//-------------------------------------------------------------------------
+T::BaumWelchStatExtractor(const Config& c, const MixtureGD& world,
+                          ThreadPool& pool)
+:Object(), _config(c), _world(world), _pool(pool), _secondOrder(false),
+ _worldChecksum(world.computeChecksum()) {}
+//-------------------------------------------------------------------------
+void T::setSecondOrder(bool b) { _secondOrder = b; }
+//-------------------------------------------------------------------------
+bool T::getSecondOrder() const { return _secondOrder; }
+//-------------------------------------------------------------------------
+void T::computeStats(FeatureInputStream& fs, unsigned long begin,
+                     unsigned long count, BaumWelchStats& s) const
+{
+  StatServer ss(_config);
+  MixtureGDStat& stat = static_cast<MixtureGDStat&>(
+          ss.createAndStoreMixtureStat(static_cast<const Mixture&>(_world)));
+  s.reset(_world.getDistribCount(), _world.getVectSize(), _secondOrder);
+  accumulate(stat, fs, begin, count, _worldChecksum, s);
+}
+//-------------------------------------------------------------------------
+void T::computeStats(FeatureInputStream& fs, BaumWelchStats& s) const
+{ computeStats(fs, 0, fs.getFeatureCount(), s); }
+//-------------------------------------------------------------------------
+void T::computeAndSaveStats(const FeatureFileList& l, const String& path,
+                            const String& extension) const
+{
+  _world.prepare(); // read-only for the threads
+  BWStatExtractorTask task(_config, _world, _pool.getThreadCount(),
+                           _secondOrder, _worldChecksum, l, path, extension);
+  _pool.run(task, l.size());
+}
+//-------------------------------------------------------------------------
+String T::getClassName() const { return "BaumWelchStatExtractor"; }
+//-------------------------------------------------------------------------
+String T::toString() const
+{
+  return Object::toString()
+    + "\n  world         = '" + _world.getId() + "'"
+    + "\n  secondOrder   = " + String::valueOf(_secondOrder)
+    + "\n  threadCount   = " + String::valueOf(_pool.getThreadCount());
+}
+//-------------------------------------------------------------------------
+T::~BaumWelchStatExtractor() {}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_BaumWelchStatExtractor_cpp)
@@ -0,0 +1,226 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_BaumWelchStats_cpp)
+#define ALIZE_BaumWelchStats_cpp
+
+#if defined(_WIN32)
+#define uint32_t unsigned __int32
+#else
+#include <stdint.h>
+#endif
+
+#include <fstream>
+#include <memory.h>
+#include "BaumWelchStats.h"
+#include "MixtureGDStat.h"
+#include "Exception.h"
+#include "alizeString.h"
+
+using namespace alize;
+using namespace std;
+typedef BaumWelchStats T;
+
+static const char FILE_MAGIC[4] = {'B', 'W', 'S', '1'};
+static const unsigned long FILE_ALIGN = 64; // header size and alignment
+
+namespace
+{
+  unsigned long align(unsigned long n)
+  { return (n+FILE_ALIGN-1)/FILE_ALIGN*FILE_ALIGN; }
+
+  void writeArray(ofstream& s, const float* a, unsigned long n)
+  {
+    static const char zeros[FILE_ALIGN] = {0};
+    s.write((const char*)a, n*sizeof(float));
+    s.write(zeros, align(n*sizeof(float))-n*sizeof(float));
+  }
+
+  void readArray(ifstream& s, float* a, unsigned long n)
+  {
+    s.read((char*)a, n*sizeof(float));
+    s.seekg(align(n*sizeof(float))-n*sizeof(float), ios::cur);
+  }
+}
+
+//-------------------------------------------------------------------------
+T::BaumWelchStats(unsigned long distribCount, unsigned long vectSize,
+                  bool secondOrder)
+:Object() { reset(distribCount, vectSize, secondOrder); }
+//-------------------------------------------------------------------------
+void T::reset(unsigned long distribCount, unsigned long vectSize,
+              bool secondOrder)
+{
+  _distribCount = distribCount;
+  _vectSize = vectSize;
+  _secondOrder = secondOrder;
+  _frameCount = 0;
+  _worldChecksum = 0;
+  _zeroOrderVect.setSize(distribCount);
+  _zeroOrderVect.setAllValues(0.0);
+  _firstOrderVect.setSize(distribCount*vectSize);
+  _firstOrderVect.setAllValues(0.0);
+  _secondOrderVect.setSize(secondOrder ? distribCount*vectSize : 0);
+  _secondOrderVect.setAllValues(0.0);
+}
+//-------------------------------------------------------------------------
+void T::setStats(const MixtureGDStat& s, unsigned long worldChecksum)
+{
+  const DoubleVector& occVect = s.getAccumulatedOccVect();
+  const DoubleVector& meanVect = s.getAccumulatedMeanVect();
+  const DoubleVector& covVect = s.getAccumulatedCovVect();
+  if (occVect.size() != _distribCount
+      || meanVect.size() != _distribCount*_vectSize)
+    throw Exception("statistics dimensions (" + String::valueOf(
+        _distribCount) + "x" + String::valueOf(_vectSize)
+        + ") != accumulator dimensions", __FILE__, __LINE__);
+  unsigned long i;
+  for (i=0; i<_distribCount; i++)
+    _zeroOrderVect[i] = (float)occVect[i];
+  for (i=0; i<meanVect.size(); i++)
+    _firstOrderVect[i] = (float)meanVect[i];
+  if (_secondOrder)
+    for (i=0; i<covVect.size(); i++)
+      _secondOrderVect[i] = (float)covVect[i];
+  _frameCount = (unsigned long)(s.getEMFeatureCount()+0.5);
+  _worldChecksum = worldChecksum;
+}
+//-------------------------------------------------------------------------
+unsigned long T::getDistribCount() const { return _distribCount; }
+//-------------------------------------------------------------------------
+unsigned long T::getVectSize() const { return _vectSize; }
+//-------------------------------------------------------------------------
+bool T::hasSecondOrder() const { return _secondOrder; }
+//-------------------------------------------------------------------------
+unsigned long T::getFrameCount() const { return _frameCount; }
+//-------------------------------------------------------------------------
+unsigned long T::getWorldChecksum() const { return _worldChecksum; }
+//-------------------------------------------------------------------------
+const FloatVector& T::getZeroOrderVect() const { return _zeroOrderVect; }
+//-------------------------------------------------------------------------
+const FloatVector& T::getFirstOrderVect() const { return _firstOrderVect; }
+//-------------------------------------------------------------------------
+const FloatVector& T::getSecondOrderVect() const
+{ return _secondOrderVect; }
+//-------------------------------------------------------------------------
+unsigned long T::getFirstOrderOffset(unsigned long distribCount)
+{ return FILE_ALIGN + align(distribCount*sizeof(float)); }
+//-------------------------------------------------------------------------
+unsigned long T::getFileSize(unsigned long distribCount,
+                             unsigned long vectSize, bool secondOrder)
+{
+  return getFirstOrderOffset(distribCount)
+       + align(distribCount*vectSize*sizeof(float))*(secondOrder ? 2 : 1);
+}
+//-------------------------------------------------------------------------
+void T::save(const FileName& f) const
+{
+  ofstream out(f.c_str(), ios::out|ios::binary);
+  if (!out)
+    throw IOException("Cannot open file", __FILE__, __LINE__, f);
+  uint32_t header[FILE_ALIGN/sizeof(uint32_t)];
+  memset(header, 0, sizeof(header));
+  memcpy(header, FILE_MAGIC, sizeof(FILE_MAGIC));
+  header[1] = (uint32_t)_worldChecksum;
+  header[2] = (uint32_t)_distribCount;
+  header[3] = (uint32_t)_vectSize;
+  header[4] = (_secondOrder ? 1 : 0);
+  header[5] = (uint32_t)_frameCount;
+  out.write((const char*)header, sizeof(header));
+  writeArray(out, _zeroOrderVect.getArray(), _zeroOrderVect.size());
+  writeArray(out, _firstOrderVect.getArray(), _firstOrderVect.size());
+  if (_secondOrder)
+    writeArray(out, _secondOrderVect.getArray(), _secondOrderVect.size());
+  if (!out)
+    throw IOException("Cannot write file", __FILE__, __LINE__, f);
+}
+//-------------------------------------------------------------------------
+void T::load(const FileName& f)
+{
+  ifstream in(f.c_str(), ios::in|ios::binary);
+  if (!in)
+    throw IOException("Cannot open file", __FILE__, __LINE__, f);
+  uint32_t header[FILE_ALIGN/sizeof(uint32_t)];
+  in.read((char*)header, sizeof(header));
+  if (!in || memcmp(header, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0)
+    throw IOException("Not a Baum-Welch statistics file", __FILE__,
+                      __LINE__, f);
+  reset(header[2], header[3], header[4] != 0);
+  _worldChecksum = header[1];
+  _frameCount = header[5];
+  readArray(in, _zeroOrderVect.getArray(), _zeroOrderVect.size());
+  readArray(in, _firstOrderVect.getArray(), _firstOrderVect.size());
+  if (_secondOrder)
+    readArray(in, _secondOrderVect.getArray(), _secondOrderVect.size());
+  if (!in)
+    throw IOException("Cannot read file", __FILE__, __LINE__, f);
+}
+//-------------------------------------------------------------------------
+String T::getClassName() const { return "BaumWelchStats"; }
+//-------------------------------------------------------------------------
+String T::toString() const
+{
+  return Object::toString()
+    + "\n  distribCount  = " + String::valueOf(_distribCount)
+    + "\n  vectSize      = " + String::valueOf(_vectSize)
+    + "\n  secondOrder   = " + String::valueOf(_secondOrder)
+    + "\n  frameCount    = " + String::valueOf(_frameCount)
+    + "\n  worldChecksum = " + String::valueOf(_worldChecksum);
+}
+//-------------------------------------------------------------------------
+T::~BaumWelchStats() {}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_BaumWelchStats_cpp)
@@ -86,8 +86,18 @@ void Config::assign(const Config& c) // private
   ASSIGN(_param_minCov);
   ASSIGN(_param_vectSize);
   ASSIGN(_param_loadFeatureFileMemAlloc);
+  ASSIGN(_param_loadFeatureFileMemoryMap);
+  ASSIGN(_param_loadFeatureFilePrefetch);
   ASSIGN(_param_featureServerMemAlloc);
   ASSIGN(_param_computeLLKWithTopDistribs);
+  ASSIGN(_param_computeLLKInLogDomain);
+  ASSIGN(_param_gaussianSelection);
+  ASSIGN(_param_gaussianSelectionClusterCount);
+  ASSIGN(_param_gaussianSelectionSearchedClusterCount);
+  ASSIGN(_param_gaussianSelectionFileExtension);
+  ASSIGN(_param_topDistribsPruning);
+  ASSIGN(_param_emOccThreshold);
+  ASSIGN(_param_emTopDistribsCount);
   ASSIGN(_param_debug);
   ASSIGN(_param_topDistribsCount);
   ASSIGN(_param_featureServerBufferSize);
@@ -129,8 +139,18 @@ void Config::assign(const Config& c) // private
   ASSIGN(existsParam_minCov);
   ASSIGN(existsParam_vectSize);
   ASSIGN(existsParam_loadFeatureFileMemAlloc);
+  ASSIGN(existsParam_loadFeatureFileMemoryMap);
+  ASSIGN(existsParam_loadFeatureFilePrefetch);
   ASSIGN(existsParam_featureServerMemAlloc);
   ASSIGN(existsParam_computeLLKWithTopDistribs);
+  ASSIGN(existsParam_computeLLKInLogDomain);
+  ASSIGN(existsParam_gaussianSelection);
+  ASSIGN(existsParam_gaussianSelectionClusterCount);
+  ASSIGN(existsParam_gaussianSelectionSearchedClusterCount);
+  ASSIGN(existsParam_gaussianSelectionFileExtension);
+  ASSIGN(existsParam_topDistribsPruning);
+  ASSIGN(existsParam_emOccThreshold);
+  ASSIGN(existsParam_emTopDistribsCount);
   ASSIGN(existsParam_debug);
   ASSIGN(existsParam_topDistribsCount);
   ASSIGN(existsParam_featureServerBufferSize);
@@ -205,8 +225,28 @@ void Config::reset()
   existsParam_minCov = false;
   existsParam_vectSize = false;
   existsParam_loadFeatureFileMemAlloc = false;
+  existsParam_loadFeatureFileMemoryMap = false;
+  _param_loadFeatureFileMemoryMap = false;
+  existsParam_loadFeatureFilePrefetch = false;
+  _param_loadFeatureFilePrefetch = false;
   existsParam_featureServerMemAlloc = false;
   existsParam_topDistribsCount = false;
+  existsParam_computeLLKInLogDomain = false;
+  _param_computeLLKInLogDomain = false;
+  existsParam_gaussianSelection = false;
+  _param_gaussianSelection = false;
+  existsParam_gaussianSelectionClusterCount = false;
+  _param_gaussianSelectionClusterCount = 0;
+  existsParam_gaussianSelectionSearchedClusterCount = false;
+  _param_gaussianSelectionSearchedClusterCount = 0;
+  existsParam_gaussianSelectionFileExtension = false;
+  _param_gaussianSelectionFileExtension = ".gsi";
+  existsParam_topDistribsPruning = false;
+  _param_topDistribsPruning = false;
+  existsParam_emOccThreshold = false;
+  _param_emOccThreshold = 0.0;
+  existsParam_emTopDistribsCount = false;
+  _param_emTopDistribsCount = 0;
   existsParam_featureServerBufferSize = false;
   existsParam_featureServerMask = false;
   existsParam_featureFlags = false;
@@ -313,6 +353,12 @@ unsigned long Config::getParam_loadFeatureFileMemAlloc() const
   return _param_loadFeatureFileMemAlloc;
 }
 //-------------------------------------------------------------------------
+bool Config::getParam_loadFeatureFileMemoryMap() const
+{ return _param_loadFeatureFileMemoryMap; }
+//-------------------------------------------------------------------------
+bool Config::getParam_loadFeatureFilePrefetch() const
+{ return _param_loadFeatureFilePrefetch; }
+//-------------------------------------------------------------------------
 unsigned long Config::getParam_featureServerMemAlloc() const
 {
   if (!existsParam_featureServerMemAlloc)
@@ -329,6 +375,30 @@ bool Config::getParam_computeLLKWithTopDistribs() const
   return _param_computeLLKWithTopDistribs;
 }
 //-------------------------------------------------------------------------
+bool Config::getParam_computeLLKInLogDomain() const
+{ return _param_computeLLKInLogDomain; }
+//-------------------------------------------------------------------------
+bool Config::getParam_gaussianSelection() const
+{ return _param_gaussianSelection; }
+//-------------------------------------------------------------------------
+unsigned long Config::getParam_gaussianSelectionClusterCount() const
+{ return _param_gaussianSelectionClusterCount; }
+//-------------------------------------------------------------------------
+unsigned long Config::getParam_gaussianSelectionSearchedClusterCount() const
+{ return _param_gaussianSelectionSearchedClusterCount; }
+//-------------------------------------------------------------------------
+const String& Config::getParam_gaussianSelectionFileExtension() const
+{ return _param_gaussianSelectionFileExtension; }
+//-------------------------------------------------------------------------
+bool Config::getParam_topDistribsPruning() const
+{ return _param_topDistribsPruning; }
+//-------------------------------------------------------------------------
+real_t Config::getParam_emOccThreshold() const
+{ return _param_emOccThreshold; }
+//-------------------------------------------------------------------------
+unsigned long Config::getParam_emTopDistribsCount() const
+{ return _param_emTopDistribsCount; }
+//-------------------------------------------------------------------------
 bool Config::getParam_debug() const { return _param_debug; }
 //-------------------------------------------------------------------------
 unsigned long Config::getParam_topDistribsCount() const
@@ -640,6 +710,22 @@ void Config::setParam(const String& name, const String& content)
     _param_loadFeatureFileMemAlloc = content.toULong();
     existsParam_loadFeatureFileMemAlloc = true;
   }
+  else if (name == "loadFeatureFileMemoryMap")
+  {
+    if (content.getToken(0).isEmpty())
+      _param_loadFeatureFileMemoryMap = true;
+    else
+      _param_loadFeatureFileMemoryMap = content.toBool();
+    existsParam_loadFeatureFileMemoryMap = true;
+  }
+  else if (name == "loadFeatureFilePrefetch")
+  {
+    if (content.getToken(0).isEmpty())
+      _param_loadFeatureFilePrefetch = true;
+    else
+      _param_loadFeatureFilePrefetch = content.toBool();
+    existsParam_loadFeatureFilePrefetch = true;
+  }
   else if (name == "featureServerMemAlloc")
   {
     _param_featureServerMemAlloc = content.toULong();
@@ -657,6 +743,58 @@ void Config::setParam(const String& name, const String& content)
               __FILE__, __LINE__);
     existsParam_computeLLKWithTopDistribs = true;
   }
+  else if (name == "computeLLKInLogDomain")
+  {
+    if (content.getToken(0).isEmpty())
+      _param_computeLLKInLogDomain = true;
+    else
+      _param_computeLLKInLogDomain = content.toBool();
+    existsParam_computeLLKInLogDomain = true;
+  }
+  else if (name == "gaussianSelection")
+  {
+    if (content.getToken(0).isEmpty())
+      _param_gaussianSelection = true;
+    else
+      _param_gaussianSelection = content.toBool();
+    existsParam_gaussianSelection = true;
+  }
+  else if (name == "gaussianSelectionClusterCount")
+  {
+    _param_gaussianSelectionClusterCount = content.toULong();
+    existsParam_gaussianSelectionClusterCount = true;
+  }
+  else if (name == "gaussianSelectionSearchedClusterCount")
+  {
+    _param_gaussianSelectionSearchedClusterCount = content.toULong();
+    existsParam_gaussianSelectionSearchedClusterCount = true;
+  }
+  else if (name == "gaussianSelectionFileExtension")
+  {
+    _param_gaussianSelectionFileExtension = content;
+    existsParam_gaussianSelectionFileExtension = true;
+  }
+  else if (name == "topDistribsPruning")
+  {
+    if (content.getToken(0).isEmpty())
+      _param_topDistribsPruning = true;
+    else
+      _param_topDistribsPruning = content.toBool();
+    existsParam_topDistribsPruning = true;
+  }
+  else if (name == "emOccThreshold")
+  {
+    _param_emOccThreshold = content.toDouble();
+    if (_param_emOccThreshold < 0.0 || _param_emOccThreshold >= 1.0)
+      throw Exception("parameter '"+name+"' must be in [0, 1[",
+                      __FILE__, __LINE__);
+    existsParam_emOccThreshold = true;
+  }
+  else if (name == "emTopDistribsCount")
+  {
+    _param_emTopDistribsCount = content.toULong();
+    existsParam_emTopDistribsCount = true;
+  }
   else if (name == "topDistribsCount")
   {
     _param_topDistribsCount = content.toULong();
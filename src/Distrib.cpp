@@ -58,15 +58,20 @@
 #include "Distrib.h"
 #include "DistribGD.h"
 #include "DistribGF.h"
+#include "Feature.h"
+#include "FeatureView.h"
 #include "Exception.h"
 
 using namespace alize;
 typedef Distrib D;
 
+unsigned long D::_globalVersion = 0;
+
 //-------------------------------------------------------------------------
 D::Distrib(unsigned long vectSize)
 :Object(), _vectSize(vectSize), _det(0.0), _cst(0.0),
- _meanVect(vectSize, vectSize), _refCounter(0), _dictIndex(0) {}
+ _meanVect(vectSize, vectSize), _refCounter(0), _dictIndex(0), _version(0)
+{ incrementVersion(); }
 //-------------------------------------------------------------------------
 bool D::operator!=(const Distrib& d) const { return !(*this == d); }
 //-------------------------------------------------------------------------
@@ -80,22 +85,44 @@ DoubleVector& D::getMeanVect() { return _meanVect; }
 //-------------------------------------------------------------------------
 const DoubleVector& D::getMeanVect() const { return _meanVect; }
 //-------------------------------------------------------------------------
-void D::setMean(const real_t v, const unsigned long i){ _meanVect[i] = v; }
+void D::setMean(const real_t v, const unsigned long i)
+{ incrementVersion(); _meanVect[i] = v; }
 //-------------------------------------------------------------------------
-void D::setMeanVect(const DoubleVector& v) { _meanVect.setValues(v); }
+void D::setMeanVect(const DoubleVector& v)
+{ incrementVersion(); _meanVect.setValues(v); }
 //-------------------------------------------------------------------------
 real_t D::getDet() const { return _det; }
 //-------------------------------------------------------------------------
 real_t D::getCst() const { return _cst; }
 //-------------------------------------------------------------------------
-void D::setDet(const K&, real_t v) { _det = v; }
+void D::setDet(const K&, real_t v) { incrementVersion(); _det = v; }
 //-------------------------------------------------------------------------
-void D::setCst(const K&, real_t v) { _cst = v; }
+void D::setCst(const K&, real_t v) { incrementVersion(); _cst = v; }
 //-------------------------------------------------------------------------
 unsigned long& D::refCounter(const K&) { return _refCounter; }
 //-------------------------------------------------------------------------
 unsigned long& D::dictIndex(const K&) { return _dictIndex; }
 //-------------------------------------------------------------------------
+unsigned long D::getVersion() const { return _version; }
+//-------------------------------------------------------------------------
+void D::markModified() { incrementVersion(); }
+//-------------------------------------------------------------------------
+unsigned long D::getGlobalVersion() // static
+{ return addToCounter(_globalVersion, 0); } // atomic read
+//-------------------------------------------------------------------------
+void D::incrementVersion() // protected
+{
+  _version++;
+  incrementCounter(_globalVersion); // shared by all the threads
+}
+//-------------------------------------------------------------------------
+lk_t D::computeLK(const FeatureView& v) const
+{
+  Feature f(v.getVectSize());
+  v.copyTo(f);
+  return computeLK(f);
+}
+//-------------------------------------------------------------------------
 D::~Distrib() {}
 //-------------------------------------------------------------------------
 Distrib& D::create(const K&, const DistribType type,
@@ -0,0 +1,344 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_DistribDictCompiled_cpp)
+#define ALIZE_DistribDictCompiled_cpp
+
+#if defined(_WIN32)
+  #include <cfloat> // for _isnan()
+  #define ISNAN(x) _isnan(x)
+#elif defined(linux) || defined(__linux) || defined(__CYGWIN__) || defined(__APPLE__)
+  #define ISNAN(x) isnan(x)
+#else
+  #error "Unsupported OS\n"
+#endif
+
+#include <cmath>
+#include <memory.h>
+#include <new>
+#include "DistribDictCompiled.h"
+#include "MixtureServer.h"
+#include "DistribGD.h"
+#include "DistribKernel.h"
+#include "Feature.h"
+#include "FrameBlock.h"
+#include "ThreadPool.h"
+#include "Exception.h"
+#include "alizeString.h"
+
+using namespace alize;
+using namespace std;
+typedef DistribDictCompiled C;
+
+// frames processed together by the block methods and by a job, and size in
+// bytes of the means and inverse covariances of a group of distributions
+// (about the size of the level 1 data cache)
+static const unsigned long FRAME_BLOCK_SIZE = 64;
+static const unsigned long DISTRIB_BLOCK_BYTES = 32768;
+// minimum number of distributions of a job when one frame is shared
+// between the threads
+static const unsigned long MIN_JOB_DISTRIB_COUNT = 256;
+
+namespace alize
+{
+  // One job per group of distributions (one feature) or per group of
+  // frames (block). Each job writes its own part of the results.
+  class DistribDictCompiledTask : public ThreadTask
+  {
+  public :
+    DistribDictCompiledTask(const C& c, const real_t* data,
+                            const FrameBlock* pBlock, unsigned long jobCount,
+                            lk_t* lk)
+    :_c(c), _data(data), _pBlock(pBlock), _jobCount(jobCount), _lk(lk) {}
+
+    virtual void runJob(unsigned long job, unsigned long)
+    {
+      if (_pBlock == NULL)
+      {
+        const unsigned long n = _c.getDistribCount();
+        _c.computeLK(_data, job*n/_jobCount, (job+1)*n/_jobCount, _lk);
+      }
+      else
+      {
+        const unsigned long frameCount = _pBlock->getFrameCount();
+        const unsigned long first = job*FRAME_BLOCK_SIZE;
+        const unsigned long last = (first+FRAME_BLOCK_SIZE > frameCount ?
+                                    frameCount : first+FRAME_BLOCK_SIZE);
+        _c.computeLK(*_pBlock, first, last, _lk);
+      }
+    }
+
+  private :
+    const C&          _c;
+    const real_t*     _data;
+    const FrameBlock* _pBlock;
+    unsigned long     _jobCount;
+    lk_t*             _lk;
+  };
+}
+
+//-------------------------------------------------------------------------
+C::DistribDictCompiled(const MixtureServer& ms)
+:Object(), _packed(false), _distribCount(0), _vectSize(0), _stride(0),
+ _capacity(0), _meanArray(NULL), _covInvArray(NULL), _cstArray(NULL),
+ _globalVersion(0), _distribArray(NULL)
+{ build(ms); }
+//-------------------------------------------------------------------------
+bool C::isUpToDate(const MixtureServer& ms) const
+{
+  if (ms.getDistribCount() != _distribCount)
+    return false;
+  if (Distrib::getGlobalVersion() == _globalVersion)
+    return true;
+  const unsigned long* v = _distribVersionVect.getArray();
+  for (unsigned long d=0; d<_distribCount; d++)
+  {
+    const Distrib& dist = ms.getDistrib(d);
+    if (&dist != _distribArray[d] || dist.getVersion() != v[d])
+      return false;
+  }
+  return true;
+}
+//-------------------------------------------------------------------------
+void C::update(const MixtureServer& ms)
+{
+  if (!isUpToDate(ms))
+    build(ms);
+}
+//-------------------------------------------------------------------------
+void C::prepare(const MixtureServer& ms)
+{
+  // read before the distributions : a later modification is not missed
+  const unsigned long globalVersion = Distrib::getGlobalVersion();
+  if (isUpToDate(ms))
+    _globalVersion = globalVersion; // the next calls take the fast path
+  else
+    build(ms);
+}
+//-------------------------------------------------------------------------
+void C::build(const MixtureServer& ms) // private
+{
+  const unsigned long globalVersion = Distrib::getGlobalVersion();
+  const unsigned long distribCount = ms.getDistribCount();
+  unsigned long d;
+  _packed = true;
+  for (d=0; d<distribCount && _packed; d++)
+  {
+    const Distrib& dist = ms.getDistrib(d);
+    _packed = (dynamic_cast<const DistribGD*>(&dist) != NULL
+               && dist.getVectSize() == ms.getDistrib(0).getVectSize());
+  }
+  const unsigned long vectSize = (distribCount == 0 || !_packed ? 0 :
+                                  ms.getDistrib(0).getVectSize());
+  if (!_packed || _meanArray == NULL || distribCount > _capacity
+      || vectSize != _vectSize)
+  {
+    freeArrays();
+    _vectSize = vectSize;
+    _stride = DistribKernel::getPaddedSize(_vectSize);
+    if (_packed && distribCount != 0)
+    {
+      _capacity = distribCount;
+      _meanArray   = DistribKernel::allocArray(_capacity*_stride);
+      _covInvArray = DistribKernel::allocArray(_capacity*_stride);
+      _cstArray    = DistribKernel::allocArray(_capacity);
+      memset(_meanArray, 0, _capacity*_stride*sizeof(real_t));
+      memset(_covInvArray, 0, _capacity*_stride*sizeof(real_t));
+    }
+  }
+  delete[] _distribArray;
+  _distribArray = new (std::nothrow) const Distrib*[distribCount+1];
+  assertMemoryIsAllocated(_distribArray, __FILE__, __LINE__);
+  _distribVersionVect.setSize(distribCount);
+  unsigned long* v = _distribVersionVect.getArray();
+  for (d=0; d<distribCount; d++)
+  {
+    const Distrib& dist = ms.getDistrib(d);
+    _distribArray[d] = &dist;
+    v[d] = dist.getVersion();
+    if (!_packed)
+      continue;
+    const DistribGD& g = static_cast<const DistribGD&>(dist);
+    memcpy(_meanArray+d*_stride, g.getMeanVect().getArray(),
+           _vectSize*sizeof(real_t));
+    memcpy(_covInvArray+d*_stride, g.getCovInvVect().getArray(),
+           _vectSize*sizeof(real_t));
+    _cstArray[d] = g.getCst();
+  }
+  _distribCount = distribCount;
+  _globalVersion = globalVersion;
+}
+//-------------------------------------------------------------------------
+void C::assertPacked(unsigned long vectSize) const // private
+{
+  if (!_packed)
+    throw Exception("The distributions of the server are not all GD",
+                    __FILE__, __LINE__);
+  if (vectSize != _vectSize && _distribCount != 0)
+    throw Exception("distrib vectSize ("
+        + String::valueOf(_vectSize) + ") != feature vectSize ("
+      + String::valueOf(vectSize) + ")", __FILE__, __LINE__);
+}
+//-------------------------------------------------------------------------
+// same computation as DistribGD::computeLK()
+//-------------------------------------------------------------------------
+void C::computeLK(const real_t* data, unsigned long first,
+                  unsigned long last, lk_t* lk) const // private
+{
+  for (unsigned long d=first; d<last; d++)
+  {
+    real_t tmp = DistribKernel::computeWeightedDist(data,
+                  _meanArray+d*_stride, _covInvArray+d*_stride, _vectSize);
+    tmp = _cstArray[d] * exp(-0.5*tmp);
+    lk[d] = (ISNAN(tmp) ? EPS_LK : tmp);
+  }
+}
+//-------------------------------------------------------------------------
+void C::computeLK(const Feature& f, lk_t* lk) const
+{
+  assertPacked(f.getVectSize());
+  computeLK(f.getDataVector(), 0, _distribCount, lk);
+}
+//-------------------------------------------------------------------------
+void C::computeLK(const Feature& f, lk_t* lk, ThreadPool& pool) const
+{
+  assertPacked(f.getVectSize());
+  unsigned long jobCount = _distribCount/MIN_JOB_DISTRIB_COUNT;
+  if (jobCount > 4*pool.getThreadCount())
+    jobCount = 4*pool.getThreadCount();
+  if (jobCount < 2)
+  {
+    computeLK(f.getDataVector(), 0, _distribCount, lk);
+    return;
+  }
+  DistribDictCompiledTask task(*this, f.getDataVector(), NULL, jobCount, lk);
+  pool.run(task, jobCount);
+}
+//-------------------------------------------------------------------------
+unsigned long C::getDistribBlockSize() const // private
+{
+  unsigned long n = DISTRIB_BLOCK_BYTES/(2*_stride*sizeof(real_t));
+  return n == 0 ? 1 : n;
+}
+//-------------------------------------------------------------------------
+// The distributions are processed by groups of getDistribBlockSize() for
+// all the frames, so the parameters of a group are read from the cache
+// for each frame
+//-------------------------------------------------------------------------
+void C::computeLK(const FrameBlock& b, unsigned long first,
+                  unsigned long last, lk_t* lk) const // private
+{
+  const unsigned long distribBlockSize = getDistribBlockSize();
+  for (unsigned long d0=0; d0<_distribCount; d0+=distribBlockSize)
+  {
+    unsigned long d1 = d0+distribBlockSize;
+    if (d1 > _distribCount)
+      d1 = _distribCount;
+    for (unsigned long t=first; t<last; t++)
+      computeLK(b.getFrame(t), d0, d1, lk+t*_distribCount);
+  }
+}
+//-------------------------------------------------------------------------
+void C::computeLK(const FrameBlock& b, lk_t* lk) const
+{
+  assertPacked(b.getVectSize());
+  const unsigned long frameCount = b.getFrameCount();
+  for (unsigned long t0=0; t0<frameCount; t0+=FRAME_BLOCK_SIZE)
+    computeLK(b, t0, (t0+FRAME_BLOCK_SIZE > frameCount ?
+                      frameCount : t0+FRAME_BLOCK_SIZE), lk);
+}
+//-------------------------------------------------------------------------
+void C::computeLK(const FrameBlock& b, lk_t* lk, ThreadPool& pool) const
+{
+  assertPacked(b.getVectSize());
+  const unsigned long jobCount =
+               (b.getFrameCount()+FRAME_BLOCK_SIZE-1)/FRAME_BLOCK_SIZE;
+  DistribDictCompiledTask task(*this, NULL, &b, jobCount, lk);
+  pool.run(task, jobCount);
+}
+//-------------------------------------------------------------------------
+bool C::isPacked() const { return _packed; }
+//-------------------------------------------------------------------------
+unsigned long C::getDistribCount() const { return _distribCount; }
+//-------------------------------------------------------------------------
+unsigned long C::getVectSize() const { return _vectSize; }
+//-------------------------------------------------------------------------
+void C::freeArrays() // private
+{
+  DistribKernel::freeArray(_meanArray);
+  DistribKernel::freeArray(_covInvArray);
+  DistribKernel::freeArray(_cstArray);
+  _meanArray = _covInvArray = _cstArray = NULL;
+  _capacity = 0;
+}
+//-------------------------------------------------------------------------
+String C::getClassName() const { return "DistribDictCompiled"; }
+//-------------------------------------------------------------------------
+String C::toString() const
+{
+  return Object::toString()
+    + "\n  packed       = " + String::valueOf(_packed)
+    + "\n  distribCount = " + String::valueOf(_distribCount)
+    + "\n  vectSize     = " + String::valueOf(_vectSize);
+}
+//-------------------------------------------------------------------------
+C::~DistribDictCompiled()
+{
+  freeArrays();
+  delete[] _distribArray;
+}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_DistribDictCompiled_cpp)
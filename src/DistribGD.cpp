@@ -71,8 +71,10 @@
 #include <cstdlib>
 #include <memory.h>
 #include "DistribGD.h"
+#include "DistribKernel.h"
 #include "alizeString.h"
 #include "Feature.h"
+#include "FeatureView.h"
 #include "Exception.h"
 #include "Config.h"
 
@@ -133,6 +135,7 @@ const DistribGD& DistribGD::operator=(const DistribGD& d)
     throw Exception("target distrib vectSize ("
         + String::valueOf(_vectSize) + ") != source distrib vectSize ("
         + String::valueOf(d._vectSize) + ")", __FILE__, __LINE__);
+  incrementVersion();
   _meanVect = d._meanVect;
   _covInvVect = d._covInvVect;
   _covVect = d._covVect;
@@ -158,22 +161,29 @@ Distrib& DistribGD::clone() const // private
   return *p;
 }
 //-------------------------------------------------------------------------
-// TODO : A OPTIMISER !!
-//-------------------------------------------------------------------------
 lk_t DistribGD::computeLK(const Feature& frame) const
 {
   if (frame.getVectSize() != _vectSize)
     throw Exception("distrib vectSize ("
         + String::valueOf(_vectSize) + ") != feature vectSize ("
       + String::valueOf(frame.getVectSize()) + ")", __FILE__, __LINE__);
-  real_t tmp = 0.0;
-  real_t*      m = _meanVect.getArray();
-  real_t*      c = _covInvVect.getArray();
-  Feature::data_t* f = frame.getDataVector();
-
-  for (unsigned long i=0; i<_vectSize; i++)
-    tmp += (f[i] - m[i]) * (f[i] - m[i]) * c[i];
-
+  // vectorized kernel selected at run time (see DistribKernel)
+  real_t tmp = DistribKernel::computeWeightedDist(frame.getDataVector(),
+                 _meanVect.getArray(), _covInvVect.getArray(), _vectSize);
+  tmp = _cst * exp(-0.5*tmp);
+  if (ISNAN(tmp))
+    return EPS_LK;
+  return tmp;
+}
+//-------------------------------------------------------------------------
+lk_t DistribGD::computeLK(const FeatureView& frame) const
+{
+  if (frame.getVectSize() != _vectSize)
+    throw Exception("distrib vectSize ("
+        + String::valueOf(_vectSize) + ") != feature vectSize ("
+      + String::valueOf(frame.getVectSize()) + ")", __FILE__, __LINE__);
+  real_t tmp = DistribKernel::computeWeightedDist(frame.getDataVector(),
+                 _meanVect.getArray(), _covInvVect.getArray(), _vectSize);
   tmp = _cst * exp(-0.5*tmp);
   if (ISNAN(tmp))
     return EPS_LK;
@@ -194,6 +204,7 @@ void DistribGD::computeAll()
   real_t* vect = getCovVect().getArray();
   assert(vect != NULL);
   unsigned long i;
+  incrementVersion();
 
    // compute det --------------------------------
 
@@ -231,7 +242,7 @@ void DistribGD::setCov(real_t v, unsigned long i)
 }
 //-------------------------------------------------------------------------
 void DistribGD::setCovInv(const K&, real_t v, unsigned long i)
-{ _covInvVect[i] = v; }
+{ incrementVersion(); _covInvVect[i] = v; }
 //-------------------------------------------------------------------------
 real_t DistribGD::getCov(unsigned long i)
 { return getCovVect()[i];}
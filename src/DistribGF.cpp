@@ -72,6 +72,7 @@
 #include <cstdlib>
 #include <memory.h>
 #include "DistribGF.h"
+#include "DistribKernel.h"
 #include "alizeString.h"
 #include "Feature.h"
 #include "Exception.h"
@@ -84,11 +85,14 @@ using namespace std;
 //-------------------------------------------------------------------------
 DistribGF::DistribGF(const unsigned long vectSize)
  :Distrib(vectSize), _covInvMatr(_vectSize),
- _cst(0.0), _tmpVect(_vectSize) {}
+ _cholVect(_vectSize*(_vectSize+1)/2, _vectSize*(_vectSize+1)/2),
+ _cholUpToDate(false), _cholDefined(false) {}
 //-------------------------------------------------------------------------
 DistribGF::DistribGF(const Config& c)
  :Distrib(c.getParam_vectSize()>0?c.getParam_vectSize():1),
- _covInvMatr(_vectSize), _cst(0.0), _tmpVect(_vectSize) {}
+ _covInvMatr(_vectSize),
+ _cholVect(_vectSize*(_vectSize+1)/2, _vectSize*(_vectSize+1)/2),
+ _cholUpToDate(false), _cholDefined(false) {}
 //-------------------------------------------------------------------------
 void DistribGF::reset() // random init
 {
@@ -122,10 +126,12 @@ DistribGF& DistribGF::create(const K&, const Config& c)
 //-------------------------------------------------------------------------
 DistribGF::DistribGF(const DistribGF& d)
 :Distrib(d._vectSize), _covMatr(d._covMatr), _covInvMatr(d._covInvMatr),
- _cst(d._cst), _tmpVect(d._vectSize)
+ _cholVect(d._cholVect), _cholUpToDate(d._cholUpToDate),
+ _cholDefined(d._cholDefined)
 {
   _meanVect = d._meanVect;
   _det = d._det;
+  _cst = d._cst;
 }
 //-------------------------------------------------------------------------
 const Distrib& DistribGF::operator=(const Distrib& d) // virtual
@@ -142,11 +148,15 @@ const DistribGF& DistribGF::operator=(const DistribGF& d)
     throw Exception("target distrib vectSize ("
         + String::valueOf(_vectSize) + ") != source distrib vectSize ("
         + String::valueOf(d._vectSize) + ")", __FILE__, __LINE__);
+  incrementVersion();
   _meanVect = d._meanVect;
   _covInvMatr = d._covInvMatr;
   _covMatr = d._covMatr;
   _det = d._det;
   _cst = d._cst;
+  _cholVect = d._cholVect;
+  _cholUpToDate = d._cholUpToDate;
+  _cholDefined = d._cholDefined;
   return *this;
 }
 //-------------------------------------------------------------------------
@@ -172,8 +182,6 @@ Distrib& DistribGF::clone() const // private
   return *p;
 }
 //-------------------------------------------------------------------------
-// TODO : A OPTIMISER !!
-//-------------------------------------------------------------------------
 lk_t DistribGF::computeLK(const Feature& frame) const
 {
   if (frame.getVectSize() != _vectSize)
@@ -181,31 +189,18 @@ lk_t DistribGF::computeLK(const Feature& frame) const
         + String::valueOf(_vectSize) + ") != feature vectSize ("
       + String::valueOf(frame.getVectSize()) + ")", __FILE__, __LINE__);
 
-  real_t tmp = 0.0;
-  real_t tmp2;
-  unsigned long i, j, ii;
-  real_t*      m = _meanVect.getArray();
-  real_t*      x = _tmpVect.getArray();
-  real_t*      c = _covInvMatr.getArray();
-  Feature::data_t* f = frame.getDataVector();
-
-  for (j=0; j<_vectSize; j++)
-    x[j] = f[j] - m[j];
-  for (i=0; i<_vectSize; i++)
-  {
-    tmp2 = 0.0;
-    ii = i*_vectSize;
-    for (j=0; j<_vectSize; j++)
-      tmp2 += x[j] * c[j+ii];
-    tmp += tmp2 * x[i];
-  }
-
+  if (!_cholUpToDate)
+    updateCholesky();
+  real_t tmp = computeQuadraticForm(frame.getDataVector());
   tmp = _cst * exp(-0.5*tmp);
   if (ISNAN(tmp))
     return EPS_LK;
   return tmp;
 }
 //-------------------------------------------------------------------------
+lk_t DistribGF::computeLK(const FeatureView& frame) const
+{ return Distrib::computeLK(frame); } // full covariance : no float kernel
+//-------------------------------------------------------------------------
 lk_t DistribGF::computeLK(const Feature& frame, unsigned long idx) const
 {
   real_t x = frame[idx] - _meanVect[idx];
@@ -215,11 +210,85 @@ lk_t DistribGF::computeLK(const Feature& frame, unsigned long idx) const
   return tmp;
 }
 //-------------------------------------------------------------------------
+// (x-mean)'*covInv*(x-mean) without temporary vector (re-entrant)
+//-------------------------------------------------------------------------
+real_t DistribGF::computeQuadraticForm(const real_t* f) const // private
+{
+  const real_t* m = _meanVect.getArray();
+  real_t tmp = 0.0;
+  unsigned long i, j;
+  if (_cholDefined) // squared norm of L'*(x-mean)
+  {
+    const real_t* l = _cholVect.getArray();
+    for (j=0; j<_vectSize; j++)
+    {
+      const real_t y = DistribKernel::computeDotDiff(l, f+j, m+j,
+                                                     _vectSize-j);
+      tmp += y * y;
+      l += _vectSize-j;
+    }
+    return tmp;
+  }
+  const real_t* c = _covInvMatr.getArray();
+  for (i=0; i<_vectSize; i++)
+  {
+    real_t tmp2 = 0.0;
+    const real_t* ci = c+i*_vectSize;
+    for (j=0; j<_vectSize; j++)
+      tmp2 += (f[j] - m[j]) * ci[j];
+    tmp += tmp2 * (f[i] - m[i]);
+  }
+  return tmp;
+}
+//-------------------------------------------------------------------------
+// Cholesky decomposition covInv = L*L'. Column j of L (rows j to
+// vectSize-1) is stored at index j*vectSize-j*(j-1)/2 of _cholVect
+//-------------------------------------------------------------------------
+void DistribGF::updateCholesky() const
+{
+  if (_cholUpToDate)
+    return;
+  const unsigned long n = _vectSize;
+  const real_t* c = _covInvMatr.getArray();
+  real_t* l = _cholVect.getArray();
+  unsigned long i, j, k;
+  _cholDefined = true;
+  for (j=0; j<n && _cholDefined; j++)
+  {
+    real_t* lj = l+j*n-j*(j-1)/2; // L(j,j)
+    for (i=j; i<n; i++)
+    {
+      real_t s = c[i+j*n];
+      for (k=0; k<j; k++)
+      {
+        const real_t* lk = l+k*n-k*(k-1)/2-k; // L(k,k) - k
+        s -= lk[i] * lk[j];
+      }
+      if (i == j)
+      {
+        if (!(s > 0.0)) // not positive definite or NaN
+        {
+          _cholDefined = false;
+          break;
+        }
+        lj[0] = sqrt(s);
+      }
+      else
+        lj[i-j] = s / lj[0];
+    }
+  }
+  _cholUpToDate = true;
+}
+//-------------------------------------------------------------------------
 void DistribGF::computeAll()
 {
+  incrementVersion();
+
   // compute det and cov inv --------------------------------
 
   _det = _covMatr.invert(_covInvMatr);
+  _cholUpToDate = false;
+  updateCholesky();
 
   // compute cst -------------------------------
 
@@ -242,7 +311,7 @@ void DistribGF::setCov(real_t v, unsigned long col, unsigned long row)
 //-------------------------------------------------------------------------
 void DistribGF::setCovInv(const K&, const real_t v, const unsigned long col,
                                                    const  unsigned long row)
-{ _covInvMatr(col, row) = v; }
+{ incrementVersion(); _cholUpToDate = false; _covInvMatr(col, row) = v; }
 //-------------------------------------------------------------------------
 real_t DistribGF::getCov(unsigned long col, unsigned long row) const
 {
@@ -254,7 +323,10 @@ real_t DistribGF::getCovInv(const unsigned long col,
                             const unsigned long row) const
 { return _covInvMatr(col, row); }
 //-------------------------------------------------------------------------
-DoubleSquareMatrix& DistribGF::getCovInvMatrix() {return _covInvMatr;}
+DoubleSquareMatrix& DistribGF::getCovInvMatrix() { return _covInvMatr; }
+//-------------------------------------------------------------------------
+void DistribGF::markModified()
+{ Distrib::markModified(); _cholUpToDate = false; }
 //-------------------------------------------------------------------------
 const DoubleSquareMatrix& DistribGF::getCovInvMatrix() const {return _covInvMatr;}
 //-------------------------------------------------------------------------
@@ -0,0 +1,701 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_DistribKernel_cpp)
+#define ALIZE_DistribKernel_cpp
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define ALIZE_KERNEL_X86
+  #define ALIZE_TARGET(x) __attribute__((target(x)))
+  #include <cpuid.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  #define ALIZE_KERNEL_X86
+  #define ALIZE_TARGET(x)
+  #include <intrin.h>
+#endif
+
+#if defined(ALIZE_KERNEL_X86)
+  #include <immintrin.h>
+#endif
+
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#if defined(_WIN32)
+  #include <malloc.h> // for _aligned_malloc()
+#endif
+#include "DistribKernel.h"
+#include "Exception.h"
+
+using namespace alize;
+typedef DistribKernel DK;
+
+DK::WeightedDistFunc DK::_weightedDist = DK::resolveWeightedDist;
+DK::WeightedDistFloatFunc DK::_weightedDistFloat
+                                           = DK::resolveWeightedDistFloat;
+DK::ExpFunc DK::_exp = DK::resolveExp;
+DK::DotDiffFunc DK::_dotDiff = DK::resolveDotDiff;
+DK::InstructionSet DK::_instructionSet = DK::InstructionSet_SCALAR;
+// the kernels are selected when the library is initialized, before any
+// thread can call them. The resolve functions only serve the calls made by
+// the static initializers of other files.
+static const DK::InstructionSet initialInstructionSet
+                                                  = DK::getInstructionSet();
+
+//-------------------------------------------------------------------------
+// portable implementation
+//-------------------------------------------------------------------------
+static real_t weightedDistScalar(const real_t* f, const real_t* m,
+                                 const real_t* c, unsigned long n)
+{
+  real_t tmp = 0.0;
+  for (unsigned long i=0; i<n; i++)
+    tmp += (f[i] - m[i]) * (f[i] - m[i]) * c[i];
+  return tmp;
+}
+//-------------------------------------------------------------------------
+static real_t weightedDistFloatScalar(const float* f, const real_t* m,
+                                      const real_t* c, unsigned long n)
+{
+  real_t tmp = 0.0;
+  for (unsigned long i=0; i<n; i++)
+  {
+    const real_t d = (real_t)f[i] - m[i];
+    tmp += d * d * c[i];
+  }
+  return tmp;
+}
+//-------------------------------------------------------------------------
+static real_t dotDiffScalar(const real_t* a, const real_t* f,
+                            const real_t* m, unsigned long n)
+{
+  real_t tmp = 0.0;
+  for (unsigned long i=0; i<n; i++)
+    tmp += a[i] * (f[i] - m[i]);
+  return tmp;
+}
+//-------------------------------------------------------------------------
+static void expScalar(real_t* v, unsigned long n)
+{
+  for (unsigned long i=0; i<n; i++)
+    v[i] = std::exp(v[i]);
+}
+#if defined(ALIZE_KERNEL_X86)
+//-------------------------------------------------------------------------
+// Vectorized exp : x = k*ln(2) + r with |r| <= ln(2)/2, exp(r) computed
+// with its Taylor series up to r^13 (relative error < 1e-16) and
+// exp(x) = 2^k * exp(r)
+//-------------------------------------------------------------------------
+static const double EXP_LOG2E  = 1.4426950408889634074;
+static const double EXP_LN2_HI = 6.93145751953125e-1;
+static const double EXP_LN2_LO = 1.42860682030941723212e-6;
+static const double EXP_COEF[14] = { 1.0, 1.0, 1.0/2, 1.0/6, 1.0/24,
+  1.0/120, 1.0/720, 1.0/5040, 1.0/40320, 1.0/362880, 1.0/3628800,
+  1.0/39916800, 1.0/479001600, 1.0/6227020800.0 };
+
+//-------------------------------------------------------------------------
+ALIZE_TARGET("sse2")
+static real_t weightedDistSSE2(const real_t* f, const real_t* m,
+                               const real_t* c, unsigned long n)
+{
+  __m128d acc0 = _mm_setzero_pd();
+  __m128d acc1 = _mm_setzero_pd();
+  unsigned long i = 0;
+  for (; i+4<=n; i+=4)
+  {
+    __m128d d0 = _mm_sub_pd(_mm_loadu_pd(f+i), _mm_loadu_pd(m+i));
+    __m128d d1 = _mm_sub_pd(_mm_loadu_pd(f+i+2), _mm_loadu_pd(m+i+2));
+    acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_mul_pd(d0, d0),
+                                       _mm_loadu_pd(c+i)));
+    acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_mul_pd(d1, d1),
+                                       _mm_loadu_pd(c+i+2)));
+  }
+  acc0 = _mm_add_pd(acc0, acc1);
+  acc0 = _mm_add_sd(acc0, _mm_unpackhi_pd(acc0, acc0));
+  real_t tmp = _mm_cvtsd_f64(acc0);
+  for (; i<n; i++)
+    tmp += (f[i] - m[i]) * (f[i] - m[i]) * c[i];
+  return tmp;
+}
+//-------------------------------------------------------------------------
+ALIZE_TARGET("sse2")
+static real_t weightedDistFloatSSE2(const float* f, const real_t* m,
+                                    const real_t* c, unsigned long n)
+{
+  __m128d acc0 = _mm_setzero_pd();
+  __m128d acc1 = _mm_setzero_pd();
+  unsigned long i = 0;
+  for (; i+4<=n; i+=4)
+  {
+    const __m128 x = _mm_loadu_ps(f+i);
+    __m128d d0 = _mm_sub_pd(_mm_cvtps_pd(x), _mm_loadu_pd(m+i));
+    __m128d d1 = _mm_sub_pd(_mm_cvtps_pd(_mm_movehl_ps(x, x)),
+                            _mm_loadu_pd(m+i+2));
+    acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_mul_pd(d0, d0),
+                                       _mm_loadu_pd(c+i)));
+    acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_mul_pd(d1, d1),
+                                       _mm_loadu_pd(c+i+2)));
+  }
+  acc0 = _mm_add_pd(acc0, acc1);
+  acc0 = _mm_add_sd(acc0, _mm_unpackhi_pd(acc0, acc0));
+  real_t tmp = _mm_cvtsd_f64(acc0);
+  for (; i<n; i++)
+    tmp += ((real_t)f[i] - m[i]) * ((real_t)f[i] - m[i]) * c[i];
+  return tmp;
+}
+//-------------------------------------------------------------------------
+ALIZE_TARGET("sse2")
+static real_t dotDiffSSE2(const real_t* a, const real_t* f,
+                          const real_t* m, unsigned long n)
+{
+  __m128d acc0 = _mm_setzero_pd();
+  __m128d acc1 = _mm_setzero_pd();
+  unsigned long i = 0;
+  for (; i+4<=n; i+=4)
+  {
+    __m128d d0 = _mm_sub_pd(_mm_loadu_pd(f+i), _mm_loadu_pd(m+i));
+    __m128d d1 = _mm_sub_pd(_mm_loadu_pd(f+i+2), _mm_loadu_pd(m+i+2));
+    acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(a+i), d0));
+    acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_loadu_pd(a+i+2), d1));
+  }
+  acc0 = _mm_add_pd(acc0, acc1);
+  acc0 = _mm_add_sd(acc0, _mm_unpackhi_pd(acc0, acc0));
+  real_t tmp = _mm_cvtsd_f64(acc0);
+  for (; i<n; i++)
+    tmp += a[i] * (f[i] - m[i]);
+  return tmp;
+}
+//-------------------------------------------------------------------------
+ALIZE_TARGET("avx2,fma")
+static inline real_t horizontalSumAVX(__m256d v)
+{
+  __m128d s = _mm_add_pd(_mm256_castpd256_pd128(v),
+                         _mm256_extractf128_pd(v, 1));
+  s = _mm_add_sd(s, _mm_unpackhi_pd(s, s));
+  return _mm_cvtsd_f64(s);
+}
+//-------------------------------------------------------------------------
+// AVX2 + FMA implementation (4 doubles per register)
+//-------------------------------------------------------------------------
+ALIZE_TARGET("avx2,fma")
+static real_t weightedDistAVX2(const real_t* f, const real_t* m,
+                               const real_t* c, unsigned long n)
+{
+  __m256d acc0 = _mm256_setzero_pd();
+  __m256d acc1 = _mm256_setzero_pd();
+  unsigned long i = 0;
+  for (; i+8<=n; i+=8)
+  {
+    __m256d d0 = _mm256_sub_pd(_mm256_loadu_pd(f+i), _mm256_loadu_pd(m+i));
+    __m256d d1 = _mm256_sub_pd(_mm256_loadu_pd(f+i+4),
+                               _mm256_loadu_pd(m+i+4));
+    acc0 = _mm256_fmadd_pd(_mm256_mul_pd(d0, d0), _mm256_loadu_pd(c+i),
+                           acc0);
+    acc1 = _mm256_fmadd_pd(_mm256_mul_pd(d1, d1), _mm256_loadu_pd(c+i+4),
+                           acc1);
+  }
+  if (i+4<=n)
+  {
+    __m256d d0 = _mm256_sub_pd(_mm256_loadu_pd(f+i), _mm256_loadu_pd(m+i));
+    acc0 = _mm256_fmadd_pd(_mm256_mul_pd(d0, d0), _mm256_loadu_pd(c+i),
+                           acc0);
+    i += 4;
+  }
+  real_t tmp = horizontalSumAVX(_mm256_add_pd(acc0, acc1));
+  for (; i<n; i++)
+    tmp += (f[i] - m[i]) * (f[i] - m[i]) * c[i];
+  return tmp;
+}
+//-------------------------------------------------------------------------
+ALIZE_TARGET("avx2,fma")
+static real_t weightedDistFloatAVX2(const float* f, const real_t* m,
+                                    const real_t* c, unsigned long n)
+{
+  __m256d acc0 = _mm256_setzero_pd();
+  __m256d acc1 = _mm256_setzero_pd();
+  unsigned long i = 0;
+  for (; i+8<=n; i+=8)
+  {
+    const __m256 x = _mm256_loadu_ps(f+i);
+    __m256d d0 = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(x)),
+                               _mm256_loadu_pd(m+i));
+    __m256d d1 = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(x, 1)),
+                               _mm256_loadu_pd(m+i+4));
+    acc0 = _mm256_fmadd_pd(_mm256_mul_pd(d0, d0), _mm256_loadu_pd(c+i),
+                           acc0);
+    acc1 = _mm256_fmadd_pd(_mm256_mul_pd(d1, d1), _mm256_loadu_pd(c+i+4),
+                           acc1);
+  }
+  if (i+4<=n)
+  {
+    __m256d d0 = _mm256_sub_pd(_mm256_cvtps_pd(_mm_loadu_ps(f+i)),
+                               _mm256_loadu_pd(m+i));
+    acc0 = _mm256_fmadd_pd(_mm256_mul_pd(d0, d0), _mm256_loadu_pd(c+i),
+                           acc0);
+    i += 4;
+  }
+  real_t tmp = horizontalSumAVX(_mm256_add_pd(acc0, acc1));
+  for (; i<n; i++)
+    tmp += ((real_t)f[i] - m[i]) * ((real_t)f[i] - m[i]) * c[i];
+  return tmp;
+}
+//-------------------------------------------------------------------------
+ALIZE_TARGET("avx2,fma")
+static real_t dotDiffAVX2(const real_t* a, const real_t* f,
+                          const real_t* m, unsigned long n)
+{
+  __m256d acc0 = _mm256_setzero_pd();
+  __m256d acc1 = _mm256_setzero_pd();
+  unsigned long i = 0;
+  for (; i+8<=n; i+=8)
+  {
+    __m256d d0 = _mm256_sub_pd(_mm256_loadu_pd(f+i), _mm256_loadu_pd(m+i));
+    __m256d d1 = _mm256_sub_pd(_mm256_loadu_pd(f+i+4),
+                               _mm256_loadu_pd(m+i+4));
+    acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(a+i), d0, acc0);
+    acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(a+i+4), d1, acc1);
+  }
+  if (i+4<=n)
+  {
+    __m256d d0 = _mm256_sub_pd(_mm256_loadu_pd(f+i), _mm256_loadu_pd(m+i));
+    acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(a+i), d0, acc0);
+    i += 4;
+  }
+  real_t tmp = horizontalSumAVX(_mm256_add_pd(acc0, acc1));
+  for (; i<n; i++)
+    tmp += a[i] * (f[i] - m[i]);
+  return tmp;
+}
+//-------------------------------------------------------------------------
+// AVX-512 implementation (8 doubles per register, masked tail)
+//-------------------------------------------------------------------------
+ALIZE_TARGET("avx512f,avx2,fma")
+static real_t weightedDistAVX512(const real_t* f, const real_t* m,
+                                 const real_t* c, unsigned long n)
+{
+  __m512d acc0 = _mm512_setzero_pd();
+  __m512d acc1 = _mm512_setzero_pd();
+  unsigned long i = 0;
+  for (; i+16<=n; i+=16)
+  {
+    __m512d d0 = _mm512_sub_pd(_mm512_loadu_pd(f+i), _mm512_loadu_pd(m+i));
+    __m512d d1 = _mm512_sub_pd(_mm512_loadu_pd(f+i+8),
+                               _mm512_loadu_pd(m+i+8));
+    acc0 = _mm512_fmadd_pd(_mm512_mul_pd(d0, d0), _mm512_loadu_pd(c+i),
+                           acc0);
+    acc1 = _mm512_fmadd_pd(_mm512_mul_pd(d1, d1), _mm512_loadu_pd(c+i+8),
+                           acc1);
+  }
+  for (; i<n; i+=8)
+  {
+    __mmask8 k = (__mmask8)(n-i >= 8 ? 0xFF : (1u << (n-i)) - 1);
+    __m512d d0 = _mm512_sub_pd(_mm512_maskz_loadu_pd(k, f+i),
+                               _mm512_maskz_loadu_pd(k, m+i));
+    acc0 = _mm512_fmadd_pd(_mm512_mul_pd(d0, d0),
+                           _mm512_maskz_loadu_pd(k, c+i), acc0);
+  }
+  real_t t[8];
+  _mm512_storeu_pd(t, _mm512_add_pd(acc0, acc1));
+  return ((t[0]+t[4]) + (t[2]+t[6])) + ((t[1]+t[5]) + (t[3]+t[7]));
+}
+//-------------------------------------------------------------------------
+ALIZE_TARGET("avx512f,avx2,fma")
+static real_t weightedDistFloatAVX512(const float* f, const real_t* m,
+                                      const real_t* c, unsigned long n)
+{
+  __m512d acc0 = _mm512_setzero_pd();
+  __m512d acc1 = _mm512_setzero_pd();
+  unsigned long i = 0;
+  // maskz conversions : the unmasked one reads an undefined register and
+  // makes gcc warn
+  for (; i+16<=n; i+=16)
+  {
+    __m512d d0 = _mm512_sub_pd(_mm512_maskz_cvtps_pd(0xFF,
+                   _mm256_loadu_ps(f+i)), _mm512_loadu_pd(m+i));
+    __m512d d1 = _mm512_sub_pd(_mm512_maskz_cvtps_pd(0xFF,
+                   _mm256_loadu_ps(f+i+8)), _mm512_loadu_pd(m+i+8));
+    acc0 = _mm512_fmadd_pd(_mm512_mul_pd(d0, d0), _mm512_loadu_pd(c+i),
+                           acc0);
+    acc1 = _mm512_fmadd_pd(_mm512_mul_pd(d1, d1), _mm512_loadu_pd(c+i+8),
+                           acc1);
+  }
+  for (; i<n; i+=8)
+  {
+    __mmask8 k = (__mmask8)(n-i >= 8 ? 0xFF : (1u << (n-i)) - 1);
+    float r[8] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    for (unsigned long j=i; j<n && j<i+8; j++) // no read past the end
+      r[j-i] = f[j];
+    __m512d d0 = _mm512_sub_pd(_mm512_maskz_cvtps_pd(k, _mm256_loadu_ps(r)),
+                               _mm512_maskz_loadu_pd(k, m+i));
+    acc0 = _mm512_fmadd_pd(_mm512_mul_pd(d0, d0),
+                           _mm512_maskz_loadu_pd(k, c+i), acc0);
+  }
+  real_t t[8];
+  _mm512_storeu_pd(t, _mm512_add_pd(acc0, acc1));
+  return ((t[0]+t[4]) + (t[2]+t[6])) + ((t[1]+t[5]) + (t[3]+t[7]));
+}
+//-------------------------------------------------------------------------
+ALIZE_TARGET("avx512f,avx2,fma")
+static real_t dotDiffAVX512(const real_t* a, const real_t* f,
+                            const real_t* m, unsigned long n)
+{
+  __m512d acc0 = _mm512_setzero_pd();
+  __m512d acc1 = _mm512_setzero_pd();
+  unsigned long i = 0;
+  for (; i+16<=n; i+=16)
+  {
+    __m512d d0 = _mm512_sub_pd(_mm512_loadu_pd(f+i), _mm512_loadu_pd(m+i));
+    __m512d d1 = _mm512_sub_pd(_mm512_loadu_pd(f+i+8),
+                               _mm512_loadu_pd(m+i+8));
+    acc0 = _mm512_fmadd_pd(_mm512_loadu_pd(a+i), d0, acc0);
+    acc1 = _mm512_fmadd_pd(_mm512_loadu_pd(a+i+8), d1, acc1);
+  }
+  for (; i<n; i+=8)
+  {
+    __mmask8 k = (__mmask8)(n-i >= 8 ? 0xFF : (1u << (n-i)) - 1);
+    __m512d d0 = _mm512_sub_pd(_mm512_maskz_loadu_pd(k, f+i),
+                               _mm512_maskz_loadu_pd(k, m+i));
+    acc0 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(k, a+i), d0, acc0);
+  }
+  real_t t[8];
+  _mm512_storeu_pd(t, _mm512_add_pd(acc0, acc1));
+  return ((t[0]+t[4]) + (t[2]+t[6])) + ((t[1]+t[5]) + (t[3]+t[7]));
+}
+//-------------------------------------------------------------------------
+// exp() with AVX2 + FMA. Results below exp(-708) are set to 0 and
+// arguments above 709 are saturated
+//-------------------------------------------------------------------------
+ALIZE_TARGET("avx2,fma")
+static void expAVX2(real_t* v, unsigned long n)
+{
+  const __m256d lo = _mm256_set1_pd(-708.0);
+  const __m256d hi = _mm256_set1_pd(709.0);
+  unsigned long i = 0;
+  for (; i+4<=n; i+=4)
+  {
+    __m256d x = _mm256_loadu_pd(v+i);
+    __m256d under = _mm256_cmp_pd(x, lo, _CMP_LT_OQ);
+    x = _mm256_min_pd(hi, _mm256_max_pd(lo, x)); // NaN is kept
+    __m256d k = _mm256_round_pd(_mm256_mul_pd(x,
+                  _mm256_set1_pd(EXP_LOG2E)),
+                  _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d r = _mm256_fnmadd_pd(k, _mm256_set1_pd(EXP_LN2_HI), x);
+    r = _mm256_fnmadd_pd(k, _mm256_set1_pd(EXP_LN2_LO), r);
+    __m256d p = _mm256_set1_pd(EXP_COEF[13]);
+    for (int j=12; j>=0; j--)
+      p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(EXP_COEF[j]));
+    __m256i e = _mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(k));
+    e = _mm256_slli_epi64(_mm256_add_epi64(e, _mm256_set1_epi64x(1023)),
+                          52);
+    p = _mm256_mul_pd(p, _mm256_castsi256_pd(e));
+    _mm256_storeu_pd(v+i, _mm256_andnot_pd(under, p));
+  }
+  for (; i<n; i++)
+    v[i] = (v[i] < -708.0 ? 0.0 : std::exp(v[i]));
+}
+//-------------------------------------------------------------------------
+// exp() with AVX-512 (masked tail, 2^k applied with scalef)
+//-------------------------------------------------------------------------
+ALIZE_TARGET("avx512f,avx2,fma")
+static void expAVX512(real_t* v, unsigned long n)
+{
+  const __m512d lo = _mm512_set1_pd(-746.0); // exp(-746) == 0
+  const __m512d hi = _mm512_set1_pd(710.0);  // exp(710) == inf
+  for (unsigned long i=0; i<n; i+=8)
+  {
+    __mmask8 m = (__mmask8)(n-i >= 8 ? 0xFF : (1u << (n-i)) - 1);
+    __m512d x = _mm512_maskz_loadu_pd(m, v+i);
+    // maskz versions of the intrinsics : the unmasked ones read an
+    // undefined register and make gcc warn
+    x = _mm512_maskz_min_pd(0xFF, hi, _mm512_maskz_max_pd(0xFF, lo, x));
+    __m512d k = _mm512_maskz_roundscale_pd(0xFF, _mm512_mul_pd(x,
+                  _mm512_set1_pd(EXP_LOG2E)),
+                  _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m512d r = _mm512_fnmadd_pd(k, _mm512_set1_pd(EXP_LN2_HI), x);
+    r = _mm512_fnmadd_pd(k, _mm512_set1_pd(EXP_LN2_LO), r);
+    __m512d p = _mm512_set1_pd(EXP_COEF[13]);
+    for (int j=12; j>=0; j--)
+      p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(EXP_COEF[j]));
+    _mm512_mask_storeu_pd(v+i, m, _mm512_maskz_scalef_pd(0xFF, p, k));
+  }
+}
+//-------------------------------------------------------------------------
+static void cpuid(unsigned int leaf, unsigned int subLeaf, unsigned int r[4])
+{
+#if defined(_MSC_VER)
+  int info[4];
+  __cpuidex(info, (int)leaf, (int)subLeaf);
+  for (int i=0; i<4; i++)
+    r[i] = (unsigned int)info[i];
+#else
+  __cpuid_count(leaf, subLeaf, r[0], r[1], r[2], r[3]);
+#endif
+}
+//-------------------------------------------------------------------------
+// returns the register states enabled by the operating system
+static unsigned long long xgetbv0()
+{
+#if defined(_MSC_VER)
+  return _xgetbv(0);
+#else
+  unsigned int eax, edx;
+  __asm__ __volatile__ ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return ((unsigned long long)edx << 32) | eax;
+#endif
+}
+#endif // defined(ALIZE_KERNEL_X86)
+//-------------------------------------------------------------------------
+DK::InstructionSet DK::detectInstructionSet() // private
+{
+#if defined(ALIZE_KERNEL_X86)
+  unsigned int r[4];
+  cpuid(0, 0, r);
+  const unsigned int maxLeaf = r[0];
+  if (maxLeaf < 1)
+    return InstructionSet_SCALAR;
+  cpuid(1, 0, r);
+  const bool sse2    = (r[3] & (1u << 26)) != 0;
+  const bool fma     = (r[2] & (1u << 12)) != 0;
+  const bool osxsave = (r[2] & (1u << 27)) != 0;
+  const bool avx     = (r[2] & (1u << 28)) != 0;
+  if (!sse2)
+    return InstructionSet_SCALAR;
+  if (!osxsave || !avx || !fma || maxLeaf < 7)
+    return InstructionSet_SSE2;
+  const unsigned long long xcr0 = xgetbv0();
+  if ((xcr0 & 0x6) != 0x6) // XMM and YMM states
+    return InstructionSet_SSE2;
+  cpuid(7, 0, r);
+  const bool avx2    = (r[1] & (1u << 5)) != 0;
+  const bool avx512f = (r[1] & (1u << 16)) != 0;
+  if (!avx2)
+    return InstructionSet_SSE2;
+  if (avx512f && (xcr0 & 0xE6) == 0xE6) // opmask and ZMM states
+    return InstructionSet_AVX512;
+  return InstructionSet_AVX2;
+#else
+  return InstructionSet_SCALAR;
+#endif
+}
+//-------------------------------------------------------------------------
+bool DK::isSupported(InstructionSet s)
+{
+  static const InstructionSet best = detectInstructionSet();
+  return s <= best;
+}
+//-------------------------------------------------------------------------
+void DK::setInstructionSet(InstructionSet s)
+{
+  if (!isSupported(s))
+    throw Exception("Instruction set " + getInstructionSetName(s)
+                    + " not supported by the processor", __FILE__, __LINE__);
+  switch (s)
+  {
+#if defined(ALIZE_KERNEL_X86)
+    case InstructionSet_AVX512:
+      _weightedDist = weightedDistAVX512;
+      _weightedDistFloat = weightedDistFloatAVX512;
+      _dotDiff = dotDiffAVX512;
+      _exp = expAVX512;
+      break;
+    case InstructionSet_AVX2:
+      _weightedDist = weightedDistAVX2;
+      _weightedDistFloat = weightedDistFloatAVX2;
+      _dotDiff = dotDiffAVX2;
+      _exp = expAVX2;
+      break;
+    case InstructionSet_SSE2:
+      _weightedDist = weightedDistSSE2;
+      _weightedDistFloat = weightedDistFloatSSE2;
+      _dotDiff = dotDiffSSE2;
+      _exp = expScalar;
+      break;
+#endif
+    default:
+      _weightedDist = weightedDistScalar;
+      _weightedDistFloat = weightedDistFloatScalar;
+      _dotDiff = dotDiffScalar;
+      _exp = expScalar;
+  }
+  _instructionSet = s;
+}
+//-------------------------------------------------------------------------
+DK::InstructionSet DK::getInstructionSet()
+{
+  if (_weightedDist == resolveWeightedDist)
+    setInstructionSet(detectInstructionSet());
+  return _instructionSet;
+}
+//-------------------------------------------------------------------------
+real_t DK::resolveWeightedDist(const real_t* f, const real_t* m,
+                               const real_t* c, unsigned long n) // private
+{
+  getInstructionSet();
+  return _weightedDist(f, m, c, n);
+}
+//-------------------------------------------------------------------------
+real_t DK::computeWeightedDist(const real_t* f, const real_t* m,
+                               const real_t* c, unsigned long n)
+{ return _weightedDist(f, m, c, n); }
+//-------------------------------------------------------------------------
+real_t DK::resolveWeightedDistFloat(const float* f, const real_t* m,
+                               const real_t* c, unsigned long n) // private
+{
+  getInstructionSet();
+  return _weightedDistFloat(f, m, c, n);
+}
+//-------------------------------------------------------------------------
+real_t DK::computeWeightedDist(const float* f, const real_t* m,
+                               const real_t* c, unsigned long n)
+{ return _weightedDistFloat(f, m, c, n); }
+//-------------------------------------------------------------------------
+real_t DK::resolveDotDiff(const real_t* a, const real_t* f,
+                          const real_t* m, unsigned long n) // private
+{
+  getInstructionSet();
+  return _dotDiff(a, f, m, n);
+}
+//-------------------------------------------------------------------------
+real_t DK::computeDotDiff(const real_t* a, const real_t* f,
+                          const real_t* m, unsigned long n)
+{ return _dotDiff(a, f, m, n); }
+//-------------------------------------------------------------------------
+void DK::resolveExp(real_t* v, unsigned long n) // private
+{
+  getInstructionSet();
+  _exp(v, n);
+}
+//-------------------------------------------------------------------------
+void DK::computeExp(real_t* v, unsigned long n) { _exp(v, n); }
+//-------------------------------------------------------------------------
+bool DK::isFinite(real_t x) // static
+{
+  unsigned long long b; // IEEE 754 double
+  memcpy(&b, &x, sizeof(b));
+  return (b & 0x7ff0000000000000ULL) != 0x7ff0000000000000ULL;
+}
+//-------------------------------------------------------------------------
+bool DK::isNaN(real_t x) // static
+{
+  unsigned long long b;
+  memcpy(&b, &x, sizeof(b));
+  return (b & 0x7fffffffffffffffULL) > 0x7ff0000000000000ULL;
+}
+//-------------------------------------------------------------------------
+real_t DK::computeLogSumExp(real_t* v, unsigned long n)
+{
+  if (n == 0)
+    return -HUGE_VAL;
+  unsigned long i;
+  real_t max = v[0];
+  for (i=1; i<n; i++)
+    if (v[i] > max)
+      max = v[i];
+  if (!isFinite(max)) // -inf when all the values are -inf
+  {
+    for (i=0; i<n; i++)
+      v[i] = 0.0;
+    return max;
+  }
+  for (i=0; i<n; i++)
+    v[i] -= max;
+  _exp(v, n);
+  real_t sum = 0.0;
+  for (i=0; i<n; i++)
+    sum += v[i];
+  return max + std::log(sum);
+}
+//-------------------------------------------------------------------------
+String DK::getInstructionSetName(InstructionSet s)
+{
+  if (s == InstructionSet_SSE2)
+    return "SSE2";
+  if (s == InstructionSet_AVX2)
+    return "AVX2";
+  if (s == InstructionSet_AVX512)
+    return "AVX512";
+  return "SCALAR";
+}
+//-------------------------------------------------------------------------
+real_t* DK::allocArray(unsigned long n)
+{
+  const size_t size = (n==0?1:n)*sizeof(real_t);
+  void* p = NULL;
+#if defined(_WIN32)
+  p = _aligned_malloc(size, 64);
+#else
+  if (posix_memalign(&p, 64, size) != 0)
+    p = NULL;
+#endif
+  Object::assertMemoryIsAllocated(p, __FILE__, __LINE__);
+  return static_cast<real_t*>(p);
+}
+//-------------------------------------------------------------------------
+void DK::freeArray(real_t* p)
+{
+#if defined(_WIN32)
+  _aligned_free(p);
+#else
+  free(p);
+#endif
+}
+//-------------------------------------------------------------------------
+unsigned long DK::getPaddedSize(unsigned long n)
+{
+  const unsigned long line = 64/sizeof(real_t);
+  return (n+line-1)/line*line;
+}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_DistribKernel_cpp)
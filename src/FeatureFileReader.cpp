@@ -170,6 +170,34 @@ bool R::readFeature(Feature& f, unsigned long step)
   return ok;
 }
 //-------------------------------------------------------------------------
+bool R::readFeature(FeatureView& v, unsigned long step)
+{
+  if (_pFeatureReader == NULL)
+    return false;
+  if (_seekWanted)
+  {
+    _seekWanted = false;
+    _pFeatureReader->seekFeature(_seekWantedIdx, _seekWantedSrcName);
+  }
+  bool ok = _pFeatureReader->readFeature(v, step);
+  _error = _pFeatureReader->getError();
+  return ok;
+}
+//-------------------------------------------------------------------------
+unsigned long R::readFeatures(FrameBlock& b, unsigned long maxFrames)
+{
+  if (_pFeatureReader == NULL)
+    return 0;
+  if (_seekWanted)
+  {
+    _seekWanted = false;
+    _pFeatureReader->seekFeature(_seekWantedIdx, _seekWantedSrcName);
+  }
+  unsigned long n = _pFeatureReader->readFeatures(b, maxFrames);
+  _error = _pFeatureReader->getError();
+  return n;
+}
+//-------------------------------------------------------------------------
 bool R::addFeature(const Feature& f)
 {
   if (_pFeatureReader == NULL)
@@ -93,6 +93,12 @@ void R::setExternalBufferToUse(FloatVector& v)
     __FILE__, __LINE__);
 }
 //-------------------------------------------------------------------------
+bool R::readFeature(FeatureView& v, unsigned long step)
+{
+  throw Exception("Forbidden method for this kind of object",
+    __FILE__, __LINE__);
+}
+//-------------------------------------------------------------------------
 R::~FeatureFileReaderAbstract() {}
 //-------------------------------------------------------------------------
 
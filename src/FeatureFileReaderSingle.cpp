@@ -56,7 +56,13 @@
 #define ALIZE_FeatureFileReaderSingle_cpp
 
 #include <new>
+#include <cstring>
+#if defined(THREAD) && !defined(_WIN32)
+#include <pthread.h>
+#endif
 #include "FeatureFileReaderSingle.h"
+#include "FeatureView.h"
+#include "FrameBlock.h"
 #include "FileReader.h"
 #include "Exception.h"
 #include "LabelServer.h"
@@ -71,6 +77,25 @@
 using namespace alize;
 typedef FeatureFileReaderSingle R;
 
+struct R::Prefetch
+{
+#if defined(THREAD) && !defined(_WIN32)
+  pthread_t     thread;
+#endif
+  FileReader*   pReader;
+  FloatVector*  pBuffer;
+  unsigned long vectSize;
+  unsigned long start;     // index of the first feature of the block
+  unsigned long nbStored;
+  bool          running;   // the thread reads the file
+  bool          loaded;    // the block is ready
+  bool          moved;     // the file is not positioned after _pBuffer
+  bool          failed;
+  String        errorMsg;
+  String        errorSourceFile;
+  int           errorLine;
+};
+
 //-------------------------------------------------------------------------
 R::FeatureFileReaderSingle(FileReader* r, FeatureInputStream* st, 
                            const Config& c, LabelServer* p,
@@ -79,9 +104,36 @@ R::FeatureFileReaderSingle(FileReader* r, FeatureInputStream* st,
 :FeatureFileReaderAbstract(NULL, c, p, b, bufferSize, h, historicSize),
  _pReader(r), _pFeatureInputStream(st), _pFeature(NULL), _featureIndex(0),
  _lastFeatureIndex(0),
- _featureIndexOfBuffer(0), _nbStored(0), _pBuffer(&FloatVector::create())
+ _featureIndexOfBuffer(0), _nbStored(0), _pBuffer(&FloatVector::create()),
+ _mapTried(false), _pMappedData(NULL), _pPrefetch(NULL)
 {}
 //-------------------------------------------------------------------------
+// Converts the float values of a frame. The values are read with memcpy()
+// because the header of SPro files does not keep the frames of a mapped
+// file aligned, and are swapped on the fly when the byte order of the
+// file differs.
+static void copyFloats(real_t* d, const char* p, unsigned long vectSize,
+                       bool swap)
+{
+  float v;
+  if (swap)
+  {
+    char b[4];
+    for (unsigned long i=0; i<vectSize; i++, p+=4)
+    {
+      b[0] = p[3]; b[1] = p[2]; b[2] = p[1]; b[3] = p[0];
+      memcpy(&v, b, 4);
+      d[i] = (real_t)v;
+    }
+  }
+  else
+    for (unsigned long i=0; i<vectSize; i++, p+=4)
+    {
+      memcpy(&v, p, 4);
+      d[i] = (real_t)v;
+    }
+}
+//-------------------------------------------------------------------------
 String R::getPath(const FileName& f, const Config& c) const
 {  // protected method
    if (f.beginsWith("/") || f.beginsWith("./"))
@@ -112,12 +164,230 @@ bool R::getBigEndian(const Config& c, BigEndian b) const // protected
 //-------------------------------------------------------------------------
 void R::close()
 {
+  joinPrefetch(); // a loaded block remains usable
   if (_pReader != NULL)
     _pReader->close();
   if (_pFeatureInputStream != NULL)
     _pFeatureInputStream->close();
 }
 //-------------------------------------------------------------------------
+// Loads the block of features around _featureIndex in the buffer
+void R::loadBuffer(unsigned long featureCount) // private
+{
+  if (!_bufferSizeDefined)
+  {
+    unsigned long m = _pBuffer->size();
+    if (_bufferIsInternal)
+    {
+      if (_bufferUsage == BUFFER_USERDEFINE)
+        m = _userDefineBufferSize/sizeof(float);
+      else if (_bufferUsage == BUFFER_AUTO)
+      {
+        if (getConfig().existsParam_loadFeatureFileMemAlloc)
+        {
+          m = getConfig().getParam_loadFeatureFileMemAlloc()/sizeof(float);
+          unsigned long n = featureCount*getVectSize();
+          if (n < m)
+            m = n;
+        }
+      }
+    }
+    // whole features only : the next block is read without seeking
+    m -= m%getVectSize();
+#if defined(THREAD) && !defined(_WIN32)
+    // the memory is shared by the buffer and the block loaded in the
+    // background when the file does not fit in
+    if (_bufferIsInternal && _pReader != NULL && _pPrefetch == NULL
+        && getConfig().getParam_loadFeatureFilePrefetch()
+        && m < featureCount*getVectSize())
+    {
+      m = m/2;
+      m -= m%getVectSize();
+      if (m < getVectSize())
+        m = getVectSize();
+      _pPrefetch = new (std::nothrow) Prefetch;
+      assertMemoryIsAllocated(_pPrefetch, __FILE__, __LINE__);
+      _pPrefetch->pReader = _pReader;
+      _pPrefetch->pBuffer = &FloatVector::create(m, m);
+      _pPrefetch->vectSize = getVectSize();
+      _pPrefetch->start = 0;
+      _pPrefetch->nbStored = 0;
+      _pPrefetch->running = false;
+      _pPrefetch->loaded = false;
+      _pPrefetch->moved = false;
+      _pPrefetch->failed = false;
+      _pPrefetch->errorLine = 0;
+    }
+#endif
+    if (m < getVectSize()) // minimum size
+      m = getVectSize();
+    _pBuffer->setSize(m);
+    _bufferSizeDefined = true;
+  }
+  if (usePrefetch())
+  {
+    startPrefetch(featureCount);
+    return;
+  }
+  unsigned long start = _featureIndex;
+  if (featureCount-_featureIndex < _pBuffer->size()/getVectSize())
+  {
+    unsigned long x = _pBuffer->size()/getVectSize() -
+                      (featureCount-_featureIndex);
+    if (x < _featureIndex)
+      start -= x;
+    else
+      start = 0;
+  }
+  // si le bloc de donnees a charger ne suit pas le bloc deja en memoire
+  // on se repositionne dans le fichier
+  if (start != _featureIndexOfBuffer + _nbStored /*+ 1*/ ||
+      (_pPrefetch != NULL && _pPrefetch->moved)) {
+    if (_pPrefetch != NULL)
+      _pPrefetch->moved = false;
+    if (_pReader != NULL) {
+      _pReader->seek(getHeaderLength() + start*getVectSize()*sizeof(float));
+    }
+    else {
+      _pFeatureInputStream->seekFeature(start);
+    }
+  }
+  // chargement des donnees dans le buffer
+  if (_pReader != NULL)
+    _nbStored = _pReader->readSomeFloats(*_pBuffer)/getVectSize();
+  else
+    _nbStored = loadBufferFromStream(start);
+
+  _featureIndexOfBuffer = start;
+  // if all the features are loaded in the buffer, we close the file
+  if (_nbStored == featureCount)
+    close();
+  else
+    // donnes pas toutes en mmoire -> interdit le writeFeature()
+    _featuresAreWritable = false;
+  startPrefetch(featureCount);
+}
+//-------------------------------------------------------------------------
+unsigned long R::loadBufferFromStream(unsigned long start) // private
+{
+  const unsigned long vectSize = _pFeatureInputStream->getVectSize();
+  const unsigned long max = _pBuffer->size()/vectSize;
+  float* p = _pBuffer->getArray();
+  unsigned long n = 0;
+  while (n < max)
+  {
+    unsigned long wanted = max-n;
+    if (wanted > 1024) // bounds the size of _block
+      wanted = 1024;
+    const unsigned long k = _pFeatureInputStream->readFeatures(_block, wanted);
+    for (unsigned long t=0; t<k; t++, p+=vectSize)
+    {
+      const real_t* src = _block.getFrame(t);
+      for (unsigned long j=0; j<vectSize; j++)
+        p[j] = (float)src[j];
+    }
+    n += k;
+    if (k < wanted) // end of the stream or invalid feature
+    {
+      // the invalid feature has been consumed : the next block read after
+      // this one must not start one feature late
+      _pFeatureInputStream->seekFeature(start+n);
+      break;
+    }
+  }
+  return n;
+}
+//-------------------------------------------------------------------------
+void R::startPrefetch(unsigned long featureCount) // private
+{
+#if defined(THREAD) && !defined(_WIN32)
+  if (_pPrefetch == NULL)
+    return;
+  Prefetch& p = *_pPrefetch;
+  const unsigned long start = _featureIndexOfBuffer + _nbStored;
+  if (p.running || start >= featureCount)
+    return;
+  p.pBuffer->setSize(_pBuffer->size());
+  p.start = start;
+  p.nbStored = 0;
+  p.loaded = false;
+  p.failed = false;
+  if (pthread_create(&p.thread, NULL, prefetchMain, &p) != 0)
+    return; // the next block is loaded by the caller
+  p.running = true;
+  p.moved = true;
+#endif
+}
+//-------------------------------------------------------------------------
+void* R::prefetchMain(void* a) // private static
+{
+  Prefetch& p = *static_cast<Prefetch*>(a);
+  try
+  {
+    p.nbStored = p.pReader->readSomeFloats(*p.pBuffer)/p.vectSize;
+  }
+  catch (Exception& e)
+  {
+    p.failed = true;
+    p.errorMsg = e.msg;
+    p.errorSourceFile = e.sourceFile;
+    p.errorLine = e.line;
+  }
+  catch (...) // must not escape the thread (std::terminate)
+  {
+    p.failed = true;
+    p.errorMsg = "Error while loading the next block of features";
+    p.errorSourceFile = __FILE__;
+    p.errorLine = __LINE__;
+  }
+  return NULL;
+}
+//-------------------------------------------------------------------------
+void R::joinPrefetch() // private
+{
+#if defined(THREAD) && !defined(_WIN32)
+  if (_pPrefetch == NULL || !_pPrefetch->running)
+    return;
+  pthread_join(_pPrefetch->thread, NULL);
+  _pPrefetch->running = false;
+  _pPrefetch->loaded = !_pPrefetch->failed;
+#endif
+}
+//-------------------------------------------------------------------------
+bool R::usePrefetch() // private
+{
+  if (_pPrefetch == NULL)
+    return false;
+  joinPrefetch();
+  Prefetch& p = *_pPrefetch;
+  if (p.failed)
+  {
+    p.failed = false;
+    throw Exception(p.errorMsg, p.errorSourceFile, p.errorLine);
+  }
+  if (!p.loaded || _featureIndex < p.start ||
+      _featureIndex >= p.start + p.nbStored)
+    return false;
+  FloatVector* pBuffer = _pBuffer;
+  _pBuffer = p.pBuffer;
+  p.pBuffer = pBuffer;
+  _featureIndexOfBuffer = p.start;
+  _nbStored = p.nbStored;
+  p.loaded = false;
+  p.moved = false; // the file is positioned after the block
+  return true;
+}
+//-------------------------------------------------------------------------
+void R::deletePrefetch() // private
+{
+  if (_pPrefetch == NULL)
+    return;
+  joinPrefetch();
+  delete _pPrefetch->pBuffer;
+  delete _pPrefetch;
+  _pPrefetch = NULL;
+}
+//-------------------------------------------------------------------------
 bool R::readFeature(Feature& f, unsigned long step)
 {
   assert(_pReader != NULL || _pFeatureInputStream != NULL);
@@ -138,99 +408,155 @@ bool R::readFeature(Feature& f, unsigned long step)
   if (_featureIndex >= featureCount)
     return false;
   // si on demande une feature hors du buffer
-  if (_featureIndex < _featureIndexOfBuffer ||
-      _featureIndex >= _featureIndexOfBuffer + _nbStored)
+  if (!mapFile() && (_featureIndex < _featureIndexOfBuffer ||
+      _featureIndex >= _featureIndexOfBuffer + _nbStored))
   {
-    if (!_bufferSizeDefined)
-    {
-      unsigned long m = _pBuffer->size();
-      if (_bufferIsInternal)
-      {
-        if (_bufferUsage == BUFFER_USERDEFINE)
-          m = _userDefineBufferSize/sizeof(float);
-        else if (_bufferUsage == BUFFER_AUTO)
-        {
-          if (getConfig().existsParam_loadFeatureFileMemAlloc)
-          {
-            m = getConfig().getParam_loadFeatureFileMemAlloc()/sizeof(float);
-            unsigned long n = featureCount*getVectSize();
-            if (n < m)
-              m = n;
-          }
-        }
-      }
-      if (m < getVectSize()) // minimum size
-        m = getVectSize();
-      _pBuffer->setSize(m);
-      _bufferSizeDefined = true;
-    }
-    unsigned long start = _featureIndex;
-    if (featureCount-_featureIndex < _pBuffer->size()/getVectSize())
-    {
-      unsigned long x = _pBuffer->size()/getVectSize() -
-                        (featureCount-_featureIndex);
-      if (x < _featureIndex)
-        start -= x;
-      else
-        start = 0;
-    }
-    // si le bloc de donnees a charger ne suit pas le bloc deja en memoire
-    // on se repositionne dans le fichier
-    if (start != _featureIndexOfBuffer + _nbStored /*+ 1*/) {
-      if (_pReader != NULL) {
-        _pReader->seek(getHeaderLength() + start*getVectSize()*sizeof(float));
-      }
-      else {
-        _pFeatureInputStream->seekFeature(start);
-      }
-    }
-    // chargement des donnees dans le buffer
-    if (_pReader != NULL)
-      _nbStored = _pReader->readSomeFloats(*_pBuffer)/getVectSize();
-    else
-    {
-      // Pas performant. A amliorer
-      _nbStored = 0;
-      unsigned long vectSize = _pFeatureInputStream->getVectSize();
-      while ((_nbStored+1)*vectSize <= _pBuffer->size()
-              && _pFeatureInputStream->readFeature(_f))
-      {
-        unsigned long ii = _nbStored*vectSize;
-        for (unsigned long j=0; j<vectSize; j++)
-          (*_pBuffer)[ii+j] = (float) _f[j];
-        _nbStored++;
-      }
-    }
-
-    _featureIndexOfBuffer = start;
-    // if all the features are loaded in the buffer, we close the file
-    if (_nbStored == featureCount)
-      close();
-    else
-      // donnes pas toutes en mmoire -> interdit le writeFeature()
-      _featuresAreWritable = false;
+    loadBuffer(featureCount);
+    if (_featureIndex < _featureIndexOfBuffer ||
+        _featureIndex >= _featureIndexOfBuffer + _nbStored)
+      return false; // input stream shorter than announced
   }
   f.setVectSize(K::k, getVectSize());
-  f.setData(*_pBuffer, (_featureIndex-_featureIndexOfBuffer)*getVectSize());
+  if (_pMappedData != NULL)
+    copyFloats(f.getDataVector(), _pMappedData
+               + _featureIndex*getVectSize()*sizeof(float), getVectSize(),
+               _pReader->swap());
+  else
+    f.setData(*_pBuffer, (_featureIndex-_featureIndexOfBuffer)*getVectSize());
   f.setValidity(true);
 
   _featureIndex += step;
   if (_featureIndex > _lastFeatureIndex)
     _lastFeatureIndex = _featureIndex;
   if (_pLabelServer != NULL)
+    f.setLabelCode(addSourceLabel());
+  _error = NO_ERROR;
+  return true;
+}
+//-------------------------------------------------------------------------
+bool R::readFeature(FeatureView& v, unsigned long step)
+{
+  assert(_pReader != NULL || _pFeatureInputStream != NULL);
+  if (_seekWanted)
   {
-    Label l;
-    if (_pReader != NULL)
-      l.setSourceName(_pReader->getFileName());
-    else
-      l.setSourceName(_pFeatureInputStream->getNameOfASource(0)); // TODO : not always 0 ?
-    f.setLabelCode(_pLabelServer->addLabel(l));
+    _seekWanted = false;
+    if (_historicUsage == LIMITED && !featureWantedIsInHistoric())
+    {
+      v.setData(NULL, getVectSize());
+      v.setValidity(false);
+      _error = FEATURE_OUT_OF_HISTORY;
+      return true;
+    }
+    _featureIndex = _seekWantedIdx;
+  }
+  unsigned long featureCount = getFeatureCount();
+  if (_featureIndex >= featureCount)
+    return false;
+  // the mapped frames are used in place only if they need no conversion
+  if (mapFile() && (_pReader->swap() ||
+      (size_t)_pMappedData % sizeof(float) != 0))
+    unmapFile();
+  if (!mapFile() && (_featureIndex < _featureIndexOfBuffer ||
+      _featureIndex >= _featureIndexOfBuffer + _nbStored))
+  {
+    loadBuffer(featureCount);
+    if (_featureIndex < _featureIndexOfBuffer ||
+        _featureIndex >= _featureIndexOfBuffer + _nbStored)
+      return false; // input stream shorter than announced
   }
+  const unsigned long vectSize = getVectSize();
+  if (_pMappedData != NULL)
+    v.setData((const float*)_pMappedData + _featureIndex*vectSize,
+              vectSize);
+  else
+    v.setData(_pBuffer->getArray()
+              + (_featureIndex-_featureIndexOfBuffer)*vectSize, vectSize);
+  v.setValidity(true);
+
+  _featureIndex += step;
+  if (_featureIndex > _lastFeatureIndex)
+    _lastFeatureIndex = _featureIndex;
+  if (_pLabelServer != NULL)
+    v.setLabelCode(addSourceLabel());
   _error = NO_ERROR;
   return true;
 }
 //-------------------------------------------------------------------------
+unsigned long R::readFeatures(FrameBlock& b, unsigned long maxFrames)
+{
+  assert(_pReader != NULL || _pFeatureInputStream != NULL);
+  const unsigned long vectSize = getVectSize();
+  b.setVectSize(vectSize);
+  b.clear();
+  if (_seekWanted)
+  {
+    _seekWanted = false;
+    if (_historicUsage == LIMITED && !featureWantedIsInHistoric())
+    {
+      _error = FEATURE_OUT_OF_HISTORY;
+      return 0;
+    }
+    _featureIndex = _seekWantedIdx;
+  }
+  _error = NO_ERROR;
+  const unsigned long featureCount = getFeatureCount();
+  if (_featureIndex >= featureCount)
+    return 0;
+  unsigned long n = featureCount-_featureIndex;
+  if (n > maxFrames)
+    n = maxFrames;
+  b.setFrameCount(n);
+  unsigned long t = 0;
+  while (t < n)
+  {
+    // frames available from _featureIndex, in the mapped file or in the
+    // buffer
+    const char* p;
+    unsigned long count = n-t;
+    bool swap = false;
+    if (mapFile())
+    {
+      p = _pMappedData + _featureIndex*vectSize*sizeof(float);
+      swap = _pReader->swap();
+    }
+    else
+    {
+      if (_featureIndex < _featureIndexOfBuffer ||
+          _featureIndex >= _featureIndexOfBuffer + _nbStored)
+        loadBuffer(featureCount);
+      if (_featureIndex < _featureIndexOfBuffer ||
+          _featureIndex >= _featureIndexOfBuffer + _nbStored)
+        break; // input stream shorter than announced
+      if (count > _featureIndexOfBuffer+_nbStored-_featureIndex)
+        count = _featureIndexOfBuffer+_nbStored-_featureIndex;
+      p = (const char*)(_pBuffer->getArray()
+                        + (_featureIndex-_featureIndexOfBuffer)*vectSize);
+    }
+    for (unsigned long i=0; i<count; i++, t++)
+      copyFloats(b.getFrame(t), p+i*vectSize*sizeof(float), vectSize, swap);
+    _featureIndex += count;
+  }
+  b.setFrameCount(t);
+  if (_featureIndex > _lastFeatureIndex)
+    _lastFeatureIndex = _featureIndex;
+  if (_pLabelServer != NULL && t != 0)
+    addSourceLabel(); // the same label for all the features
+  return t;
+}
+//-------------------------------------------------------------------------
+unsigned long R::addSourceLabel() // private
+{
+  assert(_pLabelServer != NULL);
+  Label l;
+  if (_pReader != NULL)
+    l.setSourceName(_pReader->getFileName());
+  else
+    l.setSourceName(_pFeatureInputStream->getNameOfASource(0)); // TODO : not always 0 ?
+  return _pLabelServer->addLabel(l);
+}
+//-------------------------------------------------------------------------
 bool R::addFeature(const Feature& f) {
+	unmapFile();
 	/* if not yet read --> not charged in memory */
 	if (_nbStored == 0) {
 		Feature tmp;
@@ -259,6 +585,7 @@ bool R::writeFeature(const Feature& f, unsigned long step)
   if (!_featuresAreWritable)
     throw Exception("Feature writing forbidden", __FILE__, __LINE__);
   assert(_pReader != NULL || _pFeatureInputStream != NULL);
+  unmapFile();
   if (_seekWanted)
   {
     _seekWanted = false;
@@ -271,76 +598,14 @@ bool R::writeFeature(const Feature& f, unsigned long step)
   if (_featureIndex >= featureCount)
     return false;
 
-  // si on demande une feature hors du buffer
+  // si on demande une feature hors du buffer : same buffer sizing and
+  // loading as readFeature()
   if (_featureIndex < _featureIndexOfBuffer ||
       _featureIndex >= _featureIndexOfBuffer + _nbStored)
   {
-    if (!_bufferSizeDefined)
-    {
-      unsigned long m = _pBuffer->size();
-      if (_bufferIsInternal)
-      {
-        if (_bufferUsage == BUFFER_USERDEFINE)
-          m = _userDefineBufferSize/sizeof(float);
-        else if (_bufferUsage == BUFFER_AUTO)
-        {
-          if (getConfig().existsParam_loadFeatureFileMemAlloc)
-          {
-            m = getConfig().getParam_loadFeatureFileMemAlloc()/sizeof(float);
-            unsigned long n = featureCount*getVectSize();
-            if (n < m)
-              m = n;
-          }
-        }
-      }
-      if (m < getVectSize()) // minimum size
-        m = getVectSize();
-      _pBuffer->setSize(m);
-      _bufferSizeDefined = true;
-    }
-    unsigned long start = _featureIndex;
-    if (featureCount-_featureIndex < _pBuffer->size()/getVectSize())
-    {
-      unsigned long x = _pBuffer->size()/getVectSize() -
-                        (featureCount-_featureIndex);
-      if (x < _featureIndex)
-        start -= x;
-      else
-        start = 0;
-    }
-    // si le bloc de donnees a charger ne suit pas le bloc deja en memoire
-    // on se repositionne dans le fichier
-    if (start != _featureIndexOfBuffer + _nbStored + 1) {
-      if (_pReader != NULL) {
-        _pReader->seek(getHeaderLength() + start*getVectSize()*sizeof(float));
-      }
-      else {
-        _pFeatureInputStream->seekFeature(start);
-      }
-    }
-    // chargement des donnees dans le buffer
-    if (_pReader != NULL)
-      _nbStored = _pReader->readSomeFloats(*_pBuffer)/getVectSize();
-    else
-    {
-      // Pas performant. A amliorer
-      _nbStored = 0;
-      unsigned long vectSize = _pFeatureInputStream->getVectSize();
-      while ((_nbStored+1)*vectSize <= _pBuffer->size()
-              && _pFeatureInputStream->readFeature(_f))
-      {
-        unsigned long ii = _nbStored*vectSize;
-        for (unsigned long j=0; j<vectSize; j++)
-          (*_pBuffer)[ii+j] = (float) _f[j];
-        _nbStored++;
-      }
-    }
-
-    _featureIndexOfBuffer = start;
-    // if all the features are loaded in the buffer, we close the file
-    if (_nbStored == featureCount)
-      close();
-    else
+    loadBuffer(featureCount);
+    // if all the features are loaded, loadBuffer() has closed the file
+    if (_nbStored != featureCount)
       // donnes pas toutes en mmoire -> interdit le writeFeature()
       throw Exception("Feature writing forbidden (data are not all in memory)"
                       , __FILE__, __LINE__);
@@ -367,8 +632,42 @@ bool R::featureWantedIsInHistoric() const
   return _seekWantedIdx >= _lastFeatureIndex-_historicSize;
 }
 //-------------------------------------------------------------------------
+bool R::mapFile() // private
+{
+  if (_pMappedData != NULL)
+    return true;
+  if (_mapTried)
+    return false;
+  _mapTried = true;
+  if (_pReader == NULL || !getConfig().getParam_loadFeatureFileMemoryMap())
+    return false;
+  const unsigned long headerLength = getHeaderLength();
+  const unsigned long length = headerLength
+                             + getFeatureCount()*getVectSize()*sizeof(float);
+  if (_pReader->getFileLength() < length)
+    return false; // truncated file : the buffer reports the error
+  const char* p = _pReader->map();
+  if (p == NULL)
+    return false;
+  _pMappedData = p + headerLength;
+  _pReader->close(); // the mapping does not need the stream
+  return true;
+}
+//-------------------------------------------------------------------------
+void R::unmapFile() // private
+{
+  if (_pMappedData == NULL)
+    return;
+  _pReader->unmap();
+  _pMappedData = NULL;
+  _featureIndexOfBuffer = 0;
+  _nbStored = 0;
+  _pReader->seek(getHeaderLength()); // the buffer is loaded from here
+}
+//-------------------------------------------------------------------------
 void R::setExternalBufferToUse(FloatVector& v)
 {
+  deletePrefetch();
   if (_bufferIsInternal && _pBuffer != NULL )
     delete _pBuffer;
   _pBuffer = &v;
@@ -462,6 +761,7 @@ String R::toString() const
 //-------------------------------------------------------------------------
 R::~FeatureFileReaderSingle()
 {
+  deletePrefetch(); // before the reader
   if (_pReader != NULL)
     delete _pReader;
   // do not delete _pFeatureInputStream
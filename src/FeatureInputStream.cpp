@@ -58,6 +58,7 @@
 #include "FeatureInputStream.h"
 #include "Exception.h"
 #include "Feature.h"
+#include "FrameBlock.h"
 #include "LabelServer.h"
 #include "Config.h"
 
@@ -94,6 +95,27 @@ bool S::existsConfig() const { return _pConfig != NULL; }
 //-------------------------------------------------------------------------
 S::Error FeatureInputStream::getError() { return _error; }
 //-------------------------------------------------------------------------
+unsigned long S::readFeatures(FrameBlock& b, unsigned long maxFrames)
+{
+  // generic implementation : one readFeature() per feature
+  Feature f(getVectSize());
+  b.setVectSize(f.getVectSize());
+  b.clear();
+  while (b.getFrameCount() < maxFrames && readFeature(f))
+  {
+    if (!f.isValid())
+      break;
+    b.addFeature(f);
+  }
+  return b.getFrameCount();
+}
+//-------------------------------------------------------------------------
+bool S::readFeature(FeatureView& v, unsigned long s)
+{
+  throw Exception("Forbidden method for this kind of object",
+    __FILE__, __LINE__);
+}
+//-------------------------------------------------------------------------
 bool FeatureInputStream::writeFeature(const Feature& f, unsigned long step)
 { throw Exception("Feature writing forbidden", __FILE__, __LINE__); }
 //-------------------------------------------------------------------------
@@ -172,6 +172,33 @@ bool M::readFeature(Feature& f, unsigned long step)
   return ok;
 }
 //-------------------------------------------------------------------------
+unsigned long M::readFeatures(FrameBlock& b, unsigned long maxFrames)
+{
+  if (!_useMask)
+  {
+    unsigned long n = _pInput->readFeatures(b, maxFrames);
+    _error = _pInput->getError();
+    return n;
+  }
+  const unsigned long n = _pInput->readFeatures(_block, maxFrames);
+  _error = _pInput->getError();
+  const unsigned long* selection = _selection.getArray();
+  for (unsigned long i=0; i<_selectionSize; i++)
+    if (selection[i] >= _block.getVectSize())
+      throw Exception("Invalid feature mask : " + _mask,
+                      __FILE__, __LINE__);
+  b.setVectSize(_selectionSize);
+  b.setFrameCount(n);
+  for (unsigned long t=0; t<n; t++)
+  {
+    const real_t* src = _block.getFrame(t);
+    real_t* dst = b.getFrame(t);
+    for (unsigned long i=0; i<_selectionSize; i++)
+      dst[i] = src[selection[i]];
+  }
+  return n;
+}
+//-------------------------------------------------------------------------
 bool M::addFeature(const Feature& f)
 {
   bool ok;
@@ -252,6 +252,24 @@ bool S::readFeature(Feature& f, unsigned long step)
   return ok;
 }
 //-------------------------------------------------------------------------
+bool S::readFeature(FeatureView& v, unsigned long step)
+{
+  if (_pInputStream == NULL)
+    return false;
+  bool ok = inputStream().readFeature(v, step);
+  _error = inputStream().getError();
+  return ok;
+}
+//-------------------------------------------------------------------------
+unsigned long S::readFeatures(FrameBlock& b, unsigned long maxFrames)
+{
+  if (_pInputStream == NULL)
+    return 0;
+  unsigned long n = inputStream().readFeatures(b, maxFrames);
+  _error = inputStream().getError();
+  return n;
+}
+//-------------------------------------------------------------------------
 bool S::addFeature(const Feature& f)
 {
   if (_pInputStream == NULL)
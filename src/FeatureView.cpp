@@ -0,0 +1,139 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_FeatureView_cpp)
+#define ALIZE_FeatureView_cpp
+
+#include "FeatureView.h"
+#include "Feature.h"
+#include "alizeString.h"
+
+using namespace alize;
+typedef FeatureView V;
+
+//-------------------------------------------------------------------------
+V::FeatureView()
+:Object(), _dataVector(NULL), _vectSize(0), _isValid(false),
+ _labelCode(0) {}
+//-------------------------------------------------------------------------
+V::FeatureView(const float* data, unsigned long vectSize)
+:Object(), _dataVector(data), _vectSize(vectSize), _isValid(true),
+ _labelCode(0) {}
+//-------------------------------------------------------------------------
+V::FeatureView(const FeatureView& v)
+:Object(), _dataVector(v._dataVector), _vectSize(v._vectSize),
+ _isValid(v._isValid), _labelCode(v._labelCode) {}
+//-------------------------------------------------------------------------
+const FeatureView& V::operator=(const FeatureView& v)
+{
+  _dataVector = v._dataVector;
+  _vectSize = v._vectSize;
+  _isValid = v._isValid;
+  _labelCode = v._labelCode;
+  return *this;
+}
+//-------------------------------------------------------------------------
+void V::setData(const float* data, unsigned long vectSize)
+{
+  _dataVector = data;
+  _vectSize = vectSize;
+}
+//-------------------------------------------------------------------------
+unsigned long V::getVectSize() const { return _vectSize; }
+//-------------------------------------------------------------------------
+float V::operator[](unsigned long i) const
+{
+  assertIsInBounds(__FILE__, __LINE__, i, _vectSize);
+  assert(_dataVector != NULL);
+  return _dataVector[i];
+}
+//-------------------------------------------------------------------------
+const float* V::getDataVector() const { return _dataVector; }
+//-------------------------------------------------------------------------
+bool V::isValid() const { return _isValid; }
+//-------------------------------------------------------------------------
+void V::setValidity(bool v) { _isValid = v; }
+//-------------------------------------------------------------------------
+unsigned long V::getLabelCode() const { return _labelCode; }
+//-------------------------------------------------------------------------
+void V::setLabelCode(unsigned long v) { _labelCode = v; }
+//-------------------------------------------------------------------------
+void V::copyTo(Feature& f) const
+{
+  f.setVectSize(K::k, _vectSize);
+  Feature::data_t* d = f.getDataVector();
+  for (unsigned long i=0; i<_vectSize; i++)
+    d[i] = (Feature::data_t)_dataVector[i];
+  f.setValidity(_isValid);
+  f.setLabelCode(_labelCode);
+}
+//-------------------------------------------------------------------------
+String V::getClassName() const { return "FeatureView"; }
+//-------------------------------------------------------------------------
+String V::toString() const
+{
+  String s = Object::toString()
+    + "\n  vectSize  = " + String::valueOf(_vectSize)
+    + "\n  valid     = " + String::valueOf(_isValid)
+    + "\n  labelCode = " + String::valueOf(_labelCode);
+  for (unsigned long i=0; i<_vectSize && _dataVector != NULL; i++)
+    s += "\n  [" + String::valueOf(i) + "] = "
+      + String::valueOf(_dataVector[i]);
+  return s;
+}
+//-------------------------------------------------------------------------
+V::~FeatureView() {}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_FeatureView_cpp)
@@ -60,6 +60,14 @@
 #endif
 
 #include <new>
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 #include "FileReader.h"
 #include "Exception.h"
 #include "RealVector.h"
@@ -73,7 +81,8 @@ R::FileReader(const FileName& f, const String& path,
               const String& extension, bool swap)
 :Object(), _fullFileName(path + f + extension), _pFileStruct(NULL),
  _fileName(f), _path(path), _extension(extension), 
- _fileLengthDefined(false), _swap(swap) {}
+ _fileLengthDefined(false), _swap(swap), _pMap(NULL), _mapLength(0),
+ _mapHandle(NULL) {}
 //-------------------------------------------------------------------------
 R& R::create(const FileName& f, const String& path, const String& ext,
              bool swap)
@@ -114,6 +123,71 @@ const FileName& R::getFullFileName() const { return _fullFileName; }
 //-------------------------------------------------------------------------
 const FileName& R::getFileName() const { return _fileName; }
 //-------------------------------------------------------------------------
+const char* R::map()
+{
+  if (_pMap != NULL)
+    return _pMap;
+#if defined(_WIN32)
+  HANDLE file = ::CreateFileA(_fullFileName.c_str(), GENERIC_READ,
+             FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file == INVALID_HANDLE_VALUE)
+    throw FileNotFoundException("", __FILE__, __LINE__, _fullFileName);
+  LARGE_INTEGER size;
+  if (!::GetFileSizeEx(file, &size) || size.QuadPart == 0)
+  {
+    ::CloseHandle(file);
+    return NULL;
+  }
+  HANDLE mapping = ::CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0,
+                                        NULL);
+  ::CloseHandle(file); // the mapping object keeps the file open
+  if (mapping == NULL)
+    return NULL;
+  const void* p = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (p == NULL)
+  {
+    ::CloseHandle(mapping);
+    return NULL;
+  }
+  _mapHandle = mapping;
+  _mapLength = (unsigned long)size.QuadPart;
+#else
+  int fd = ::open(_fullFileName.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw FileNotFoundException("", __FILE__, __LINE__, _fullFileName);
+  struct stat st;
+  if (::fstat(fd, &st) != 0 || st.st_size == 0)
+  {
+    ::close(fd);
+    return NULL;
+  }
+  void* p = ::mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd); // the mapping keeps a reference to the file
+  if (p == MAP_FAILED)
+    return NULL;
+  _mapLength = (unsigned long)st.st_size;
+#endif
+  _pMap = (const char*)p;
+  return _pMap;
+}
+//-------------------------------------------------------------------------
+void R::unmap()
+{
+  if (_pMap == NULL)
+    return;
+#if defined(_WIN32)
+  ::UnmapViewOfFile(_pMap);
+  ::CloseHandle((HANDLE)_mapHandle);
+  _mapHandle = NULL;
+#else
+  ::munmap((void*)_pMap, _mapLength);
+#endif
+  _pMap = NULL;
+  _mapLength = 0;
+}
+//-------------------------------------------------------------------------
+bool R::isMapped() const { return _pMap != NULL; }
+//-------------------------------------------------------------------------
 unsigned long R::getFileLength()
 {
   if (!_fileLengthDefined)
@@ -419,7 +493,11 @@ String R::toString() const
 //-------------------------------------------------------------------------
 String R::getClassName() const { return "FileReader"; }
 //-------------------------------------------------------------------------
-R::~FileReader() { close(); }
+R::~FileReader()
+{
+  unmap();
+  close();
+}
 //-------------------------------------------------------------------------
 
 #endif // !defined(ALIZE_FileReader_cpp)
@@ -0,0 +1,156 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_FrameBlock_cpp)
+#define ALIZE_FrameBlock_cpp
+
+#include <memory.h>
+#include "FrameBlock.h"
+#include "DistribKernel.h"
+#include "Feature.h"
+#include "Exception.h"
+#include "alizeString.h"
+
+using namespace alize;
+typedef FrameBlock B;
+
+//-------------------------------------------------------------------------
+B::FrameBlock(unsigned long vectSize, unsigned long capacity)
+:Object(), _vectSize(vectSize),
+ _stride(DistribKernel::getPaddedSize(vectSize)), _frameCount(0),
+ _capacity(capacity), _array(DistribKernel::allocArray(capacity*_stride)) {}
+//-------------------------------------------------------------------------
+unsigned long B::getVectSize() const { return _vectSize; }
+//-------------------------------------------------------------------------
+void B::setVectSize(unsigned long vectSize)
+{
+  if (vectSize == _vectSize)
+    return;
+  const unsigned long stride = DistribKernel::getPaddedSize(vectSize);
+  real_t* a = DistribKernel::allocArray(_capacity*stride);
+  DistribKernel::freeArray(_array);
+  _array = a;
+  _vectSize = vectSize;
+  _stride = stride;
+  _frameCount = 0;
+}
+//-------------------------------------------------------------------------
+unsigned long B::getFrameCount() const { return _frameCount; }
+//-------------------------------------------------------------------------
+void B::setFrameCount(unsigned long n)
+{
+  if (n > _capacity)
+    setCapacity(max(n, 2*_capacity));
+  _frameCount = n;
+}
+//-------------------------------------------------------------------------
+unsigned long B::getCapacity() const { return _capacity; }
+//-------------------------------------------------------------------------
+void B::setCapacity(unsigned long capacity)
+{
+  if (capacity < _frameCount)
+    _frameCount = capacity;
+  real_t* a = DistribKernel::allocArray(capacity*_stride);
+  memcpy(a, _array, _frameCount*_stride*sizeof(real_t));
+  DistribKernel::freeArray(_array);
+  _array = a;
+  _capacity = capacity;
+}
+//-------------------------------------------------------------------------
+unsigned long B::getStride() const { return _stride; }
+//-------------------------------------------------------------------------
+void B::clear() { _frameCount = 0; }
+//-------------------------------------------------------------------------
+void B::assertVectSize(const Feature& f) const // private
+{
+  if (f.getVectSize() != _vectSize)
+    throw Exception("block vectSize ("
+        + String::valueOf(_vectSize) + ") != feature vectSize ("
+      + String::valueOf(f.getVectSize()) + ")", __FILE__, __LINE__);
+}
+//-------------------------------------------------------------------------
+void B::addFeature(const Feature& f)
+{
+  assertVectSize(f);
+  setFrameCount(_frameCount+1);
+  memcpy(_array+(_frameCount-1)*_stride, f.getDataVector(),
+         _vectSize*sizeof(real_t));
+}
+//-------------------------------------------------------------------------
+void B::getFeature(unsigned long t, Feature& f) const
+{
+  assertVectSize(f);
+  assertIsInBounds(__FILE__, __LINE__, t, _frameCount);
+  memcpy(f.getDataVector(), _array+t*_stride, _vectSize*sizeof(real_t));
+}
+//-------------------------------------------------------------------------
+real_t* B::getFrame(unsigned long t) { return _array+t*_stride; }
+//-------------------------------------------------------------------------
+const real_t* B::getFrame(unsigned long t) const
+{ return _array+t*_stride; }
+//-------------------------------------------------------------------------
+String B::getClassName() const { return "FrameBlock"; }
+//-------------------------------------------------------------------------
+String B::toString() const
+{
+  return Object::toString()
+    + "\n  vectSize   = " + String::valueOf(_vectSize)
+    + "\n  frameCount = " + String::valueOf(_frameCount)
+    + "\n  capacity   = " + String::valueOf(_capacity);
+}
+//-------------------------------------------------------------------------
+B::~FrameBlock() { DistribKernel::freeArray(_array); }
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_FrameBlock_cpp)
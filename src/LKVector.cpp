@@ -59,6 +59,7 @@
 #include <math.h>
 #include <memory.h>
 #include <cstdlib>
+#include <algorithm>
 #include "LKVector.h"
 #include "alizeString.h"
 #include "Exception.h"
@@ -172,19 +173,30 @@ void LKVector::setSize(unsigned long size)
     _size = size;
 }
 //-------------------------------------------------------------------------
-int LKVector::compare(const void *s1, const void *s2) // static method
+// comparison function object for the sorts (inlined by the compiler, unlike
+// the function pointer given to qsort)
+namespace
 {
-  if (((type*)s1)->lk > ((type*)s2)->lk)
-    return -1;
-  if (((type*)s1)->lk < ((type*)s2)->lk)
-    return 1;
-  return 0;
+  struct GreaterLK
+  {
+    bool operator()(const LKVector::type& a, const LKVector::type& b) const
+    { return a.lk > b.lk; }
+  };
 }
 //-------------------------------------------------------------------------
 void LKVector::descendingSort() const
 {
   assert(_array != NULL);
-  qsort(_array, _size, sizeof(type), compare);
+  std::sort(_array, _array+_size, GreaterLK());
+}
+//-------------------------------------------------------------------------
+void LKVector::descendingPartialSort(unsigned long n) const
+{
+  assert(_array != NULL);
+  if (n >= _size)
+    std::sort(_array, _array+_size, GreaterLK());
+  else
+    std::partial_sort(_array, _array+n, _array+_size, GreaterLK());
 }
 //-------------------------------------------------------------------------
 LKVector::type* LKVector::getArray() const { return _array; }
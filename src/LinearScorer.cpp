@@ -0,0 +1,167 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_LinearScorer_cpp)
+#define ALIZE_LinearScorer_cpp
+
+#include "LinearScorer.h"
+#include "BaumWelchStats.h"
+#include "MixtureGD.h"
+#include "DistribGD.h"
+#include "Exception.h"
+#include "alizeString.h"
+
+using namespace alize;
+typedef LinearScorer T;
+
+//-------------------------------------------------------------------------
+T::LinearScorer(const Mixture& world)
+:Object(), _world(assertIsGD(world)),
+ _worldChecksum(world.computeChecksum()) {}
+//-------------------------------------------------------------------------
+const MixtureGD& T::assertIsGD(const Mixture& m) // private
+{
+  if (m.getType() != DistribType_GD)
+    throw Exception("mixture '" + m.getId() + "' is not a MixtureGD",
+                    __FILE__, __LINE__);
+  return static_cast<const MixtureGD&>(m);
+}
+//-------------------------------------------------------------------------
+void T::setTestStats(const BaumWelchStats& s)
+{
+  const unsigned long distribCount = _world.getDistribCount();
+  const unsigned long vectSize = _world.getVectSize();
+  if (s.getWorldChecksum() != _worldChecksum
+      || s.getDistribCount() != distribCount
+      || s.getVectSize() != vectSize)
+    throw Exception("statistics not computed with the world model '"
+                    + _world.getId() + "'", __FILE__, __LINE__);
+  if (s.getFrameCount() == 0)
+    throw Exception("statistics without frame", __FILE__, __LINE__);
+  const real_t n = 1.0/s.getFrameCount();
+  const float* zeroOrder = s.getZeroOrderVect().getArray();
+  const float* firstOrder = s.getFirstOrderVect().getArray();
+  _testVect.setSize(distribCount*vectSize);
+  real_t* testVect = _testVect.getArray();
+  for (unsigned long c=0; c<distribCount; c++)
+  {
+    const DistribGD& d = _world.getDistrib(c);
+    const real_t* meanVect = d.getMeanVect().getArray();
+    const real_t* covInvVect = d.getCovInvVect().getArray();
+    const unsigned long k = c*vectSize;
+    for (unsigned long i=0; i<vectSize; i++)
+      testVect[k+i] = (firstOrder[k+i]-zeroOrder[c]*meanVect[i])
+                      *covInvVect[i]*n;
+  }
+}
+//-------------------------------------------------------------------------
+void T::computeOffsetVect(const Mixture& mx, DoubleVector& v) const
+{
+  const MixtureGD& m = assertIsGD(mx);
+  const unsigned long distribCount = _world.getDistribCount();
+  const unsigned long vectSize = _world.getVectSize();
+  if (m.getDistribCount() != distribCount || m.getVectSize() != vectSize)
+    throw Exception("mixture '" + m.getId()
+                    + "' has not the dimensions of the world model",
+                    __FILE__, __LINE__);
+  v.setSize(distribCount*vectSize);
+  real_t* offsetVect = v.getArray();
+  for (unsigned long c=0; c<distribCount; c++)
+  {
+    // const references : the versions of the distributions are unchanged
+    const DistribGD& d = m.getDistrib(c);
+    const DistribGD& w = _world.getDistrib(c);
+    const real_t* meanVect = d.getMeanVect().getArray();
+    const real_t* worldMeanVect = w.getMeanVect().getArray();
+    const unsigned long k = c*vectSize;
+    for (unsigned long i=0; i<vectSize; i++)
+      offsetVect[k+i] = meanVect[i]-worldMeanVect[i];
+  }
+}
+//-------------------------------------------------------------------------
+real_t T::computeScore(const Mixture& m) const
+{
+  computeOffsetVect(m, _offsetVect);
+  return computeScore(_offsetVect);
+}
+//-------------------------------------------------------------------------
+real_t T::computeScore(const DoubleVector& v) const
+{
+  const unsigned long n = _testVect.size();
+  if (n == 0)
+    throw Exception("no test statistics", __FILE__, __LINE__);
+  if (v.size() != n)
+    throw Exception("offset vector size (" + String::valueOf(v.size())
+        + ") != " + String::valueOf(n), __FILE__, __LINE__);
+  const real_t* testVect = _testVect.getArray();
+  const real_t* offsetVect = v.getArray();
+  real_t score = 0.0;
+  for (unsigned long i=0; i<n; i++)
+    score += offsetVect[i]*testVect[i];
+  return score;
+}
+//-------------------------------------------------------------------------
+String T::getClassName() const { return "LinearScorer"; }
+//-------------------------------------------------------------------------
+String T::toString() const
+{
+  return Object::toString()
+    + "\n  world = '" + _world.getId() + "'";
+}
+//-------------------------------------------------------------------------
+T::~LinearScorer() {}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_LinearScorer_cpp)
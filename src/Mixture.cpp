@@ -68,7 +68,7 @@ typedef Mixture M;
 //-------------------------------------------------------------------------
 M::Mixture(const String& id, unsigned long distribCount, unsigned long v)
 :Object(), _vectSize(v), _weightVect(distribCount),
- _distribVect(distribCount), _id(id) {}
+ _distribVect(distribCount), _id(id), _version(0) {}
 //-------------------------------------------------------------------------
 bool M::operator!=(const Mixture& m) const { return !(*this == m); }
 //-------------------------------------------------------------------------
@@ -89,6 +89,7 @@ void M::assign(const Mixture& m) // private
                      // can throw Exception
     weight(i) = m.weight(i);
   }
+  markModified();
   // DOES NOT copy the identifier : _id = m._id;
 }
 //-------------------------------------------------------------------------
@@ -108,10 +109,12 @@ void M::equalizeWeights()
     for (unsigned long c=0; c<n; c++)
       weight(c) = w;
   }
+  markModified();
 }
 //-------------------------------------------------------------------------
 void M::removeAllDistrib(const K&)
 {
+  _version++;
   _distribVect.clear();
   _weightVect.clear();
 }
@@ -121,11 +124,13 @@ Mixture& M::duplicate(const K&, DuplDistrib d) const
 //-------------------------------------------------------------------------
 void M::setDistrib(const K&, Distrib& d, unsigned long i)
 {
+  _version++;
   _distribVect.setDistrib(d, i); // can throw IndexOutOfBoundsException
 }
 //-------------------------------------------------------------------------
 void M::addDistrib(const K&, Distrib& d, weight_t w)
 {
+  _version++;
   _distribVect.addDistrib(d);
   _weightVect.addValue(w);
 }
@@ -136,7 +141,7 @@ Distrib& M::getDistrib(unsigned long i) const
 }
 //-------------------------------------------------------------------------
 weight_t& M::weight(unsigned long index)
-{ return _weightVect[index]; /* can throw IndexOutOfBoundsException */ }
+{ return _weightVect[index]; /* can throw IndexOutOfBoundsException */}
 //-------------------------------------------------------------------------
 weight_t M::weight(unsigned long index) const
 { return _weightVect[index]; /* can throw IndexOutOfBoundsException */}
@@ -151,6 +156,21 @@ const DoubleVector& M::getTabWeight() const { return _weightVect; }
 Distrib** M::getTabDistrib() const
 { return _distribVect.getArray(); }
 //-------------------------------------------------------------------------
+unsigned long M::computeChecksum() const
+{
+  unsigned long h = updateChecksum(_weightVect.getArray(),
+                                   getDistribCount()*sizeof(weight_t));
+  for (unsigned long c=0; c<getDistribCount(); c++)
+  {
+    const Distrib& d = getDistrib(c); // const reads : version unchanged
+    h = updateChecksum(d.getMeanVect().getArray(),
+                       _vectSize*sizeof(real_t), h);
+  }
+  return h;
+}
+//-------------------------------------------------------------------------
+void M::prepare() const {}
+//-------------------------------------------------------------------------
 String M::getId() const { return _id; }
 //-------------------------------------------------------------------------
 void M::setId(const K&, const String& id) { _id = id; }
@@ -164,10 +184,15 @@ void M::computeAll()
 {
   for (unsigned long i=0; i<getDistribCount(); i++)
     getDistrib(i).computeAll();
+  markModified();
 }
 //-------------------------------------------------------------------------
+void M::markModified() { _version++; }
+//-------------------------------------------------------------------------
 unsigned long M::getVectSize() const { return _vectSize; }
 //-------------------------------------------------------------------------
+unsigned long M::getVersion() const { return _version; }
+//-------------------------------------------------------------------------
 // static method
 //-------------------------------------------------------------------------
 Mixture& M::create(const K&, const unsigned long dc,
@@ -0,0 +1,330 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_MixtureEMTrainer_cpp)
+#define ALIZE_MixtureEMTrainer_cpp
+
+#include <new>
+#include <cmath>
+#include "MixtureEMTrainer.h"
+#include "MixtureGD.h"
+#include "MixtureGDStat.h"
+#include "DistribGD.h"
+#include "StatServer.h"
+#include "FeatureInputStream.h"
+#include "Feature.h"
+#include "FrameBlock.h"
+#include "ThreadPool.h"
+#include "Config.h"
+#include "Exception.h"
+#include "alizeString.h"
+
+using namespace alize;
+typedef MixtureEMTrainer T;
+
+static const unsigned long WINDOW_SIZE = 4096; // frames per accumulator
+
+// Job j accumulates the j-th part of the frames read by the calling thread
+// in its own MixtureGDStat
+class EMTrainerTask : public ThreadTask
+{
+public :
+  EMTrainerTask(MixtureGD& m, const Config& c, unsigned long jobCount)
+    :_frames(m.getVectSize(), 0), _llkVect(jobCount, jobCount),
+     _minLLK(c.getParam_minLLK()), _maxLLK(c.getParam_maxLLK())
+  {
+    for (unsigned long j=0; j<jobCount; j++)
+    {
+      StatServer* p = new (std::nothrow) StatServer(c);
+      Object::assertMemoryIsAllocated(p, __FILE__, __LINE__);
+      _ssVect.addObject(*p);
+      MixtureGDStat& s = p->createAndStoreMixtureStat(m);
+      s.resetEM();
+      _statVect.addObject(s);
+      Feature* f = new (std::nothrow) Feature(m.getVectSize());
+      Object::assertMemoryIsAllocated(f, __FILE__, __LINE__);
+      _featureVect.addObject(*f);
+      _llkVect[j] = 0.0;
+    }
+  }
+  ~EMTrainerTask()
+  {
+    _featureVect.deleteAllObjects();
+    _ssVect.deleteAllObjects(); // deletes the MixtureGDStat objects
+  }
+  void runJob(unsigned long job, unsigned long)
+  {
+    const unsigned long n = _frames.getFrameCount();
+    const unsigned long jobCount = _statVect.size();
+    MixtureGDStat& s = _statVect.getObject(job);
+    Feature& f = _featureVect.getObject(job);
+    lk_t llk = 0.0;
+    for (unsigned long t=n*job/jobCount; t<n*(job+1)/jobCount; t++)
+    {
+      _frames.getFeature(t, f);
+      const occ_t lk = s.computeAndAccumulateEM(f);
+      lk_t l = (lk > 0.0 ? log(lk) : _minLLK);
+      if (l < _minLLK)
+        l = _minLLK;
+      else if (l > _maxLLK)
+        l = _maxLLK;
+      llk += l;
+    }
+    _llkVect[job] += llk;
+  }
+  MixtureGDStat& getStat(unsigned long j) { return _statVect.getObject(j); }
+
+  FrameBlock   _frames;  // frames read by the caller
+  DoubleVector _llkVect; // sum of the log-likelihoods of each job
+private :
+  const lk_t              _minLLK;
+  const lk_t              _maxLLK;
+  RefVector<StatServer>    _ssVect;
+  RefVector<MixtureGDStat> _statVect;
+  RefVector<Feature>       _featureVect;
+};
+
+//-------------------------------------------------------------------------
+T::MixtureEMTrainer(const Config& c, ThreadPool& pool)
+:Object(), _config(c), _pool(pool), _varianceFloor(MIN_COV),
+ _flooredVarianceCount(0), _accumulatorCount(0) {}
+//-------------------------------------------------------------------------
+void T::addSegment(FeatureInputStream& fs, unsigned long begin,
+                   unsigned long count)
+{
+  _streamVect.addObject(fs);
+  _beginVect.addValue(begin);
+  _countVect.addValue(count);
+}
+//-------------------------------------------------------------------------
+void T::addFeatureStream(FeatureInputStream& fs)
+{ addSegment(fs, 0, fs.getFeatureCount()); }
+//-------------------------------------------------------------------------
+unsigned long T::getFeatureCount() const
+{
+  unsigned long n = 0;
+  for (unsigned long i=0; i<_countVect.size(); i++)
+    n += _countVect[i];
+  return n;
+}
+//-------------------------------------------------------------------------
+void T::setAccumulatorCount(unsigned long n) { _accumulatorCount = n; }
+//-------------------------------------------------------------------------
+unsigned long T::getAccumulatorCount() const
+{
+  if (_accumulatorCount != 0)
+    return _accumulatorCount;
+  return _pool.getThreadCount();
+}
+//-------------------------------------------------------------------------
+void T::setVarianceFloor(real_t v)
+{
+  _varianceFloor = v;
+  _varianceFloorVect.clear();
+}
+//-------------------------------------------------------------------------
+void T::setVarianceFloor(const DoubleVector& v) { _varianceFloorVect = v; }
+//-------------------------------------------------------------------------
+const DoubleVector& T::getVarianceFloorVect() const
+{ return _varianceFloorVect; }
+//-------------------------------------------------------------------------
+void T::computeVarianceFloor(real_t factor)
+{
+  const unsigned long featureCount = getFeatureCount();
+  if (featureCount == 0)
+    throw Exception("No training data", __FILE__, __LINE__);
+  const unsigned long vectSize = _streamVect.getObject(0).getVectSize();
+  DoubleVector sumVect(vectSize, vectSize), sum2Vect(vectSize, vectSize);
+  sumVect.setAllValues(0.0);
+  sum2Vect.setAllValues(0.0);
+  Feature f(vectSize);
+  unsigned long i;
+  for (unsigned long s=0; s<_streamVect.size(); s++)
+  {
+    FeatureInputStream& fs = _streamVect.getObject(s);
+    fs.seekFeature(_beginVect[s]);
+    for (unsigned long t=0; t<_countVect[s]; t++)
+    {
+      if (!fs.readFeature(f))
+        throw Exception("End of the feature stream before the end of the"
+                        " segment", __FILE__, __LINE__);
+      const Feature::data_t* data = f.getDataVector();
+      for (i=0; i<vectSize; i++)
+      {
+        sumVect[i] += data[i];
+        sum2Vect[i] += data[i]*data[i];
+      }
+    }
+  }
+  _varianceFloorVect.setSize(vectSize);
+  for (i=0; i<vectSize; i++)
+  {
+    const real_t mean = sumVect[i]/featureCount;
+    _varianceFloorVect[i] = factor*(sum2Vect[i]/featureCount - mean*mean);
+  }
+}
+//-------------------------------------------------------------------------
+lk_t T::iterate(MixtureGD& m)
+{
+  const unsigned long featureCount = getFeatureCount();
+  if (featureCount == 0)
+    throw Exception("No training data", __FILE__, __LINE__);
+  const unsigned long vectSize = m.getVectSize();
+  if (_varianceFloorVect.size() != 0
+      && _varianceFloorVect.size() != vectSize)
+    throw Exception("variance floor size ("
+        + String::valueOf(_varianceFloorVect.size())
+        + ") != mixture vectSize (" + String::valueOf(vectSize) + ")",
+        __FILE__, __LINE__);
+  m.prepare(); // read-only for the threads
+  const unsigned long jobCount = getAccumulatorCount();
+  EMTrainerTask task(m, _config, jobCount);
+  Feature f(vectSize);
+  unsigned long j;
+
+  for (unsigned long s=0; s<_streamVect.size(); s++)
+  {
+    FeatureInputStream& fs = _streamVect.getObject(s);
+    if (fs.getVectSize() != vectSize)
+      throw Exception("mixture vectSize (" + String::valueOf(vectSize)
+          + ") != feature vectSize (" + String::valueOf(fs.getVectSize())
+          + ")", __FILE__, __LINE__);
+    fs.seekFeature(_beginVect[s]);
+    for (unsigned long done=0; done<_countVect[s]; )
+    {
+      unsigned long n = _countVect[s]-done;
+      if (n > WINDOW_SIZE*jobCount)
+        n = WINDOW_SIZE*jobCount;
+      task._frames.clear();
+      for (unsigned long t=0; t<n; t++)
+      {
+        if (!fs.readFeature(f))
+          throw Exception("End of the feature stream before the end of the"
+                          " segment", __FILE__, __LINE__);
+        task._frames.addFeature(f);
+      }
+      _pool.run(task, jobCount);
+      done += n;
+    }
+  }
+  // merged in the order of the jobs
+  MixtureGDStat& stat = task.getStat(0);
+  lk_t llk = task._llkVect[0];
+  for (j=1; j<jobCount; j++)
+  {
+    stat.addAccEM(task.getStat(j));
+    llk += task._llkVect[j];
+  }
+  const MixtureGD& em = static_cast<const MixtureGD&>(stat.getEM());
+  for (unsigned long c=0; c<m.getDistribCount(); c++)
+  {
+    m.getDistrib(c) = em.getDistrib(c);
+    m.weight(c) = em.weight(c);
+  }
+  m.markModified();
+  _flooredVarianceCount = floorVariances(m);
+  return llk/featureCount;
+}
+//-------------------------------------------------------------------------
+lk_t T::train(MixtureGD& m, unsigned long iterationCount)
+{
+  lk_t llk = 0.0;
+  for (unsigned long i=0; i<iterationCount; i++)
+    llk = iterate(m);
+  return llk;
+}
+//-------------------------------------------------------------------------
+unsigned long T::floorVariances(MixtureGD& m) // private
+{
+  const unsigned long vectSize = m.getVectSize();
+  const bool perCoef = (_varianceFloorVect.size() != 0);
+  unsigned long count = 0;
+  for (unsigned long c=0; c<m.getDistribCount(); c++)
+  {
+    DistribGD& d = m.getDistrib(c);
+    bool floored = false;
+    for (unsigned long i=0; i<vectSize; i++)
+    {
+      const real_t floor = (perCoef ? _varianceFloorVect[i] : _varianceFloor);
+      if (d.getCov(i) < floor)
+      {
+        d.setCov(floor, i);
+        floored = true;
+        count++;
+      }
+    }
+    if (floored)
+      d.computeAll();
+  }
+  return count;
+}
+//-------------------------------------------------------------------------
+unsigned long T::getFlooredVarianceCount() const
+{ return _flooredVarianceCount; }
+//-------------------------------------------------------------------------
+String T::getClassName() const { return "MixtureEMTrainer"; }
+//-------------------------------------------------------------------------
+String T::toString() const
+{
+  return Object::toString()
+    + "\n  segmentCount  = " + String::valueOf(_streamVect.size())
+    + "\n  featureCount  = " + String::valueOf(getFeatureCount())
+    + "\n  threadCount   = " + String::valueOf(_pool.getThreadCount())
+    + "\n  accumulatorCount = " + String::valueOf(getAccumulatorCount());
+}
+//-------------------------------------------------------------------------
+T::~MixtureEMTrainer() {}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_MixtureEMTrainer_cpp)
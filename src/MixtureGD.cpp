@@ -61,7 +61,9 @@
 #include "Exception.h"
 #include "MixtureStat.h"
 #include "MixtureGDStat.h"
-//#include "Config.h"
+#include "MixtureGDCompiled.h"
+#include "MixtureGDSelector.h"
+#include "Config.h"
 #include "alizeString.h"
 //#include <iostream>
 #include "StatServer.h"
@@ -70,7 +72,8 @@ using namespace alize;
 
 //-------------------------------------------------------------------------
 MixtureGD::MixtureGD(const String& id, unsigned long vs, unsigned long dc)
-:Mixture(id, dc, vs)
+:Mixture(id, dc, vs), _pCompiled(NULL), _pSelector(NULL),
+ _selectorPending(false), _selectorClusterCount(0)
 {
   for (unsigned long c=0; c<dc; c++)
   { Mixture::addDistrib(K::k, DistribGD::create(K::k, _vectSize)); }
@@ -87,7 +90,8 @@ MixtureGD::MixtureGD(const String& id, unsigned long vs, unsigned long dc)
 }*/
 //-------------------------------------------------------------------------
 MixtureGD::MixtureGD(const MixtureGD& m)
-:Mixture(m._id, m.getDistribCount(), m._vectSize)
+:Mixture(m._id, m.getDistribCount(), m._vectSize), _pCompiled(NULL),
+ _pSelector(NULL), _selectorPending(false), _selectorClusterCount(0)
 {
   // Attention : les distributions ne sont pas copiees, la copie pointe sur
   // les mmes distributions que l'original <FRANCAIS>
@@ -220,6 +224,120 @@ MixtureStat& MixtureGD::createNewMixtureStatObject(const K&,
 //-------------------------------------------------------------------------
 DistribType MixtureGD::getType() const { return DistribType_GD; }
 //-------------------------------------------------------------------------
+unsigned long MixtureGD::computeChecksum() const
+{
+  unsigned long h = Mixture::computeChecksum();
+  for (unsigned long c=0; c<getDistribCount(); c++)
+  {
+    const DistribGD& d = getDistrib(c); // const reads : version unchanged
+    h = updateChecksum(d.getCovInvVect().getArray(),
+                       _vectSize*sizeof(real_t), h);
+  }
+  return h;
+}
+//-------------------------------------------------------------------------
+void MixtureGD::prepare() const
+{
+  // records the global version of the distribs : the checks done by the
+  // scoring threads only read
+  if (_pCompiled == NULL)
+    getCompiled();
+  else
+    _pCompiled->prepare(*this);
+  // a pending index is not read for a mixture which does not need it
+  if (!_selectorPending && _pSelector != NULL)
+    _pSelector->prepare(*this);
+}
+//-------------------------------------------------------------------------
+void MixtureGD::prepareTopDistribs(const Config& c) const
+{
+  prepare();
+  if (c.getParam_gaussianSelection())
+    getSelector();
+  if (c.getParam_topDistribsPruning())
+    getCompiled().prepareSearch();
+}
+//-------------------------------------------------------------------------
+const MixtureGDCompiled& MixtureGD::getCompiled() const
+{
+  if (_pCompiled == NULL)
+  {
+    _pCompiled = new (std::nothrow) MixtureGDCompiled(*this);
+    assertMemoryIsAllocated(_pCompiled, __FILE__, __LINE__);
+  }
+  else
+    _pCompiled->update(*this);
+  return *_pCompiled;
+}
+//-------------------------------------------------------------------------
+const MixtureGDSelector* MixtureGD::getSelector() const
+{
+  if (_selectorPending)
+  {
+    _selectorPending = false;
+    const unsigned long clusterCount = _selectorClusterCount;
+    if (loadSelector(_selectorFileName) && (clusterCount == 0
+        || _pSelector->getClusterCount() == clusterCount))
+      return _pSelector;
+    createSelector(clusterCount);
+    try { _pSelector->save(_selectorFileName); }
+    catch (IOException&) {} // read-only directory : built again next time
+    return _pSelector;
+  }
+  if (_pSelector != NULL && !_pSelector->isUpToDate(*this))
+    _pSelector->build(*this);
+  return _pSelector;
+}
+//-------------------------------------------------------------------------
+void MixtureGD::setSelectorFile(const FileName& f,
+                                unsigned long clusterCount) const
+{
+  deleteSelector();
+  _selectorPending = true;
+  _selectorFileName = f;
+  _selectorClusterCount = clusterCount;
+}
+//-------------------------------------------------------------------------
+const MixtureGDSelector& MixtureGD::createSelector(
+                                    unsigned long clusterCount) const
+{
+  deleteSelector();
+  _pSelector = new (std::nothrow) MixtureGDSelector(*this, clusterCount);
+  assertMemoryIsAllocated(_pSelector, __FILE__, __LINE__);
+  return *_pSelector;
+}
+//-------------------------------------------------------------------------
+bool MixtureGD::loadSelector(const FileName& f) const
+{
+  // one cluster : cheap to build, replaced by the content of the file
+  MixtureGDSelector* p = new (std::nothrow) MixtureGDSelector(*this, 1);
+  assertMemoryIsAllocated(p, __FILE__, __LINE__);
+  try
+  {
+    if (!p->load(f, *this))
+    {
+      delete p;
+      return false;
+    }
+  }
+  catch (Exception&)
+  {
+    delete p;
+    throw;
+  }
+  deleteSelector();
+  _pSelector = p;
+  return true;
+}
+//-------------------------------------------------------------------------
+void MixtureGD::deleteSelector() const
+{
+  _selectorPending = false;
+  if (_pSelector != NULL)
+    delete _pSelector;
+  _pSelector = NULL;
+}
+//-------------------------------------------------------------------------
 String MixtureGD::getClassName() const { return "MixtureGD"; }
 //-------------------------------------------------------------------------
 String MixtureGD::toString() const
@@ -239,7 +357,12 @@ String MixtureGD::toString() const
   return s;
 }
 //-------------------------------------------------------------------------
-MixtureGD::~MixtureGD() {}
+MixtureGD::~MixtureGD()
+{
+  if (_pCompiled != NULL)
+    delete _pCompiled;
+  deleteSelector();
+}
 //-------------------------------------------------------------------------
 
 #endif // !defined(ALIZE_MixtureGD_cpp)
@@ -0,0 +1,689 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_MixtureGDCompiled_cpp)
+#define ALIZE_MixtureGDCompiled_cpp
+
+#if defined(_WIN32)
+  #include <cfloat> // for _isnan()
+  #define ISNAN(x) _isnan(x)
+#elif defined(linux) || defined(__linux) || defined(__CYGWIN__) || defined(__APPLE__)
+  #define ISNAN(x) isnan(x)
+#else
+  #error "Unsupported OS\n"
+#endif
+
+#include <cmath>
+#include <memory.h>
+#include <algorithm>
+#include "MixtureGDCompiled.h"
+#include "MixtureGD.h"
+#include "DistribGD.h"
+#include "DistribKernel.h"
+#include "Feature.h"
+#include "FeatureView.h"
+#include "FrameBlock.h"
+#include "LKVector.h"
+#include "Exception.h"
+#include "alizeString.h"
+
+using namespace alize;
+using namespace std;
+typedef MixtureGDCompiled C;
+
+// block methods : frames processed together and size in bytes of the means
+// and inverse covariances of a group of distributions (about the size of
+// the level 1 data cache)
+static const unsigned long FRAME_BLOCK_SIZE = 64;
+static const unsigned long DISTRIB_BLOCK_BYTES = 32768;
+// searchTopDistribs() : number of dimensions added between two tests of the
+// partial distance (see computeSegmentDist()). The sorted means and
+// inverse covariances are stored by segments of this size : the segment s
+// of distribution c begins at (s*distribCount+c)*PARTIAL_DIST_STEP, so the
+// first segments of all the distributions are contiguous and the rejected
+// distributions do not bring the other ones into the cache.
+static const unsigned long PARTIAL_DIST_STEP = 8;
+
+// searchTopDistribs() : number of distributions computed completely to
+// initialize the limit, per distribution searched
+static const unsigned long CANDIDATE_FACTOR = 2;
+
+static unsigned long getSegmentCount(unsigned long vectSize)
+{ return (vectSize+PARTIAL_DIST_STEP-1)/PARTIAL_DIST_STEP; }
+
+// Weighted distance of one segment. Inlined : a call to the kernel of
+// DistribKernel costs more than the computation itself for so few values.
+static inline real_t computeSegmentDist(const real_t* x, const real_t* m,
+                                        const real_t* c)
+{
+  real_t d0 = x[0]-m[0], d1 = x[1]-m[1], d2 = x[2]-m[2], d3 = x[3]-m[3];
+  real_t d4 = x[4]-m[4], d5 = x[5]-m[5], d6 = x[6]-m[6], d7 = x[7]-m[7];
+  return ((d0*d0*c[0] + d1*d1*c[1]) + (d2*d2*c[2] + d3*d3*c[3]))
+       + ((d4*d4*c[4] + d5*d5*c[5]) + (d6*d6*c[6] + d7*d7*c[7]));
+}
+
+// Orders dimensions by decreasing sum of the inverse covariances
+struct GreaterCovInvSum
+{
+  explicit GreaterCovInvSum(const real_t* sumVect) :_sumVect(sumVect) {}
+  bool operator()(unsigned long a, unsigned long b) const
+  { return _sumVect[a] > _sumVect[b]; }
+  const real_t* _sumVect;
+};
+
+// Min-heap of the best distributions in searchTopDistribs()
+struct GreaterLogLK
+{
+  bool operator()(const LKVector::type& a, const LKVector::type& b) const
+  { return a.lk > b.lk; }
+};
+
+//-------------------------------------------------------------------------
+C::MixtureGDCompiled(const MixtureGD& m)
+:Object(), _distribCount(0), _vectSize(0), _stride(0), _meanArray(NULL),
+ _covInvArray(NULL), _weightArray(NULL), _cstArray(NULL),
+ _logWeightArray(NULL), _logCstArray(NULL), _logWeightCstArray(NULL),
+ _sortedMeanArray(NULL), _sortedCovInvArray(NULL), _mixtureVersion(0),
+ _globalVersion(0)
+{ build(m); }
+//-------------------------------------------------------------------------
+bool C::isUpToDate(const MixtureGD& m) const
+{
+  if (m.getVersion() != _mixtureVersion
+      || m.getDistribCount() != _distribCount)
+    return false;
+  if (Distrib::getGlobalVersion() == _globalVersion)
+    return true;
+  Distrib** d = m.getTabDistrib();
+  const unsigned long* v = _distribVersionVect.getArray();
+  for (unsigned long c=0; c<_distribCount; c++)
+    if (d[c]->getVersion() != v[c])
+      return false;
+  return true;
+}
+//-------------------------------------------------------------------------
+void C::update(const MixtureGD& m)
+{
+  if (!isUpToDate(m))
+    build(m);
+}
+//-------------------------------------------------------------------------
+void C::prepare(const MixtureGD& m)
+{
+  // read before the distributions : a later modification is not missed
+  const unsigned long globalVersion = Distrib::getGlobalVersion();
+  if (isUpToDate(m))
+    _globalVersion = globalVersion; // the next calls take the fast path
+  else
+    build(m);
+}
+//-------------------------------------------------------------------------
+void C::build(const MixtureGD& m) // private
+{
+  const unsigned long globalVersion = Distrib::getGlobalVersion();
+  const unsigned long distribCount = m.getDistribCount();
+  const unsigned long vectSize = m.getVectSize();
+  const bool sorted = (_sortedMeanArray != NULL); // searches done
+  if (distribCount != _distribCount || vectSize != _vectSize
+      || _meanArray == NULL)
+  {
+    freeArrays();
+    _distribCount = distribCount;
+    _vectSize = vectSize;
+    _stride = DistribKernel::getPaddedSize(vectSize);
+    _meanArray      = DistribKernel::allocArray(_distribCount*_stride);
+    _covInvArray    = DistribKernel::allocArray(_distribCount*_stride);
+    _weightArray    = DistribKernel::allocArray(_distribCount);
+    _cstArray       = DistribKernel::allocArray(_distribCount);
+    _logWeightArray = DistribKernel::allocArray(_distribCount);
+    _logCstArray    = DistribKernel::allocArray(_distribCount);
+    _logWeightCstArray = DistribKernel::allocArray(_distribCount);
+    memset(_meanArray, 0, _distribCount*_stride*sizeof(real_t));
+    memset(_covInvArray, 0, _distribCount*_stride*sizeof(real_t));
+    _distribVersionVect.setSize(_distribCount);
+    _tmpVect.setSize(_distribCount);
+  }
+  const real_t logPI2 = log(PI2);
+  const weight_t* w = m.getTabWeight().getArray();
+  unsigned long* v = _distribVersionVect.getArray();
+  for (unsigned long c=0; c<_distribCount; c++)
+  {
+    const DistribGD& d = m.getDistrib(c);
+    const real_t* mean = d.getMeanVect().getArray();
+    const real_t* covInv = d.getCovInvVect().getArray();
+    real_t* pMean = _meanArray + c*_stride;
+    real_t* pCovInv = _covInvArray + c*_stride;
+    real_t sumLogCovInv = 0.0;
+    for (unsigned long i=0; i<_vectSize; i++)
+    {
+      pMean[i] = mean[i];
+      pCovInv[i] = covInv[i];
+      sumLogCovInv += log(covInv[i]);
+    }
+    _weightArray[c] = w[c];
+    _cstArray[c] = d.getCst();
+    _logWeightArray[c] = log(w[c] > EPS_LK ? w[c] : EPS_LK);
+    // computed from the inverse covariances and not from the constante
+    // which is floored when the determinant is too small
+    _logCstArray[c] = 0.5*(sumLogCovInv - _vectSize*logPI2);
+    _logWeightCstArray[c] = _logWeightArray[c] + _logCstArray[c];
+    v[c] = d.getVersion();
+  }
+  if (sorted)
+    sortDims();
+  _mixtureVersion = m.getVersion();
+  _globalVersion = globalVersion;
+}
+//-------------------------------------------------------------------------
+// The dimensions which add the most to the distances on average are put
+// first so that searchTopDistribs() rejects the distributions early
+//-------------------------------------------------------------------------
+void C::prepareSearch() const
+{
+  if (_sortedMeanArray == NULL)
+    sortDims();
+}
+//-------------------------------------------------------------------------
+void C::sortDims() const // private
+{
+  unsigned long c, i;
+  if (_sortedMeanArray == NULL)
+  {
+    const unsigned long sortedSize =
+        getSegmentCount(_vectSize)*_distribCount*PARTIAL_DIST_STEP;
+    _sortedMeanArray   = DistribKernel::allocArray(sortedSize);
+    _sortedCovInvArray = DistribKernel::allocArray(sortedSize);
+    // padding of the last segment : null distance
+    memset(_sortedMeanArray, 0, sortedSize*sizeof(real_t));
+    memset(_sortedCovInvArray, 0, sortedSize*sizeof(real_t));
+    _dimOrderVect.setSize(_vectSize);
+  }
+  DoubleVector sumVect(_vectSize, _vectSize);
+  real_t* sum = sumVect.getArray();
+  unsigned long* order = _dimOrderVect.getArray();
+  for (i=0; i<_vectSize; i++)
+  {
+    sum[i] = 0.0;
+    order[i] = i;
+  }
+  for (c=0; c<_distribCount; c++)
+  {
+    const real_t* covInv = _covInvArray + c*_stride;
+    for (i=0; i<_vectSize; i++)
+      sum[i] += covInv[i];
+  }
+  std::stable_sort(order, order+_vectSize, GreaterCovInvSum(sum));
+  for (c=0; c<_distribCount; c++)
+  {
+    const real_t* mean = _meanArray + c*_stride;
+    const real_t* covInv = _covInvArray + c*_stride;
+    for (i=0; i<_vectSize; i++)
+    {
+      const unsigned long j = (i/PARTIAL_DIST_STEP*_distribCount + c)
+                              *PARTIAL_DIST_STEP + i%PARTIAL_DIST_STEP;
+      _sortedMeanArray[j] = mean[order[i]];
+      _sortedCovInvArray[j] = covInv[order[i]];
+    }
+  }
+}
+//-------------------------------------------------------------------------
+void C::assertVectSize(unsigned long vectSize) const // private
+{
+  if (vectSize != _vectSize)
+    throw Exception("distrib vectSize ("
+        + String::valueOf(_vectSize) + ") != feature vectSize ("
+      + String::valueOf(vectSize) + ")", __FILE__, __LINE__);
+}
+//-------------------------------------------------------------------------
+// Shared by the double and the float data : the kernels give the same
+// distance for both
+//-------------------------------------------------------------------------
+lk_t C::computeLKFromDist(real_t dist,
+                          unsigned long c) const // private
+{
+  const real_t tmp = _cstArray[c] * exp(-0.5*dist);
+  if (ISNAN(tmp))
+    return EPS_LK;
+  return tmp;
+}
+//-------------------------------------------------------------------------
+lk_t C::computeLK(const real_t* data, unsigned long c) const // private
+{
+  return computeLKFromDist(DistribKernel::computeWeightedDist(data,
+           _meanArray+c*_stride, _covInvArray+c*_stride, _vectSize), c);
+}
+//-------------------------------------------------------------------------
+lk_t C::computeLK(const float* data, unsigned long c) const // private
+{
+  return computeLKFromDist(DistribKernel::computeWeightedDist(data,
+           _meanArray+c*_stride, _covInvArray+c*_stride, _vectSize), c);
+}
+//-------------------------------------------------------------------------
+lk_t C::computeLK(const Feature& f, unsigned long c) const
+{
+  assertVectSize(f.getVectSize());
+  assertIsInBounds(__FILE__, __LINE__, c, _distribCount);
+  return computeLK(f.getDataVector(), c);
+}
+//-------------------------------------------------------------------------
+lk_t C::computeWeightedLKSum(const Feature& f) const
+{
+  assertVectSize(f.getVectSize());
+  const real_t* data = f.getDataVector();
+  lk_t lk = 0.0;
+  for (unsigned long c=0; c<_distribCount; c++)
+    lk += _weightArray[c] * computeLK(data, c);
+  return lk;
+}
+//-------------------------------------------------------------------------
+lk_t C::computeWeightedLKSum(const FeatureView& f) const
+{
+  assertVectSize(f.getVectSize());
+  const float* data = f.getDataVector();
+  lk_t lk = 0.0;
+  for (unsigned long c=0; c<_distribCount; c++)
+    lk += _weightArray[c] * computeLK(data, c);
+  return lk;
+}
+//-------------------------------------------------------------------------
+unsigned long C::getDistribBlockSize() const // private
+{
+  unsigned long n = DISTRIB_BLOCK_BYTES/(2*_stride*sizeof(real_t));
+  return n == 0 ? 1 : n;
+}
+//-------------------------------------------------------------------------
+// The frames are processed by groups of FRAME_BLOCK_SIZE and, for each
+// group, the distributions by groups of getDistribBlockSize(). The
+// likelihoods of a frame are still added in the order of the
+// distributions, so the results do not depend on the blocking.
+//-------------------------------------------------------------------------
+void C::computeWeightedLKSum(const FrameBlock& b, lk_t* lk) const
+{
+  assertVectSize(b.getVectSize());
+  const unsigned long frameCount = b.getFrameCount();
+  const unsigned long distribBlockSize = getDistribBlockSize();
+  unsigned long t, c;
+  for (t=0; t<frameCount; t++)
+    lk[t] = 0.0;
+  for (unsigned long t0=0; t0<frameCount; t0+=FRAME_BLOCK_SIZE)
+  {
+    unsigned long t1 = t0+FRAME_BLOCK_SIZE;
+    if (t1 > frameCount)
+      t1 = frameCount;
+    for (unsigned long c0=0; c0<_distribCount; c0+=distribBlockSize)
+    {
+      unsigned long c1 = c0+distribBlockSize;
+      if (c1 > _distribCount)
+        c1 = _distribCount;
+      for (t=t0; t<t1; t++)
+      {
+        const real_t* data = b.getFrame(t);
+        lk_t sum = lk[t];
+        for (c=c0; c<c1; c++)
+          sum += _weightArray[c] * computeLK(data, c);
+        lk[t] = sum;
+      }
+    }
+  }
+}
+//-------------------------------------------------------------------------
+// Shared by the per-frame and the block versions : the same code gives the
+// same rounding, even with -ffast-math
+//-------------------------------------------------------------------------
+void C::computeWeightedLK(const real_t* data, unsigned long c0,
+                          unsigned long c1, lk_t* lk) const // private
+{
+  for (unsigned long c=c0; c<c1; c++)
+    lk[c] = _weightArray[c] * computeLK(data, c);
+}
+//-------------------------------------------------------------------------
+void C::computeWeightedLK(const Feature& f, lk_t* lk) const
+{
+  assertVectSize(f.getVectSize());
+  computeWeightedLK(f.getDataVector(), 0, _distribCount, lk);
+}
+//-------------------------------------------------------------------------
+void C::computeWeightedLK(const FrameBlock& b, unsigned long first,
+                          unsigned long count, lk_t* lk) const
+{
+  assertVectSize(b.getVectSize());
+  if (first+count > b.getFrameCount())
+    throw Exception("frame index out of bounds", __FILE__, __LINE__);
+  const unsigned long distribBlockSize = getDistribBlockSize();
+  for (unsigned long c0=0; c0<_distribCount; c0+=distribBlockSize)
+  {
+    unsigned long c1 = c0+distribBlockSize;
+    if (c1 > _distribCount)
+      c1 = _distribCount;
+    for (unsigned long t=0; t<count; t++)
+      computeWeightedLK(b.getFrame(first+t), c0, c1, lk+t*_distribCount);
+  }
+}
+//-------------------------------------------------------------------------
+lk_t C::computeLogLKFromDist(real_t dist,
+                             unsigned long c) const // private
+{
+  const real_t tmp = _logCstArray[c] - 0.5*dist;
+  if (DistribKernel::isNaN(tmp)) // kept by -ffast-math
+    return log(EPS_LK);
+  return tmp;
+}
+//-------------------------------------------------------------------------
+lk_t C::computeLogLK(const real_t* data, unsigned long c) const // private
+{
+  return computeLogLKFromDist(DistribKernel::computeWeightedDist(data,
+           _meanArray+c*_stride, _covInvArray+c*_stride, _vectSize), c);
+}
+//-------------------------------------------------------------------------
+lk_t C::computeLogLK(const float* data, unsigned long c) const // private
+{
+  return computeLogLKFromDist(DistribKernel::computeWeightedDist(data,
+           _meanArray+c*_stride, _covInvArray+c*_stride, _vectSize), c);
+}
+//-------------------------------------------------------------------------
+lk_t C::computeLogLK(const Feature& f, unsigned long c) const
+{
+  assertVectSize(f.getVectSize());
+  assertIsInBounds(__FILE__, __LINE__, c, _distribCount);
+  return computeLogLK(f.getDataVector(), c);
+}
+//-------------------------------------------------------------------------
+lk_t C::computeWeightedLogLKSum(const Feature& f) const
+{ return computeWeightedLogLKSum(f, _tmpVect); }
+//-------------------------------------------------------------------------
+lk_t C::computeWeightedLogLKSum(const Feature& f, DoubleVector& tmp) const
+{
+  assertVectSize(f.getVectSize());
+  const real_t* data = f.getDataVector();
+  tmp.setSize(_distribCount);
+  real_t* t = tmp.getArray();
+  computeWeightedLogLK(data, 0, _distribCount, t);
+  return DistribKernel::computeLogSumExp(t, _distribCount);
+}
+//-------------------------------------------------------------------------
+lk_t C::computeWeightedLogLKSum(const FeatureView& f,
+                                DoubleVector& tmp) const
+{
+  assertVectSize(f.getVectSize());
+  const float* data = f.getDataVector();
+  tmp.setSize(_distribCount);
+  real_t* t = tmp.getArray();
+  computeWeightedLogLK(data, 0, _distribCount, t);
+  return DistribKernel::computeLogSumExp(t, _distribCount);
+}
+//-------------------------------------------------------------------------
+void C::computeWeightedLogLKSum(const FrameBlock& b, lk_t* llk) const
+{
+  const unsigned long frameCount = b.getFrameCount();
+  const unsigned long n = FRAME_BLOCK_SIZE;
+  DoubleVector logLKMatrix(n*_distribCount, n*_distribCount);
+  real_t* m = logLKMatrix.getArray();
+  for (unsigned long t0=0; t0<frameCount; t0+=n)
+  {
+    const unsigned long count = (t0+n > frameCount ? frameCount-t0 : n);
+    computeWeightedLogLK(b, t0, count, m);
+    for (unsigned long t=0; t<count; t++)
+      llk[t0+t] = DistribKernel::computeLogSumExp(m+t*_distribCount,
+                                                  _distribCount);
+  }
+}
+//-------------------------------------------------------------------------
+void C::computeWeightedLogLK(const real_t* data, unsigned long c0,
+                   unsigned long c1, lk_t* logLK) const // private
+{
+  for (unsigned long c=c0; c<c1; c++)
+    logLK[c] = _logWeightArray[c] + computeLogLK(data, c);
+}
+//-------------------------------------------------------------------------
+void C::computeWeightedLogLK(const float* data, unsigned long c0,
+                   unsigned long c1, lk_t* logLK) const // private
+{
+  for (unsigned long c=c0; c<c1; c++)
+    logLK[c] = _logWeightArray[c] + computeLogLK(data, c);
+}
+//-------------------------------------------------------------------------
+void C::computeWeightedLogLK(const Feature& f, lk_t* logLK) const
+{
+  assertVectSize(f.getVectSize());
+  computeWeightedLogLK(f.getDataVector(), 0, _distribCount, logLK);
+}
+//-------------------------------------------------------------------------
+void C::computeWeightedLogLK(const FrameBlock& b, unsigned long first,
+                             unsigned long count, lk_t* logLK) const
+{
+  assertVectSize(b.getVectSize());
+  if (first+count > b.getFrameCount())
+    throw Exception("frame index out of bounds", __FILE__, __LINE__);
+  const unsigned long distribBlockSize = getDistribBlockSize();
+  for (unsigned long c0=0; c0<_distribCount; c0+=distribBlockSize)
+  {
+    unsigned long c1 = c0+distribBlockSize;
+    if (c1 > _distribCount)
+      c1 = _distribCount;
+    for (unsigned long t=0; t<count; t++)
+      computeWeightedLogLK(b.getFrame(first+t), c0, c1,
+                           logLK+t*_distribCount);
+  }
+}
+//-------------------------------------------------------------------------
+// Weighted log-likelihood with the sorted dimensions : half the distance of
+// each segment is subtracted from the log-constante in the same order as in
+// searchTopDistribs(), so the result is never greater than the bounds
+// computed there
+//-------------------------------------------------------------------------
+lk_t C::computeSortedLogLK(const real_t* x, unsigned long c) const // private
+{
+  const unsigned long segCount = getSegmentCount(_vectSize);
+  const unsigned long segSize = _distribCount*PARTIAL_DIST_STEP;
+  const real_t* mean = _sortedMeanArray + c*PARTIAL_DIST_STEP;
+  const real_t* covInv = _sortedCovInvArray + c*PARTIAL_DIST_STEP;
+  lk_t llk = _logWeightCstArray[c];
+  for (unsigned long s=0; s<segCount; s++)
+    llk -= 0.5*computeSegmentDist(x+s*PARTIAL_DIST_STEP, mean+s*segSize,
+                                  covInv+s*segSize);
+  return llk;
+}
+//-------------------------------------------------------------------------
+// The bound of a distribution is its log-constante minus half its partial
+// distance : it only decreases, down to the weighted log-likelihood. The
+// bounds are computed segment by segment for all the remaining
+// distributions at once (the distributions are independent, so the
+// processor overlaps their computations). After the first segment, the
+// log-likelihoods of the CANDIDATE_FACTOR*n distributions with the highest
+// bounds are computed completely. Their n-th best value is lower than or
+// equal to the n-th best of the mixture : a distribution whose bound falls
+// below it is rejected, and the n best distributions never are.
+//-------------------------------------------------------------------------
+unsigned long C::searchTopDistribs(const Feature& f, unsigned long n,
+                          LKVector& topVect, DoubleVector& tmp) const
+{
+  assertVectSize(f.getVectSize());
+  if (n > _distribCount)
+    n = _distribCount;
+  if (n == 0)
+  {
+    topVect.setSize(0);
+    return 0;
+  }
+  prepareSearch();
+  const real_t* data = f.getDataVector();
+  const unsigned long* order = _dimOrderVect.getArray();
+  const unsigned long segCount = getSegmentCount(_vectSize);
+  const unsigned long segSize = _distribCount*PARTIAL_DIST_STEP;
+  const unsigned long xSize = segCount*PARTIAL_DIST_STEP;
+  unsigned long i, c, s;
+  tmp.setSize(xSize);
+  real_t* x = tmp.getArray();
+  for (i=0; i<_vectSize; i++)
+    x[i] = data[order[i]];
+  for (; i<xSize; i++)
+    x[i] = 0.0;
+  // the candidates are stored after the distributions, in a min-heap
+  unsigned long candCount = CANDIDATE_FACTOR*n;
+  if (candCount > _distribCount)
+    candCount = _distribCount;
+  topVect.setSize(_distribCount+candCount);
+  LKVector::type* v = topVect.getArray();
+  LKVector::type* h = v+_distribCount;
+  for (c=0; c<_distribCount; c++)
+  {
+    v[c].idx = c;
+    v[c].lk = _logWeightCstArray[c] - 0.5*computeSegmentDist(x,
+                                _sortedMeanArray+c*PARTIAL_DIST_STEP,
+                                _sortedCovInvArray+c*PARTIAL_DIST_STEP);
+    if (c < candCount)
+    {
+      h[c] = v[c];
+      std::push_heap(h, h+c+1, GreaterLogLK());
+    }
+    else if (v[c].lk > h[0].lk)
+    {
+      std::pop_heap(h, h+candCount, GreaterLogLK());
+      h[candCount-1] = v[c];
+      std::push_heap(h, h+candCount, GreaterLogLK());
+    }
+  }
+  for (i=0; i<candCount; i++)
+    h[i].lk = computeSortedLogLK(x, h[i].idx);
+  std::nth_element(h, h+n-1, h+candCount, GreaterLogLK());
+  const lk_t bound = h[n-1].lk;
+  // a NaN bound is never lower than the limit : the distribution is kept
+  unsigned long count = _distribCount;
+  for (s=1; s<=segCount; s++)
+  {
+    unsigned long kept = 0;
+    for (i=0; i<count; i++)
+    {
+      if (v[i].lk < bound)
+        continue;
+      v[kept] = v[i];
+      if (s < segCount)
+      {
+        c = v[kept].idx;
+        v[kept].lk -= 0.5*computeSegmentDist(x+s*PARTIAL_DIST_STEP,
+                          _sortedMeanArray+s*segSize+c*PARTIAL_DIST_STEP,
+                          _sortedCovInvArray+s*segSize+c*PARTIAL_DIST_STEP);
+      }
+      kept++;
+    }
+    count = kept;
+  }
+  const lk_t logEPS = log(EPS_LK);
+  for (i=0; i<count; i++)
+    if (ISNAN(v[i].lk))
+      v[i].lk = _logWeightArray[v[i].idx] + logEPS;
+  topVect.setSize(count);
+  topVect.descendingPartialSort(n);
+  topVect.setSize(n);
+  return count;
+}
+//-------------------------------------------------------------------------
+unsigned long C::getFrameBlockSize() { return FRAME_BLOCK_SIZE; }
+//-------------------------------------------------------------------------
+unsigned long C::getDistribCount() const { return _distribCount; }
+//-------------------------------------------------------------------------
+unsigned long C::getVectSize() const { return _vectSize; }
+//-------------------------------------------------------------------------
+unsigned long C::getStride() const { return _stride; }
+//-------------------------------------------------------------------------
+const real_t* C::getMeanArray() const { return _meanArray; }
+//-------------------------------------------------------------------------
+const real_t* C::getCovInvArray() const { return _covInvArray; }
+//-------------------------------------------------------------------------
+const real_t* C::getWeightArray() const { return _weightArray; }
+//-------------------------------------------------------------------------
+const real_t* C::getCstArray() const { return _cstArray; }
+//-------------------------------------------------------------------------
+const real_t* C::getLogWeightArray() const { return _logWeightArray; }
+//-------------------------------------------------------------------------
+const real_t* C::getLogCstArray() const { return _logCstArray; }
+//-------------------------------------------------------------------------
+const real_t* C::getLogWeightCstArray() const { return _logWeightCstArray; }
+//-------------------------------------------------------------------------
+const ULongVector& C::getDimOrderVect() const
+{
+  prepareSearch();
+  return _dimOrderVect;
+}
+//-------------------------------------------------------------------------
+void C::freeArrays() // private
+{
+  DistribKernel::freeArray(_meanArray);
+  DistribKernel::freeArray(_covInvArray);
+  DistribKernel::freeArray(_weightArray);
+  DistribKernel::freeArray(_cstArray);
+  DistribKernel::freeArray(_logWeightArray);
+  DistribKernel::freeArray(_logCstArray);
+  DistribKernel::freeArray(_logWeightCstArray);
+  DistribKernel::freeArray(_sortedMeanArray);
+  DistribKernel::freeArray(_sortedCovInvArray);
+  _meanArray = _covInvArray = _weightArray = _cstArray = NULL;
+  _logWeightArray = _logCstArray = _logWeightCstArray = NULL;
+  _sortedMeanArray = _sortedCovInvArray = NULL;
+}
+//-------------------------------------------------------------------------
+String C::getClassName() const { return "MixtureGDCompiled"; }
+//-------------------------------------------------------------------------
+String C::toString() const
+{
+  return Object::toString()
+    + "\n  distribCount = " + String::valueOf(_distribCount)
+    + "\n  vectSize     = " + String::valueOf(_vectSize)
+    + "\n  stride       = " + String::valueOf(_stride);
+}
+//-------------------------------------------------------------------------
+C::~MixtureGDCompiled() { freeArrays(); }
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_MixtureGDCompiled_cpp)
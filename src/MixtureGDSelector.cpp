@@ -0,0 +1,519 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_MixtureGDSelector_cpp)
+#define ALIZE_MixtureGDSelector_cpp
+
+#if defined(_WIN32)
+#define uint32_t unsigned __int32
+#else
+#include <stdint.h>
+#endif
+
+#include <cmath>
+#include <fstream>
+#include <memory.h>
+#include "MixtureGDSelector.h"
+#include "MixtureGD.h"
+#include "DistribGD.h"
+#include "DistribKernel.h"
+#include "Feature.h"
+#include "RealVector.h"
+#include "Exception.h"
+#include "alizeString.h"
+
+using namespace alize;
+using namespace std;
+typedef MixtureGDSelector G;
+
+// maximum number of k-means iterations and identifier of the files
+static const unsigned long MAX_ITERATIONS = 20;
+static const char FILE_MAGIC[4] = {'G', 'S', 'I', '1'};
+
+namespace
+{
+  void writeUInt4(ofstream& s, unsigned long v)
+  {
+    uint32_t x = (uint32_t)v;
+    s.write((const char*)&x, sizeof(x));
+  }
+
+  unsigned long readUInt4(ifstream& s)
+  {
+    uint32_t x = 0;
+    s.read((char*)&x, sizeof(x));
+    return x;
+  }
+}
+
+//-------------------------------------------------------------------------
+G::MixtureGDSelector(const MixtureGD& m, unsigned long clusterCount)
+:Object(), _distribCount(0), _vectSize(0), _clusterCount(clusterCount),
+ _stride(0), _meanArray(NULL), _covInvArray(NULL), _logCstArray(NULL),
+ _checksum(0), _mixtureVersion(0), _globalVersion(0)
+{
+  if (_clusterCount == 0)
+    _clusterCount = (unsigned long)(sqrt((double)m.getDistribCount())+0.5);
+  build(m);
+}
+//-------------------------------------------------------------------------
+bool G::isUpToDate(const MixtureGD& m) const
+{
+  if (m.getVersion() != _mixtureVersion
+      || m.getDistribCount() != _distribCount)
+    return false;
+  if (Distrib::getGlobalVersion() == _globalVersion)
+    return true;
+  Distrib** d = m.getTabDistrib();
+  const unsigned long* v = _distribVersionVect.getArray();
+  for (unsigned long c=0; c<_distribCount; c++)
+    if (d[c]->getVersion() != v[c])
+      return false;
+  return true;
+}
+//-------------------------------------------------------------------------
+void G::prepare(const MixtureGD& m)
+{
+  // read before the distributions : a later modification is not missed
+  const unsigned long globalVersion = Distrib::getGlobalVersion();
+  if (isUpToDate(m))
+    _globalVersion = globalVersion; // the next calls take the fast path
+  else
+    build(m);
+}
+//-------------------------------------------------------------------------
+void G::setVersions(const MixtureGD& m) // private
+{
+  _distribVersionVect.setSize(_distribCount);
+  unsigned long* v = _distribVersionVect.getArray();
+  for (unsigned long c=0; c<_distribCount; c++)
+    v[c] = m.getDistrib(c).getVersion();
+  _mixtureVersion = m.getVersion();
+  _globalVersion = Distrib::getGlobalVersion();
+}
+//-------------------------------------------------------------------------
+void G::allocArrays() // private
+{
+  freeArrays();
+  _stride = DistribKernel::getPaddedSize(_vectSize);
+  _meanArray   = DistribKernel::allocArray(_clusterCount*_stride);
+  _covInvArray = DistribKernel::allocArray(_clusterCount*_stride);
+  _logCstArray = DistribKernel::allocArray(_clusterCount);
+  memset(_meanArray, 0, _clusterCount*_stride*sizeof(real_t));
+  memset(_covInvArray, 0, _clusterCount*_stride*sizeof(real_t));
+  _clusterLKVect.setSize(_clusterCount);
+}
+//-------------------------------------------------------------------------
+void G::freeArrays() // private
+{
+  DistribKernel::freeArray(_meanArray);
+  DistribKernel::freeArray(_covInvArray);
+  DistribKernel::freeArray(_logCstArray);
+  _meanArray = _covInvArray = _logCstArray = NULL;
+}
+//-------------------------------------------------------------------------
+void G::build(const MixtureGD& m)
+{
+  _distribCount = m.getDistribCount();
+  _vectSize = m.getVectSize();
+  if (_clusterCount > _distribCount)
+    _clusterCount = _distribCount;
+  if (_clusterCount == 0 && _distribCount != 0)
+    _clusterCount = 1;
+  allocArrays();
+  cluster(m);
+  sortMembers();
+  _checksum = m.computeChecksum();
+  setVersions(m);
+}
+//-------------------------------------------------------------------------
+// k-means : each distribution goes to the cluster gaussian g which minimizes
+// the divergence KL(distribution || g), and the gaussian that minimizes the
+// weighted sum of the divergences of the members of a cluster is the one
+// with the same mean and variance as the weighted members
+//-------------------------------------------------------------------------
+void G::cluster(const MixtureGD& m) // private
+{
+  const unsigned long n = _vectSize;
+  unsigned long c, k, i, iter;
+  _clusterVect.setSize(_distribCount);
+  unsigned long* cl = _clusterVect.getArray();
+  if (_distribCount == 0)
+    return;
+  // log-determinant of the covariance matrix of each distribution
+  DoubleVector sumLogCovVect(_distribCount, _distribCount);
+  for (c=0; c<_distribCount; c++)
+  {
+    const DistribGD& d = m.getDistrib(c); // const : version unchanged
+    const real_t* covInv = d.getCovInvVect().getArray();
+    real_t s = 0.0;
+    for (i=0; i<n; i++)
+      s -= log(covInv[i]);
+    sumLogCovVect[c] = s;
+  }
+  DoubleVector sumLogCovInvVect(_clusterCount, _clusterCount);
+  DoubleVector divVect(_distribCount, _distribCount);
+  ULongVector countVect(_clusterCount, _clusterCount);
+
+  // divergence between distribution c and cluster gaussian k
+  #define DIVERGENCE(c, k, result) \
+  { \
+    const DistribGD& d = m.getDistrib(c); \
+    const real_t* mean = d.getMeanVect().getArray(); \
+    const real_t* covInv = d.getCovInvVect().getArray(); \
+    const real_t* clMean = _meanArray + (k)*_stride; \
+    const real_t* clCovInv = _covInvArray + (k)*_stride; \
+    real_t s = 0.0; \
+    for (i=0; i<n; i++) \
+    { \
+      const real_t diff = mean[i]-clMean[i]; \
+      s += (1.0/covInv[i] + diff*diff)*clCovInv[i]; \
+    } \
+    result = 0.5*(s - sumLogCovInvVect[k] - sumLogCovVect[c] - n); \
+  }
+
+  // initialization : the heaviest distribution, then the distribution the
+  // most distant from the clusters already chosen
+  const weight_t* w = m.getTabWeight().getArray();
+  unsigned long best = 0;
+  for (c=1; c<_distribCount; c++)
+    if (w[c] > w[best])
+      best = c;
+  for (k=0; k<_clusterCount; k++)
+  {
+    const DistribGD& d = m.getDistrib(best);
+    const real_t* mean = d.getMeanVect().getArray();
+    const real_t* covInv = d.getCovInvVect().getArray();
+    for (i=0; i<n; i++)
+    {
+      _meanArray[k*_stride+i] = mean[i];
+      _covInvArray[k*_stride+i] = covInv[i];
+    }
+    sumLogCovInvVect[k] = -sumLogCovVect[best];
+    best = 0;
+    for (c=0; c<_distribCount; c++)
+    {
+      real_t div;
+      DIVERGENCE(c, k, div);
+      if (k == 0 || div < divVect[c])
+      {
+        divVect[c] = div;
+        cl[c] = k;
+      }
+      if (divVect[c] > divVect[best])
+        best = c;
+    }
+  }
+
+  for (iter=0; iter<MAX_ITERATIONS; iter++)
+  {
+    computeClusterGaussians(m);
+    for (k=0; k<_clusterCount; k++)
+    {
+      real_t s = 0.0;
+      for (i=0; i<n; i++)
+        s += log(_covInvArray[k*_stride+i]);
+      sumLogCovInvVect[k] = s;
+      countVect[k] = 0;
+    }
+    unsigned long changeCount = 0;
+    for (c=0; c<_distribCount; c++)
+    {
+      unsigned long bestK = cl[c];
+      real_t bestDiv;
+      DIVERGENCE(c, bestK, bestDiv);
+      for (k=0; k<_clusterCount; k++)
+      {
+        real_t div;
+        DIVERGENCE(c, k, div);
+        if (div < bestDiv)
+        {
+          bestDiv = div;
+          bestK = k;
+        }
+      }
+      if (bestK != cl[c])
+        changeCount++;
+      cl[c] = bestK;
+      divVect[c] = bestDiv;
+      countVect[bestK]++;
+    }
+    // an empty cluster takes the distribution the most distant from its
+    // cluster
+    for (k=0; k<_clusterCount; k++)
+      if (countVect[k] == 0)
+      {
+        best = _distribCount;
+        for (c=0; c<_distribCount; c++)
+          if (countVect[cl[c]] > 1
+              && (best == _distribCount || divVect[c] > divVect[best]))
+            best = c;
+        countVect[cl[best]]--;
+        countVect[k]++;
+        cl[best] = k;
+        divVect[best] = 0.0;
+        changeCount++;
+      }
+    if (changeCount == 0)
+      break;
+  }
+  #undef DIVERGENCE
+  computeClusterGaussians(m);
+}
+//-------------------------------------------------------------------------
+void G::computeClusterGaussians(const MixtureGD& m) // private
+{
+  const unsigned long n = _vectSize;
+  const real_t logPI2 = log(PI2);
+  const weight_t* w = m.getTabWeight().getArray();
+  const unsigned long* cl = _clusterVect.getArray();
+  unsigned long c, k, i;
+  DoubleVector weightVect(_clusterCount, _clusterCount);
+  DoubleVector varVect(_clusterCount*_stride, _clusterCount*_stride);
+  real_t* var = varVect.getArray();
+  memset(_meanArray, 0, _clusterCount*_stride*sizeof(real_t));
+  memset(var, 0, _clusterCount*_stride*sizeof(real_t));
+  for (k=0; k<_clusterCount; k++)
+    weightVect[k] = 0.0;
+  // weight and mean
+  for (c=0; c<_distribCount; c++)
+  {
+    const real_t wc = (w[c] > EPS_LK ? w[c] : EPS_LK);
+    const DistribGD& d = m.getDistrib(c);
+    const real_t* mean = d.getMeanVect().getArray();
+    real_t* clMean = _meanArray + cl[c]*_stride;
+    weightVect[cl[c]] += wc;
+    for (i=0; i<n; i++)
+      clMean[i] += wc*mean[i];
+  }
+  for (k=0; k<_clusterCount; k++)
+    if (weightVect[k] != 0.0)
+      for (i=0; i<n; i++)
+        _meanArray[k*_stride+i] /= weightVect[k];
+  // variance : weighted variances of the members plus the dispersion of
+  // their means
+  for (c=0; c<_distribCount; c++)
+  {
+    const real_t wc = (w[c] > EPS_LK ? w[c] : EPS_LK);
+    const DistribGD& d = m.getDistrib(c);
+    const real_t* mean = d.getMeanVect().getArray();
+    const real_t* covInv = d.getCovInvVect().getArray();
+    const real_t* clMean = _meanArray + cl[c]*_stride;
+    real_t* clVar = var + cl[c]*_stride;
+    for (i=0; i<n; i++)
+    {
+      const real_t diff = mean[i]-clMean[i];
+      clVar[i] += wc*(1.0/covInv[i] + diff*diff);
+    }
+  }
+  for (k=0; k<_clusterCount; k++)
+  {
+    real_t sumLogCovInv = 0.0;
+    for (i=0; i<n; i++)
+    {
+      real_t& covInv = _covInvArray[k*_stride+i];
+      covInv = (weightVect[k] != 0.0 ? weightVect[k]/var[k*_stride+i] : 1.0);
+      sumLogCovInv += log(covInv);
+    }
+    _logCstArray[k] = log(weightVect[k] > EPS_LK ? weightVect[k] : EPS_LK)
+                    + 0.5*(sumLogCovInv - n*logPI2);
+  }
+}
+//-------------------------------------------------------------------------
+void G::sortMembers() // private
+{
+  unsigned long c, k;
+  const unsigned long* cl = _clusterVect.getArray();
+  _firstMemberVect.setSize(_clusterCount+1);
+  _memberVect.setSize(_distribCount);
+  unsigned long* first = _firstMemberVect.getArray();
+  for (k=0; k<=_clusterCount; k++)
+    first[k] = 0;
+  for (c=0; c<_distribCount; c++)
+    first[cl[c]+1]++;
+  for (k=0; k<_clusterCount; k++)
+    first[k+1] += first[k];
+  // first[k] is used as a cursor, then restored
+  for (c=0; c<_distribCount; c++)
+    _memberVect[first[cl[c]]++] = c;
+  for (k=_clusterCount; k>0; k--)
+    first[k] = first[k-1];
+  first[0] = 0;
+}
+//-------------------------------------------------------------------------
+unsigned long G::getDistribCount() const { return _distribCount; }
+//-------------------------------------------------------------------------
+unsigned long G::getClusterCount() const { return _clusterCount; }
+//-------------------------------------------------------------------------
+unsigned long G::getDefaultSearchedClusterCount() const
+{ return (_clusterCount+3)/4; }
+//-------------------------------------------------------------------------
+unsigned long G::getCluster(unsigned long c) const
+{
+  assertIsInBounds(__FILE__, __LINE__, c, _distribCount);
+  return _clusterVect[c];
+}
+//-------------------------------------------------------------------------
+const ULongVector& G::selectDistribs(const Feature& f, unsigned long n) const
+{
+  selectDistribs(f, _clusterLKVect, _selectedVect, n);
+  return _selectedVect;
+}
+//-------------------------------------------------------------------------
+void G::selectDistribs(const Feature& f, LKVector& clusterLKVect,
+                       ULongVector& selectedVect, unsigned long n) const
+{
+  if (f.getVectSize() != _vectSize)
+    throw Exception("distrib vectSize ("
+        + String::valueOf(_vectSize) + ") != feature vectSize ("
+      + String::valueOf(f.getVectSize()) + ")", __FILE__, __LINE__);
+  if (n == 0)
+    n = getDefaultSearchedClusterCount();
+  if (n > _clusterCount)
+    n = _clusterCount;
+  const real_t* data = f.getDataVector();
+  clusterLKVect.setSize(_clusterCount);
+  LKVector::type* v = clusterLKVect.getArray();
+  unsigned long k, i;
+  for (k=0; k<_clusterCount; k++)
+  {
+    v[k].idx = k;
+    v[k].lk = _logCstArray[k] - 0.5*DistribKernel::computeWeightedDist(
+        data, _meanArray+k*_stride, _covInvArray+k*_stride, _vectSize);
+  }
+  if (n < _clusterCount)
+    clusterLKVect.descendingPartialSort(n);
+  const unsigned long* first = _firstMemberVect.getArray();
+  const unsigned long* member = _memberVect.getArray();
+  unsigned long size = 0;
+  for (i=0; i<n; i++)
+    size += first[v[i].idx+1] - first[v[i].idx];
+  selectedVect.setSize(size);
+  unsigned long* s = selectedVect.getArray();
+  for (i=0; i<n; i++)
+    for (unsigned long j=first[v[i].idx]; j<first[v[i].idx+1]; j++)
+      *s++ = member[j];
+}
+//-------------------------------------------------------------------------
+void G::save(const FileName& f) const
+{
+  ofstream out(f.c_str(), ios::out|ios::binary);
+  if (!out)
+    throw IOException("Cannot open file", __FILE__, __LINE__, f);
+  out.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+  writeUInt4(out, _distribCount);
+  writeUInt4(out, _vectSize);
+  writeUInt4(out, _clusterCount);
+  writeUInt4(out, _checksum);
+  for (unsigned long c=0; c<_distribCount; c++)
+    writeUInt4(out, _clusterVect[c]);
+  if (!out)
+    throw IOException("Cannot write file", __FILE__, __LINE__, f);
+}
+//-------------------------------------------------------------------------
+bool G::load(const FileName& f, const MixtureGD& m)
+{
+  ifstream in(f.c_str(), ios::in|ios::binary);
+  if (!in)
+    return false;
+  char magic[sizeof(FILE_MAGIC)];
+  in.read(magic, sizeof(magic));
+  if (!in || memcmp(magic, FILE_MAGIC, sizeof(magic)) != 0)
+    throw IOException("Not a gaussian selection file", __FILE__, __LINE__,
+                      f);
+  const unsigned long distribCount = readUInt4(in);
+  const unsigned long vectSize = readUInt4(in);
+  const unsigned long clusterCount = readUInt4(in);
+  const unsigned long checksum = readUInt4(in);
+  if (!in)
+    throw IOException("Cannot read file", __FILE__, __LINE__, f);
+  if (distribCount != m.getDistribCount() || vectSize != m.getVectSize()
+      || checksum != m.computeChecksum())
+    return false;
+  ULongVector clusterVect(distribCount, distribCount);
+  for (unsigned long c=0; c<distribCount; c++)
+  {
+    clusterVect[c] = readUInt4(in);
+    if (clusterVect[c] >= clusterCount)
+      throw IOException("Invalid cluster index", __FILE__, __LINE__, f);
+  }
+  if (!in)
+    throw IOException("Cannot read file", __FILE__, __LINE__, f);
+  _distribCount = distribCount;
+  _vectSize = vectSize;
+  _clusterCount = clusterCount;
+  _checksum = checksum;
+  _clusterVect = clusterVect;
+  allocArrays();
+  computeClusterGaussians(m);
+  sortMembers();
+  setVersions(m);
+  return true;
+}
+//-------------------------------------------------------------------------
+String G::getClassName() const { return "MixtureGDSelector"; }
+//-------------------------------------------------------------------------
+String G::toString() const
+{
+  return Object::toString()
+    + "\n  distribCount = " + String::valueOf(_distribCount)
+    + "\n  vectSize     = " + String::valueOf(_vectSize)
+    + "\n  clusterCount = " + String::valueOf(_clusterCount);
+}
+//-------------------------------------------------------------------------
+G::~MixtureGDSelector() { freeArrays(); }
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_MixtureGDSelector_cpp)
@@ -85,24 +85,25 @@ void M::resetEM()
 {
   assert(_pMixture->getDistribCount() == _distribCount);
   resetOcc();
+  const unsigned long vectSize = _pMixture->getVectSize();
 
-  // copy the original mixture and its ditributions
-  if (_pMixtureForEM != NULL)
-    delete _pMixtureForEM;
-  _pMixtureForEM = &static_cast<MixtureGD&>(_pMixture->duplicate(K::k,
-                                            DUPL_DISTRIB));
-  // create and initialize a temporary mixtureGD to accumulate cov and mean
-  if (_pMixForAccumulation != NULL)
-    delete _pMixForAccumulation;
-  _pMixForAccumulation = &MixtureGD::create(K::k, "",
-                      _pMixtureForEM->getVectSize(),
-                      _pMixtureForEM->getDistribCount());
-  for (unsigned long c=0; c<_distribCount; c++)
+  // copy the original mixture and its ditributions. The copy is kept
+  // from one call to the next while the shape of the mixture is the same
+  if (_pMixtureForEM != NULL && _pMixtureForEM->getVectSize() != vectSize)
   {
-    DistribGD& d = _pMixForAccumulation->getDistrib(c);
-    d.getMeanVect().setAllValues(0.0);
-    d.getCovVect().setAllValues(0.0);
+    delete _pMixtureForEM;
+    _pMixtureForEM = NULL;
   }
+  if (_pMixtureForEM == NULL)
+    _pMixtureForEM = &static_cast<MixtureGD&>(_pMixture->duplicate(K::k,
+                                              DUPL_DISTRIB));
+  else
+    *_pMixtureForEM = *_pMixture;
+  // accumulators of mean and cov : one row of vectSize values per distrib
+  _accMeanVect.setSize(_distribCount*vectSize);
+  _accMeanVect.setAllValues(0.0);
+  _accCovVect.setSize(_distribCount*vectSize);
+  _accCovVect.setAllValues(0.0);
   _featureCounterForEM = 0.0;
   _resetedEM = true;
 }
@@ -110,17 +111,20 @@ void M::resetEM()
 occ_t M::computeAndAccumulateEM(const Feature& f, double w)
 {
   assertResetEMDone();
-  real_t sum = computeAndAccumulateOcc(f, w);
+  real_t sum = computeAndAccumulateOccForEM(f, w);
 
   Feature::data_t* dataVect = f.getDataVector();
   real_t t, *meanVect, *covVect;
   unsigned long vectSize = _pMixture->getVectSize();
+  const bool pruned = isEMPruned();
+  const unsigned long count = (pruned ? _emDistribVect.size()
+                                      : _distribCount);
 
-  for (unsigned long c=0; c<_distribCount; c++)
+  for (unsigned long k=0; k<count; k++)
   {
-    DistribGD& d = _pMixForAccumulation->getDistrib(c);
-    meanVect = d.getMeanVect().getArray();
-    covVect  = d.getCovVect().getArray();
+    const unsigned long c = (pruned ? _emDistribVect[k] : k);
+    meanVect = _accMeanVect.getArray()+c*vectSize;
+    covVect  = _accCovVect.getArray()+c*vectSize;
     
     for (unsigned long i=0; i<vectSize; i++)
     {
@@ -145,13 +149,8 @@ void M::addAccEM(const MixtureStat& mx)
   _accumulatedOccVect += m._accumulatedOccVect;
   _featureCounterForAccumulatedOcc += m._featureCounterForAccumulatedOcc;
 
-  for (unsigned long c=0; c<_distribCount; c++)
-  {
-    DistribGD& d = _pMixForAccumulation->getDistrib(c);
-    const DistribGD& d2 = m._pMixForAccumulation->getDistrib(c);
-    d.getCovVect() += d2.getCovVect();
-    d.getMeanVect() += d2.getMeanVect();
-  }
+  _accCovVect += m._accCovVect;
+  _accMeanVect += m._accMeanVect;
   _featureCounterForEM += m._featureCounterForEM;
 }
 //-------------------------------------------------------------------------
@@ -168,9 +167,8 @@ const Mixture& M::getEM()
     const occ_t occ = _accumulatedOccVect[c];
     if (occ > 0.0)
     {
-      DistribGD& dTmp = _pMixForAccumulation->getDistrib(c);
-      real_t* dTmpCovVect  = dTmp.getCovVect().getArray();
-      real_t* dTmpMeanVect = dTmp.getMeanVect().getArray();
+      const real_t* dTmpCovVect  = _accCovVect.getArray()+c*vectSize;
+      const real_t* dTmpMeanVect = _accMeanVect.getArray()+c*vectSize;
 
       DistribGD& d  = _pMixtureForEM->getDistrib(c);
       real_t* dCovVect   = d.getCovVect().getArray();
@@ -192,16 +190,52 @@ const Mixture& M::getEM()
       d.computeAll();
     }
   }
+  _pMixtureForEM->markModified();
   return *_pMixtureForEM;
 }
 //-------------------------------------------------------------------------
 MixtureGD& M::getInternalAccumEM()
 {
   assertResetEMDone();
-  assert(_pMixForAccumulation != NULL);
+  const unsigned long vectSize = _pMixture->getVectSize();
+  if (_pMixForAccumulation != NULL
+      && _pMixForAccumulation->getVectSize() != vectSize)
+  {
+    delete _pMixForAccumulation;
+    _pMixForAccumulation = NULL;
+  }
+  if (_pMixForAccumulation == NULL)
+    _pMixForAccumulation = &MixtureGD::create(K::k, "", vectSize,
+                                              _distribCount);
+  for (unsigned long c=0; c<_distribCount; c++)
+  {
+    DistribGD& d = _pMixForAccumulation->getDistrib(c);
+    real_t* meanVect = d.getMeanVect().getArray();
+    real_t* covVect  = d.getCovVect().getArray();
+    const real_t* accMeanVect = _accMeanVect.getArray()+c*vectSize;
+    const real_t* accCovVect  = _accCovVect.getArray()+c*vectSize;
+    for (unsigned long i=0; i<vectSize; i++)
+    {
+      meanVect[i] = accMeanVect[i];
+      covVect[i]  = accCovVect[i];
+    }
+    d.markModified();
+  }
   return *_pMixForAccumulation;
 }
 //-------------------------------------------------------------------------
+const DoubleVector& M::getAccumulatedMeanVect() const
+{
+  assertResetEMDone();
+  return _accMeanVect;
+}
+//-------------------------------------------------------------------------
+const DoubleVector& M::getAccumulatedCovVect() const
+{
+  assertResetEMDone();
+  return _accCovVect;
+}
+//-------------------------------------------------------------------------
 String M::getClassName() const { return "MixtureGDStat"; }
 //-------------------------------------------------------------------------
 M::~MixtureGDStat()
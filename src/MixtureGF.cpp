@@ -219,6 +219,24 @@ MixtureStat& MixtureGF::createNewMixtureStatObject(const K&,
 //-------------------------------------------------------------------------
 DistribType MixtureGF::getType() const { return DistribType_GF; }
 //-------------------------------------------------------------------------
+unsigned long MixtureGF::computeChecksum() const
+{
+  unsigned long h = Mixture::computeChecksum();
+  for (unsigned long c=0; c<getDistribCount(); c++)
+  {
+    const DistribGF& d = getDistrib(c); // const reads : version unchanged
+    h = updateChecksum(d.getCovInvMatrix().getArray(),
+                       _vectSize*_vectSize*sizeof(real_t), h);
+  }
+  return h;
+}
+//-------------------------------------------------------------------------
+void MixtureGF::prepare() const
+{
+  for (unsigned long c=0; c<getDistribCount(); c++)
+    getDistrib(c).updateCholesky();
+}
+//-------------------------------------------------------------------------
 String MixtureGF::getClassName() const { return "MixtureGF"; }
 //-------------------------------------------------------------------------
 String MixtureGF::toString() const
@@ -206,6 +206,7 @@ const Mixture& M::getEM()
       d.computeAll();
     }
   }
+  _pMixtureForEM->markModified();
   return *_pMixtureForEM;
 }
 //-------------------------------------------------------------------------
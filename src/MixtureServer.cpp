@@ -58,6 +58,7 @@
 //#include <cstdlib>
 
 #include <ctime>
+#include <new>
 #include "MixtureServer.h"
 #include "MixtureFileReader.h"
 #include "MixtureServerFileReader.h"
@@ -67,6 +68,8 @@
 #include "DistribGD.h"
 #include "DistribGF.h"
 #include "Exception.h"
+#include "MixtureGDSelector.h"
+#include "DistribDictCompiled.h"
 #include "XLine.h"
 #include "ULongVector.h"
 
@@ -75,10 +78,10 @@ typedef MixtureServer S;
 
 //-------------------------------------------------------------------------
 S::MixtureServer(const Config& c)
-:Object(), _config(c) { reset(); }
+:Object(), _config(c), _pCompiledDistribs(NULL) { reset(); }
 //-------------------------------------------------------------------------
 S::MixtureServer(const FileName& f, const Config& c)
-:Object(), _config(c)
+:Object(), _config(c), _pCompiledDistribs(NULL)
 {
   reset();
   load(f);
@@ -294,6 +297,7 @@ Mixture& S::loadMixture(const FileName& f)
   Mixture& m = createMixture(m0.getDistribCount(), m0.getType());
   m = m0;
   autoSetMixtureId(m, f);
+  loadSelector(m, f);
   return m;
 }
 //-------------------------------------------------------------------------
@@ -302,6 +306,7 @@ void S::loadMixture(Mixture& m, const FileName& f)
   MixtureFileReader r(f, _config);
   m = r.readMixture();
   autoSetMixtureId(m, f);
+  loadSelector(m, f);
 }
 //-------------------------------------------------------------------------
 Mixture& S::loadMixture(const FileName& f, DistribType type) // private
@@ -314,9 +319,24 @@ Mixture& S::loadMixture(const FileName& f, DistribType type) // private
   Mixture& m = createMixture(m0.getDistribCount(), type);
   m = m0; // operator= overloaded. // Does not copy Id.
   autoSetMixtureId(m, f);
+  loadSelector(m, f);
   return m;
 }
 //-------------------------------------------------------------------------
+void S::loadSelector(const Mixture& m, const FileName& f) // private
+{
+  if (!_config.getParam_gaussianSelection()
+      || m.getType() != DistribType_GD)
+    return;
+  const MixtureGD& mGD = static_cast<const MixtureGD&>(m);
+  FileName fullName = f + _config.getParam_gaussianSelectionFileExtension();
+  if (!f.beginsWith("/") && !f.beginsWith("./"))
+    fullName = _config.getParam_mixtureFilesPath() + fullName;
+  // read or built when the mixture determines top distributions
+  mGD.setSelectorFile(fullName,
+                      _config.getParam_gaussianSelectionClusterCount());
+}
+//-------------------------------------------------------------------------
 void S::autoSetMixtureId(Mixture& m, String id) // private
 {
   const String f = id;
@@ -364,6 +384,26 @@ DistribGF& S::getDistribGF(unsigned long i) const
 //-------------------------------------------------------------------------
 unsigned long S::getMixtureCount() const { return _mixtureDict.size(); }
 //-------------------------------------------------------------------------
+void S::prepareMixtures() const
+{
+  for (unsigned long i=0; i<getMixtureCount(); i++)
+    getMixture(i).prepare();
+  if (_pCompiledDistribs != NULL)
+    _pCompiledDistribs->prepare(*this);
+}
+//-------------------------------------------------------------------------
+const DistribDictCompiled& S::getCompiledDistribs() const
+{
+  if (_pCompiledDistribs == NULL)
+  {
+    _pCompiledDistribs = new (std::nothrow) DistribDictCompiled(*this);
+    assertMemoryIsAllocated(_pCompiledDistribs, __FILE__, __LINE__);
+  }
+  else
+    _pCompiledDistribs->update(*this);
+  return *_pCompiledDistribs;
+}
+//-------------------------------------------------------------------------
 Mixture& S::getMixture(unsigned long i) const
 { return _mixtureDict.getMixture(i); }
 //-------------------------------------------------------------------------
@@ -428,7 +468,11 @@ String S::toString() const
 //-------------------------------------------------------------------------
 String S::getClassName() const { return "MixtureServer"; }
 //-------------------------------------------------------------------------
-S::~MixtureServer() {}
+S::~MixtureServer()
+{
+  if (_pCompiledDistribs != NULL)
+    delete _pCompiledDistribs;
+}
 //-------------------------------------------------------------------------
 
 #endif // !defined(ALIZE_MixtureServer_cpp)
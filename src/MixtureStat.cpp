@@ -55,23 +55,125 @@
 #if !defined(ALIZE_MixtureStat_cpp)
 #define ALIZE_MixtureStat_cpp
 
-//#include <cmath>
+#include <cmath>
+#include <memory.h>
+#include <algorithm>
 #include "MixtureStat.h"
 #include "alizeString.h"
 #include "Mixture.h"
+#include "MixtureGD.h"
+#include "MixtureGDCompiled.h"
 #include "Distrib.h"
 #include "Exception.h"
 #include "Feature.h"
+#include "FrameBlock.h"
 #include "Config.h"
+#include "DistribKernel.h"
 #include "RealVector.h"
 #include "StatServer.h"
+#include "FeatureInputStream.h"
+#include "ThreadPool.h"
 
 using namespace alize;
 typedef MixtureStat S;
+
+static const unsigned long PARALLEL_CHUNK_SIZE = 256;  // frames per job
+static const unsigned long PARALLEL_WINDOW_CHUNKS = 16; // per thread
+
+// Orders distribution indexes by decreasing occupation
+struct GreaterOcc
+{
+  explicit GreaterOcc(const occ_t* occVect) :_occVect(occVect) {}
+  bool operator()(unsigned long a, unsigned long b) const
+  { return _occVect[a] > _occVect[b]; }
+  const occ_t* _occVect;
+};
+
+// One job per chunk of the frames read by the calling thread. Each thread
+// has its own StatServer, MixtureStat and buffers ; the result of each
+// chunk is stored apart and added by the calling thread.
+class ParallelAccTask : public ThreadTask
+{
+public :
+  ParallelAccTask(const Mixture& m, const Config& c, unsigned long
+    threadCount, unsigned long vectSize, double w, bool occ)
+    :_m(m), _w(w), _occ(occ), _frames(vectSize, 0)
+  {
+    for (unsigned long i=0; i<threadCount; i++)
+    {
+      StatServer* p = new (std::nothrow) StatServer(c);
+      Object::assertMemoryIsAllocated(p, __FILE__, __LINE__);
+      _ssVect.addObject(*p);
+      _statVect.addObject(p->createAndStoreMixtureStat(m));
+      FrameBlock* b = new (std::nothrow) FrameBlock(vectSize,
+                                                    PARALLEL_CHUNK_SIZE);
+      Object::assertMemoryIsAllocated(b, __FILE__, __LINE__);
+      _blockVect.addObject(*b);
+    }
+    _llkMatrix.setSize(threadCount*PARALLEL_CHUNK_SIZE);
+  }
+  ~ParallelAccTask()
+  {
+    _blockVect.deleteAllObjects();
+    _ssVect.deleteAllObjects(); // deletes the MixtureStat objects
+  }
+  void setChunkCount(unsigned long n)
+  {
+    _chunkLLKVect.setSize(n);
+    _chunkLastLLKVect.setSize(n);
+    if (_occ)
+      _chunkOccMatrix.setSize(n*_m.getDistribCount());
+  }
+  void runJob(unsigned long job, unsigned long thread)
+  {
+    const unsigned long first = job*PARALLEL_CHUNK_SIZE;
+    unsigned long n = _frames.getFrameCount()-first;
+    if (n > PARALLEL_CHUNK_SIZE)
+      n = PARALLEL_CHUNK_SIZE;
+    FrameBlock& b = _blockVect.getObject(thread);
+    b.setFrameCount(n);
+    memcpy(b.getFrame(0), _frames.getFrame(first),
+           n*b.getStride()*sizeof(real_t));
+    if (_occ)
+    {
+      MixtureStat& s = _statVect.getObject(thread);
+      s.resetOcc();
+      s.computeAndAccumulateOccBatch(b, _w);
+      const unsigned long distribCount = _m.getDistribCount();
+      memcpy(_chunkOccMatrix.getArray()+job*distribCount,
+             s.getAccumulatedOccVect().getArray(),
+             distribCount*sizeof(real_t));
+      return;
+    }
+    lk_t* llk = _llkMatrix.getArray()+thread*PARALLEL_CHUNK_SIZE;
+    _ssVect.getObject(thread).computeLLKBatch(_m, b, llk);
+    lk_t sum = 0.0;
+    for (unsigned long t=0; t<n; t++)
+      sum += llk[t]*_w;
+    _chunkLLKVect[job] = sum;
+    _chunkLastLLKVect[job] = llk[n-1];
+  }
+
+  const Mixture&         _m;
+  const double           _w;
+  const bool             _occ;
+  FrameBlock             _frames;       // frames read by the caller
+  DoubleVector           _chunkLLKVect; // results of each chunk
+  DoubleVector           _chunkLastLLKVect;
+  DoubleVector           _chunkOccMatrix;
+private :
+  RefVector<StatServer>  _ssVect;       // one per thread
+  RefVector<MixtureStat> _statVect;
+  RefVector<FrameBlock>  _blockVect;
+  DoubleVector           _llkMatrix;
+};
 //-------------------------------------------------------------------------
 S::MixtureStat(StatServer& ss, const Mixture& m, const Config& c)
 :Object(), _distribCount(m.getDistribCount()), _pMixture(&m), _config(c), 
- _minLLK(c.getParam_minLLK()), _maxLLK(c.getParam_maxLLK()), _llk(0),
+ _minLLK(c.getParam_minLLK()), _maxLLK(c.getParam_maxLLK()),
+ _logDomain(c.getParam_computeLLKInLogDomain()),
+ _emOccThreshold(c.getParam_emOccThreshold()),
+ _emTopDistribsCount(c.getParam_emTopDistribsCount()), _llk(0),
  _accumulatedLLK(0), _occVect(_distribCount, _distribCount),
  _accumulatedOccVect(_distribCount, _distribCount),
  _meanOccVect(_distribCount, _distribCount), _resetedEM(false),
@@ -89,6 +191,13 @@ lk_t S::computeLLK(const Feature& f)
 lk_t S::computeLLK(const Feature& f, unsigned long idx)
 { return _llk =  _pStatServer->computeLLK(*_pMixture, f, idx); }
 //-------------------------------------------------------------------------
+void S::computeLLKBatch(const FrameBlock& b, lk_t* llk)
+{
+  _pStatServer->computeLLKBatch(*_pMixture, b, llk);
+  if (b.getFrameCount() != 0)
+    _llk = llk[b.getFrameCount()-1];
+}
+//-------------------------------------------------------------------------
 lk_t S::getLLK() const { return _llk; }
 //-------------------------------------------------------------------------
 void S::resetLLK()
@@ -117,6 +226,21 @@ lk_t S::computeAndAccumulateLLK(const Feature& f, double w,
   return accumulateLLK(llk, w);
 }
 //-------------------------------------------------------------------------
+lk_t S::computeAndAccumulateLLK(const FeatureView& f, double w)
+{
+  lk_t llk = _pStatServer->computeLLK(*_pMixture, f);
+  return accumulateLLK(llk, w);
+}
+//-------------------------------------------------------------------------
+void S::computeAndAccumulateLLKBatch(const FrameBlock& b, lk_t* llk,
+                                     double w, const TopDistribsAction& a)
+{
+  _pStatServer->computeLLKBatch(*_pMixture, b, llk, a);
+  const unsigned long frameCount = b.getFrameCount();
+  for (unsigned long t=0; t<frameCount; t++)
+    accumulateLLK(llk[t], w);
+}
+//-------------------------------------------------------------------------
 lk_t S::computeAndAccumulateLLK(const Feature& f, 
 		const LKVector& topDistribsVector, double w)
 {
@@ -149,6 +273,127 @@ real_t S::computeAndAccumulateOcc(const Feature& f, weight_t w)
   return sum;
 }
 //-------------------------------------------------------------------------
+void S::computeAndAccumulateOccBatch(const FrameBlock& b, weight_t w)
+{
+  const unsigned long frameCount = b.getFrameCount();
+  unsigned long t, c;
+  if (_pMixture->getType() != DistribType_GD)
+  {
+    Feature f(b.getVectSize());
+    for (t=0; t<frameCount; t++)
+    {
+      b.getFeature(t, f);
+      computeAndAccumulateOcc(f, w);
+    }
+    return;
+  }
+  const MixtureGDCompiled& cm =
+             static_cast<const MixtureGD*>(_pMixture)->getCompiled();
+  const unsigned long n = MixtureGDCompiled::getFrameBlockSize();
+  DoubleVector lkMatrix(n*_distribCount, n*_distribCount);
+  occ_t* occVect = _occVect.getArray();
+  for (unsigned long t0=0; t0<frameCount; t0+=n)
+  {
+    const unsigned long count = (t0+n > frameCount ? frameCount-t0 : n);
+    if (_logDomain)
+      cm.computeWeightedLogLK(b, t0, count, lkMatrix.getArray());
+    else
+      cm.computeWeightedLK(b, t0, count, lkMatrix.getArray());
+    for (t=0; t<count; t++)
+    {
+      const lk_t* row = lkMatrix.getArray()+t*_distribCount;
+      for (c=0; c<_distribCount; c++)
+        occVect[c] = row[c];
+      if (_logDomain)
+        normalizeLogOccVect();
+      else
+        normalizeLKOccVect();
+      _accumulatedOccVect += (_occVect *= w);
+      _featureCounterForAccumulatedOcc += w;
+    }
+  }
+}
+//-------------------------------------------------------------------------
+lk_t S::computeAndAccumulateLLKParallel(FeatureInputStream& fs,
+                  unsigned long begin, unsigned long count, ThreadPool& pool,
+                  double w)
+{ return accumulateParallel(fs, begin, count, pool, w, false); }
+//-------------------------------------------------------------------------
+void S::computeAndAccumulateOccParallel(FeatureInputStream& fs,
+                  unsigned long begin, unsigned long count, ThreadPool& pool,
+                  weight_t w)
+{ accumulateParallel(fs, begin, count, pool, w, true); }
+//-------------------------------------------------------------------------
+unsigned long S::getParallelChunkSize() { return PARALLEL_CHUNK_SIZE; }
+//-------------------------------------------------------------------------
+lk_t S::accumulateParallel(FeatureInputStream& fs, unsigned long begin,
+                           unsigned long count, ThreadPool& pool, double w,
+                           bool occ) // private
+{
+  _pMixture->prepare(); // read-only for the threads
+  const unsigned long vectSize = fs.getVectSize();
+  const unsigned long windowSize = PARALLEL_CHUNK_SIZE
+                        *PARALLEL_WINDOW_CHUNKS*pool.getThreadCount();
+  ParallelAccTask task(*_pMixture, _config, pool.getThreadCount(),
+                       vectSize, w, occ);
+  Feature f(vectSize);
+  lk_t sum = 0.0;
+  unsigned long t, j, c;
+
+  fs.seekFeature(begin);
+  for (unsigned long done=0; done<count; )
+  {
+    const unsigned long n = (count-done > windowSize ?
+                             windowSize : count-done);
+    task._frames.clear();
+    for (t=0; t<n; t++)
+    {
+      if (!fs.readFeature(f))
+        throw Exception("End of the feature stream before the end of the"
+                        " segment", __FILE__, __LINE__);
+      task._frames.addFeature(f);
+    }
+    const unsigned long chunkCount =
+                         (n+PARALLEL_CHUNK_SIZE-1)/PARALLEL_CHUNK_SIZE;
+    task.setChunkCount(chunkCount);
+    pool.run(task, chunkCount);
+    // in the order of the frames
+    for (j=0; j<chunkCount; j++)
+    {
+      if (occ)
+      {
+        const real_t* row = task._chunkOccMatrix.getArray()
+                            +j*_distribCount;
+        for (c=0; c<_distribCount; c++)
+          _accumulatedOccVect[c] += row[c];
+      }
+      else
+        sum += task._chunkLLKVect[j];
+    }
+    for (t=0; t<n; t++)
+    {
+      if (occ)
+        _featureCounterForAccumulatedOcc += w;
+      else
+        _featureCounterForAccumulatedLK += w;
+    }
+    done += n;
+  }
+  if (count == 0)
+    return 0.0;
+  if (occ) // occupations of the last frame
+  {
+    computeOccVect(f);
+    _occVect *= w;
+  }
+  else
+  {
+    _accumulatedLLK += sum;
+    _llk = task._chunkLastLLKVect[task._chunkLastLLKVect.size()-1]*w;
+  }
+  return sum;
+}
+//-------------------------------------------------------------------------
 // calcule la contribution de la trame  chaque distribution de la mixture
 // -> _occVect[nb distrib]
 // 0 < occ(distrib) <= 1
@@ -157,23 +402,45 @@ real_t S::computeOccVect(const Feature& f) // private
 {
   // source : Amiral AppMM_IterationApp.c ContributionTrame(...)
 
-  // EPS_APP : Utilise pour tester si une trame a un poids total
-  // non negligeable
-
-  const real_t EPS_APP = 1e-200;
-
   occ_t sum = 0.0;
   unsigned long c;
   weight_t* weightVect  = _pMixture->getTabWeight().getArray();
   Distrib** distribVect = _pMixture->getTabDistrib();
   occ_t*  occVect   = _occVect.getArray(); 
 
-  for (c=0; c<_distribCount; c++)
+  if (_pMixture->getType() == DistribType_GD)
+  {
+    const MixtureGDCompiled& cm =
+               static_cast<const MixtureGD*>(_pMixture)->getCompiled();
+    // same code as computeAndAccumulateOccBatch()
+    if (_logDomain)
+    {
+      cm.computeWeightedLogLK(f, occVect);
+      return normalizeLogOccVect();
+    }
+    cm.computeWeightedLK(f, occVect);
+    return normalizeLKOccVect();
+  }
+  else
   {
-    Distrib* d = distribVect[c];
-    occVect[c] = weightVect[c] * d->computeLK(f);
-    sum += _occVect[c];
+    for (c=0; c<_distribCount; c++)
+    {
+      Distrib* d = distribVect[c];
+      occVect[c] = weightVect[c] * d->computeLK(f);
+      sum += _occVect[c];
+    }
   }
+  return normalizeOccVect(sum);
+}
+//-------------------------------------------------------------------------
+real_t S::normalizeOccVect(occ_t sum) // private
+{
+  // EPS_APP : Utilise pour tester si une trame a un poids total
+  // non negligeable
+
+  const real_t EPS_APP = 1e-200;
+
+  unsigned long c;
   if (sum > EPS_APP) /* si la trame a un poids non negligeable */
   {
     for (c=0; c<_distribCount; c++)
@@ -191,6 +458,105 @@ real_t S::computeOccVect(const Feature& f) // private
   return sum;
 }
 //-------------------------------------------------------------------------
+// _occVect contains the weighted likelihoods. Returns their sum.
+//-------------------------------------------------------------------------
+real_t S::normalizeLKOccVect() // private
+{
+  const occ_t* occVect = _occVect.getArray();
+  occ_t sum = 0.0;
+  for (unsigned long c=0; c<_distribCount; c++)
+    sum += occVect[c];
+  return normalizeOccVect(sum);
+}
+//-------------------------------------------------------------------------
+// _occVect contains the weighted log-likelihoods. No flooring is needed :
+// the normalization is done relative to the largest likelihood.
+// Returns the sum of the likelihoods (can underflow to 0)
+//-------------------------------------------------------------------------
+real_t S::normalizeLogOccVect() // private
+{
+  occ_t* occVect = _occVect.getArray();
+  unsigned long c;
+  const lk_t logSum = DistribKernel::computeLogSumExp(occVect, _distribCount);
+  occ_t sum = 0.0;
+  for (c=0; c<_distribCount; c++)
+    sum += occVect[c];
+  if (sum == 0.0) // infinite log-likelihoods : null occupations
+    return exp(logSum);
+  for (c=0; c<_distribCount; c++)
+    occVect[c] /= sum;
+  return exp(logSum);
+}
+//-------------------------------------------------------------------------
+bool S::isEMPruned() const // protected
+{
+  return _emOccThreshold > 0.0
+      || (_emTopDistribsCount != 0 && _emTopDistribsCount < _distribCount);
+}
+//-------------------------------------------------------------------------
+// Like computeAndAccumulateOcc() but the occupations are pruned by
+// pruneOccVect() if isEMPruned()
+//-------------------------------------------------------------------------
+real_t S::computeAndAccumulateOccForEM(const Feature& f, weight_t w)
+{
+  real_t sum = computeOccVect(f);
+  if (isEMPruned())
+    pruneOccVect();
+  _accumulatedOccVect += (_occVect *= w);
+  _featureCounterForAccumulatedOcc += w;
+  return sum;
+}
+//-------------------------------------------------------------------------
+// Keeps the emTopDistribsCount highest occupations of _occVect, then among
+// them the ones >= emOccThreshold (at least the highest one). The others
+// are set to 0 and the kept ones are normalized again. The indexes of the
+// kept distributions are stored in _emDistribVect, in increasing order.
+//-------------------------------------------------------------------------
+void S::pruneOccVect() // protected
+{
+  occ_t* occVect = _occVect.getArray();
+  unsigned long c, i, n = _distribCount;
+
+  _emSortVect.setSize(_distribCount);
+  unsigned long* idx = _emSortVect.getArray();
+  for (c=0; c<_distribCount; c++)
+    idx[c] = c;
+  if (_emTopDistribsCount != 0 && _emTopDistribsCount < _distribCount)
+  {
+    n = _emTopDistribsCount;
+    std::nth_element(idx, idx+n-1, idx+_distribCount, GreaterOcc(occVect));
+  }
+  unsigned long best = idx[0];
+  for (i=1; i<n; i++)
+    if (occVect[idx[i]] > occVect[best])
+      best = idx[i];
+
+  _emDistribVect.clear();
+  occ_t sum = 0.0;
+  for (i=0; i<n; i++)
+  {
+    c = idx[i];
+    if (occVect[c] >= _emOccThreshold || c == best)
+    {
+      _emDistribVect.addValue(c);
+      sum += occVect[c];
+    }
+  }
+  _emDistribVect.ascendingSort();
+  const unsigned long* keep = _emDistribVect.getArray();
+  const unsigned long keepCount = _emDistribVect.size();
+  for (c=0, i=0; c<_distribCount; c++)
+  {
+    if (i < keepCount && keep[i] == c)
+    {
+      occVect[c] /= sum;
+      i++;
+    }
+    else
+      occVect[c] = 0.0;
+  }
+}
+//-------------------------------------------------------------------------
 DoubleVector& S::getOccVect() { return _occVect; }
 //-------------------------------------------------------------------------
 const DoubleVector& S::getOccVect() const { return _occVect; }
@@ -61,6 +61,9 @@
 
 #include <cstdlib> // for exit()
 #include <cstdio>
+#if defined(THREAD) && defined(_MSC_VER)
+#include <intrin.h> // for _InterlockedIncrement()
+#endif
 #include "Object.h"
 #include "alizeString.h"
 #include "Exception.h"
@@ -107,7 +110,9 @@ Object::Object()
     _initialized = true;
   }
 
-#if !defined NDEBUG
+#if !defined NDEBUG && defined(THREAD)
+  incrementCounter(_creationCounter); // getMax() not maintained
+#elif !defined NDEBUG
   _creationCounter++;
   unsigned long diff = _creationCounter-_destructionCounter;
   if (diff > _max)
@@ -155,6 +160,38 @@ void Object::assertMemoryIsAllocated(const void* p, const char* f, int l)
 unsigned long Object::max(unsigned long a, unsigned long b)
 { return (a>=b?a:b); }
 //-------------------------------------------------------------------------
+unsigned long Object::updateChecksum(const void* p, unsigned long size,
+                                     unsigned long h)
+{
+  const unsigned char* b = (const unsigned char*)p;
+  for (unsigned long i=0; i<size; i++)
+    h = ((h ^ b[i]) * 16777619UL) & 0xffffffffUL;
+  return h;
+}
+//-------------------------------------------------------------------------
+unsigned long Object::incrementCounter(unsigned long& v) // static
+{
+#if defined(THREAD) && defined(__GNUC__)
+  return __sync_add_and_fetch(&v, 1);
+#elif defined(THREAD) && defined(_MSC_VER)
+  return (unsigned long)_InterlockedIncrement((volatile long*)&v);
+#else
+  return ++v;
+#endif
+}
+//-------------------------------------------------------------------------
+unsigned long Object::addToCounter(unsigned long& v, unsigned long n) // static
+{
+#if defined(THREAD) && defined(__GNUC__)
+  return __sync_add_and_fetch(&v, n);
+#elif defined(THREAD) && defined(_MSC_VER)
+  return (unsigned long)_InterlockedExchangeAdd((volatile long*)&v, (long)n)
+         + n;
+#else
+  return v += n;
+#endif
+}
+//-------------------------------------------------------------------------
 String Object::getParamTypeName(ParamType t)
 {
   if (t == PARAMTYPE_INTEGER)
@@ -319,7 +356,9 @@ MixtureFileReaderFormat Object::getMixtureFileReaderFormat(const String& name)
 //-------------------------------------------------------------------------
 Object::~Object()
 {
-#if !defined NDEBUG
+#if !defined NDEBUG && defined(THREAD)
+  incrementCounter(_destructionCounter);
+#elif !defined NDEBUG
   _destructionCounter++;
   unsigned long diff = _creationCounter-_destructionCounter;
   if (diff > _max)
@@ -0,0 +1,201 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_ScoreCache_cpp)
+#define ALIZE_ScoreCache_cpp
+
+#if defined(_WIN32)
+#define uint32_t unsigned __int32
+#else
+#include <stdint.h>
+#endif
+
+#include <fstream>
+#include <memory.h>
+#include "ScoreCache.h"
+#include "Exception.h"
+
+using namespace alize;
+using namespace std;
+typedef ScoreCache T;
+
+static const char FILE_MAGIC[4] = {'S', 'C', 'C', '1'};
+
+namespace
+{
+  void writeUInt4(ofstream& s, unsigned long v)
+  {
+    uint32_t x = (uint32_t)v;
+    s.write((const char*)&x, sizeof(x));
+  }
+
+  unsigned long readUInt4(ifstream& s)
+  {
+    uint32_t x = 0;
+    s.read((char*)&x, sizeof(x));
+    return x;
+  }
+
+  void writeString(ofstream& s, const String& v)
+  {
+    writeUInt4(s, v.length());
+    s.write(v.c_str(), v.length());
+  }
+
+  String readString(ifstream& s, char* buffer, unsigned long bufferSize)
+  {
+    const unsigned long n = readUInt4(s);
+    if (!s || n >= bufferSize)
+    {
+      s.setstate(ios::failbit);
+      return "";
+    }
+    s.read(buffer, n);
+    buffer[n] = 0;
+    return String(buffer);
+  }
+}
+
+//-------------------------------------------------------------------------
+T::ScoreCache(unsigned long worldChecksum)
+:Object(), _worldChecksum(worldChecksum) {}
+//-------------------------------------------------------------------------
+void T::reset(unsigned long worldChecksum)
+{
+  _worldChecksum = worldChecksum;
+  _map.clear();
+}
+//-------------------------------------------------------------------------
+void T::setScore(const String& model, const String& segment, real_t score)
+{ _map[key_t(model, segment)] = score; }
+//-------------------------------------------------------------------------
+bool T::getScore(const String& model, const String& segment,
+                 real_t& score) const
+{
+  map_t::const_iterator it = _map.find(key_t(model, segment));
+  if (it == _map.end())
+    return false;
+  score = it->second;
+  return true;
+}
+//-------------------------------------------------------------------------
+unsigned long T::getScoreCount() const { return _map.size(); }
+//-------------------------------------------------------------------------
+unsigned long T::getWorldChecksum() const { return _worldChecksum; }
+//-------------------------------------------------------------------------
+// magic, checksum, number of scores, then for each score : model,
+// segment (length on 4 bytes then characters), score (8 bytes)
+//-------------------------------------------------------------------------
+void T::save(const FileName& f) const
+{
+  ofstream out(f.c_str(), ios::out|ios::binary);
+  if (!out)
+    throw IOException("Cannot open file", __FILE__, __LINE__, f);
+  out.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+  writeUInt4(out, _worldChecksum);
+  writeUInt4(out, _map.size());
+  for (map_t::const_iterator it=_map.begin(); it!=_map.end(); it++)
+  {
+    writeString(out, it->first.first);
+    writeString(out, it->first.second);
+    const double score = it->second;
+    out.write((const char*)&score, sizeof(score));
+  }
+  if (!out)
+    throw IOException("Cannot write file", __FILE__, __LINE__, f);
+}
+//-------------------------------------------------------------------------
+bool T::load(const FileName& f)
+{
+  ifstream in(f.c_str(), ios::in|ios::binary);
+  if (!in)
+    return false;
+  char magic[sizeof(FILE_MAGIC)];
+  in.read(magic, sizeof(magic));
+  if (!in || memcmp(magic, FILE_MAGIC, sizeof(magic)) != 0)
+    throw IOException("Not a score cache file", __FILE__, __LINE__, f);
+  if (readUInt4(in) != _worldChecksum)
+    return false;
+  const unsigned long n = readUInt4(in);
+  map_t m;
+  char buffer[4096];
+  for (unsigned long i=0; i<n && in; i++)
+  {
+    const String model = readString(in, buffer, sizeof(buffer));
+    const String segment = readString(in, buffer, sizeof(buffer));
+    double score = 0.0;
+    in.read((char*)&score, sizeof(score));
+    m[key_t(model, segment)] = score;
+  }
+  if (!in)
+    throw IOException("Cannot read file", __FILE__, __LINE__, f);
+  for (map_t::const_iterator it=m.begin(); it!=m.end(); it++)
+    _map[it->first] = it->second;
+  return true;
+}
+//-------------------------------------------------------------------------
+String T::getClassName() const { return "ScoreCache"; }
+//-------------------------------------------------------------------------
+String T::toString() const
+{
+  return Object::toString()
+    + "\n  scoreCount    = " + String::valueOf((unsigned long)_map.size())
+    + "\n  worldChecksum = " + String::valueOf(_worldChecksum);
+}
+//-------------------------------------------------------------------------
+T::~ScoreCache() {}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_ScoreCache_cpp)
@@ -0,0 +1,237 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_ScoreNormalizer_cpp)
+#define ALIZE_ScoreNormalizer_cpp
+
+#include <cmath>
+#include "ScoreNormalizer.h"
+#include "ScoreCache.h"
+#include "TrialScorer.h"
+#include "Mixture.h"
+#include "ULongVector.h"
+#include "Exception.h"
+
+using namespace alize;
+typedef ScoreNormalizer T;
+
+//-------------------------------------------------------------------------
+T::ScoreNormalizer(const Config& c, MixtureServer& ms, const Mixture& world,
+                   ThreadPool& pool, ScoreCache& cache)
+:Object(), _config(c), _ms(ms), _world(world), _pool(pool), _cache(cache)
+{
+  const unsigned long worldChecksum = world.computeChecksum();
+  if (cache.getWorldChecksum() != worldChecksum)
+    cache.reset(worldChecksum);
+}
+//-------------------------------------------------------------------------
+void T::setZNormSegments(const XLine& l) { _zNormSegmentLine = l; }
+//-------------------------------------------------------------------------
+void T::setTNormModels(const XLine& l) { _tNormModelLine = l; }
+//-------------------------------------------------------------------------
+unsigned long T::computeScores(const XLine& models, const XLine& segments)
+{
+  TrialScorer ts(_config, _ms, _world, _pool);
+  ULongVector modelIdxVect;
+  real_t score;
+  unsigned long i, j;
+  for (i=0; i<segments.getElementCount(); i++)
+  {
+    const String& segment = segments.getElement(i, false);
+    for (j=0; j<models.getElementCount(); j++)
+    {
+      const String& model = models.getElement(j, false);
+      if (!_cache.getScore(model, segment, score))
+      {
+        ts.addTrial(segment, model);
+        modelIdxVect.addValue(j);
+      }
+    }
+  }
+  if (ts.getTrialCount() == 0)
+    return 0;
+  ts.run();
+  for (i=0; i<ts.getTrialCount(); i++)
+    _cache.setScore(models.getElement(modelIdxVect[i], false),
+                    ts.getTestName(ts.getTrialTest(i)), ts.getScore(i));
+  return ts.getTrialCount();
+}
+//-------------------------------------------------------------------------
+void T::prepare(const XLine& models, const XLine& segments, ScoreNorm n)
+{
+  unsigned long i, j;
+  if (n == ScoreNorm_Z || n == ScoreNorm_ZT)
+  {
+    if (_zNormSegmentLine.getElementCount() == 0)
+      throw Exception("No Z-norm segment", __FILE__, __LINE__);
+    computeZNormParams(models);
+  }
+  if (n == ScoreNorm_T || n == ScoreNorm_ZT)
+  {
+    const unsigned long cohortCount = _tNormModelLine.getElementCount();
+    if (cohortCount == 0)
+      throw Exception("No T-norm model", __FILE__, __LINE__);
+    computeScores(_tNormModelLine, segments);
+    if (n == ScoreNorm_ZT)
+      computeZNormParams(_tNormModelLine);
+    for (i=0; i<segments.getElementCount(); i++)
+    {
+      const String& segment = segments.getElement(i, false);
+      real_t sum = 0.0, sum2 = 0.0, zSum = 0.0, zSum2 = 0.0;
+      for (j=0; j<cohortCount; j++)
+      {
+        const String& model = _tNormModelLine.getElement(j, false);
+        const real_t s = getCachedScore(model, segment);
+        sum += s;
+        sum2 += s*s;
+        if (n == ScoreNorm_ZT)
+        {
+          const real_t z = apply(s, getParam(_zNormMap, model, "Z-norm"));
+          zSum += z;
+          zSum2 += z*z;
+        }
+      }
+      real_t mean = sum/cohortCount;
+      real_t var = sum2/cohortCount-mean*mean;
+      _tNormMap[segment] = param_t(mean, (var > 0.0 ? sqrt(var) : 0.0));
+      if (n == ScoreNorm_ZT)
+      {
+        mean = zSum/cohortCount;
+        var = zSum2/cohortCount-mean*mean;
+        _ztNormMap[segment] = param_t(mean, (var > 0.0 ? sqrt(var) : 0.0));
+      }
+    }
+  }
+}
+//-------------------------------------------------------------------------
+void T::computeZNormParams(const XLine& models) // private
+{
+  computeScores(models, _zNormSegmentLine);
+  const unsigned long segmentCount = _zNormSegmentLine.getElementCount();
+  for (unsigned long i=0; i<models.getElementCount(); i++)
+  {
+    const String& model = models.getElement(i, false);
+    real_t sum = 0.0, sum2 = 0.0;
+    for (unsigned long j=0; j<segmentCount; j++)
+    {
+      const real_t s = getCachedScore(model,
+                               _zNormSegmentLine.getElement(j, false));
+      sum += s;
+      sum2 += s*s;
+    }
+    const real_t mean = sum/segmentCount;
+    const real_t var = sum2/segmentCount-mean*mean;
+    _zNormMap[model] = param_t(mean, (var > 0.0 ? sqrt(var) : 0.0));
+  }
+}
+//-------------------------------------------------------------------------
+real_t T::normalize(real_t score, const String& model,
+                    const String& segment, ScoreNorm n) const
+{
+  switch (n)
+  {
+    case ScoreNorm_Z:
+      return apply(score, getParam(_zNormMap, model, "Z-norm"));
+    case ScoreNorm_T:
+      return apply(score, getParam(_tNormMap, segment, "T-norm"));
+    default:
+      return apply(apply(score, getParam(_zNormMap, model, "Z-norm")),
+                   getParam(_ztNormMap, segment, "ZT-norm"));
+  }
+}
+//-------------------------------------------------------------------------
+const T::param_t& T::getParam(const map_t& m, const String& id,
+                              const char* name) const // private
+{
+  map_t::const_iterator it = m.find(id);
+  if (it == m.end())
+    throw Exception(String("No ") + name + " parameters for '" + id + "'",
+                    __FILE__, __LINE__);
+  return it->second;
+}
+//-------------------------------------------------------------------------
+real_t T::getCachedScore(const String& model,
+                         const String& segment) const // private
+{
+  real_t score;
+  if (!_cache.getScore(model, segment, score))
+    throw Exception("No score for model '" + model + "' and segment '"
+                    + segment + "'", __FILE__, __LINE__);
+  return score;
+}
+//-------------------------------------------------------------------------
+real_t T::apply(real_t score, const param_t& p) // private
+{
+  if (p.second > 0.0)
+    return (score-p.first)/p.second;
+  return score-p.first;
+}
+//-------------------------------------------------------------------------
+String T::getClassName() const { return "ScoreNormalizer"; }
+//-------------------------------------------------------------------------
+String T::toString() const
+{
+  return Object::toString()
+    + "\n  zNormSegments = "
+        + String::valueOf(_zNormSegmentLine.getElementCount())
+    + "\n  tNormModels   = "
+        + String::valueOf(_tNormModelLine.getElementCount())
+    + "\n  cachedScores  = " + String::valueOf(_cache.getScoreCount());
+}
+//-------------------------------------------------------------------------
+T::~ScoreNormalizer() {}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_ScoreNormalizer_cpp)
@@ -56,6 +56,7 @@
 #define ALIZE_StatServer_cpp
 
 #include <new>
+#include <memory.h>
 #include <cmath> // for log
 #if defined(_WIN32)
   #include <cfloat> // for _isnan()
@@ -74,6 +75,16 @@
 #include "MixtureGDStat.h"
 #include "MixtureGFStat.h"
 #include "Mixture.h"
+#include "MixtureGD.h"
+#include "MixtureGDCompiled.h"
+#include "MixtureGDSelector.h"
+#include "DistribDictCompiled.h"
+#include "DistribKernel.h"
+#include "ThreadPool.h"
+#include "FrameBlock.h"
+#include "Feature.h"
+#include "FeatureView.h"
+#include "FeatureInputStream.h"
 #include "Exception.h"
 #include "Config.h"
 #include "RealVector.h"
@@ -95,15 +106,22 @@ typedef StatServer S;
 S::StatServer(const Config& c)
 :Object(), _config(c), _pMixtureServer(NULL), 
 _topDistribsVect(0, 0), _minLLK(c.getParam_minLLK()), 
-_maxLLK(c.getParam_maxLLK()){ 
+_maxLLK(c.getParam_maxLLK()),
+_logDomain(c.getParam_computeLLKInLogDomain()),
+_gaussianSelection(c.getParam_gaussianSelection()),
+_searchedClusterCount(c.getParam_gaussianSelectionSearchedClusterCount()),
+_topDistribsPruning(c.getParam_topDistribsPruning()){ 
 	reset(); 
 	}
 //-------------------------------------------------------------------------
 S::StatServer(const Config& c, MixtureServer& ms)
 :Object(), _config(c), _pMixtureServer(&ms),
  _topDistribsVect(0, 0), _minLLK(c.getParam_minLLK()),
-_maxLLK(c.getParam_maxLLK())
-
+_maxLLK(c.getParam_maxLLK()),
+_logDomain(c.getParam_computeLLKInLogDomain()),
+_gaussianSelection(c.getParam_gaussianSelection()),
+_searchedClusterCount(c.getParam_gaussianSelectionSearchedClusterCount()),
+_topDistribsPruning(c.getParam_topDistribsPruning())
 { reset(); }
 //-------------------------------------------------------------------------
 void S::reset()
@@ -113,6 +131,8 @@ void S::reset()
   _pLastMixture = NULL;
   _pLastMixtureStat = NULL;
   _topDistribsVect.clear();
+  _topDistribsBlockVect.deleteAllObjects();
+  _distribLKFrameCount = 0;
 }
 //-------------------------------------------------------------------------
 real_t S::getAccumulatedOccFeatureCount(const Mixture& m)
@@ -148,6 +168,14 @@ lk_t S::getMeanLLK(const Mixture& m) { return getMixtureStat(m).getMeanLLK(); }
 //-------------------------------------------------------------------------
 lk_t S::computeLLK(const Mixture& m, const Feature& f) const
 {
+  if (m.getType() == DistribType_GD) // packed parameters, no virtual call
+  {
+    const MixtureGDCompiled& cm =
+                     static_cast<const MixtureGD&>(m).getCompiled();
+    if (_logDomain)
+      return computeLogLLK(cm.computeWeightedLogLKSum(f, _tmpVect));
+    return computeLLK(cm.computeWeightedLKSum(f));
+  }
   lk_t lk = 0.0;
   weight_t*  w = m.getTabWeight().getArray();
   Distrib**  d = m.getTabDistrib();
@@ -158,6 +186,25 @@ lk_t S::computeLLK(const Mixture& m, const Feature& f) const
   return computeLLK(lk);
 }
 //-------------------------------------------------------------------------
+lk_t S::computeLLK(const Mixture& m, const FeatureView& f) const
+{
+  if (m.getType() == DistribType_GD) // the float data are not converted
+  {
+    const MixtureGDCompiled& cm =
+                     static_cast<const MixtureGD&>(m).getCompiled();
+    if (_logDomain)
+      return computeLogLLK(cm.computeWeightedLogLKSum(f, _tmpVect));
+    return computeLLK(cm.computeWeightedLKSum(f));
+  }
+  lk_t lk = 0.0;
+  weight_t*  w = m.getTabWeight().getArray();
+  Distrib**  d = m.getTabDistrib();
+  unsigned long distribCount = m.getDistribCount();
+  for (unsigned long c=0; c<distribCount; c++)
+    lk += w[c] * d[c]->computeLK(f);
+  return computeLLK(lk);
+}
+//-------------------------------------------------------------------------
 lk_t S::computeLLK(const Mixture& m, const Feature& f, unsigned long idx) const
 {
   lk_t lk = 0.0;
@@ -195,54 +242,170 @@ lk_t S::computeLLK(lk_t lk) const // private
   return lk;
 }
 //-------------------------------------------------------------------------
+// same limits as computeLLK(lk_t) for a value already in the log domain
+//-------------------------------------------------------------------------
+lk_t S::computeLogLLK(lk_t llk) const // private
+{
+  if (!DistribKernel::isFinite(llk)) // kept by -ffast-math
+    return (DistribKernel::isNaN(llk) || llk < 0.0 ? _minLLK : _maxLLK);
+  if (llk < _minLLK)
+    return _minLLK;
+  if (llk > _maxLLK)
+    return _maxLLK;
+  return llk;
+}
+//-------------------------------------------------------------------------
 lk_t S::computeLLK(const K&, const Mixture& m, const Feature& f,
                    const TopDistribsAction& a)
 {
   if (a == TOP_DISTRIBS_NO_ACTION)
     return computeLLK(m, f);
-
-  LKVector& lkVect = _topDistribsVect;
+  if (a == USE_TOP_DISTRIBS)
+    return useTopDistribs(m, f, _topDistribsVect);
+  // a == DETERMINE_TOP_DISTRIBS
+  return determineTopDistribs(m, f, _topDistribsVect);
+}
+//-------------------------------------------------------------------------
+lk_t S::determineTopDistribs(const Mixture& m, const Feature& f,
+                             LKVector& lkVect) const // private
+{
   lk_t lk = 0.0;
   weight_t* w = m.getTabWeight().getArray();
   Distrib** d = m.getTabDistrib();
-  unsigned long distribCount = m.getDistribCount();
-  unsigned long c, i, nTop = _config.getParam_topDistribsCount();
+  unsigned long c, distribCount = m.getDistribCount();
+  lkVect.setSize(distribCount);
+  LKVector::type* v = lkVect.getArray();
 
-  if (a == USE_TOP_DISTRIBS)
+  if (m.getType() == DistribType_GD)
   {
-    if (nTop >= distribCount)
-      nTop = distribCount;
-    if (distribCount != lkVect.size()) // TODO gerer ce cas
-      throw Exception("", __FILE__, __LINE__);
-    LKVector::type* v = lkVect.getArray();
-    real_t sumTopDistribWeights = 0.0;
-
-    for (i=0; i<nTop; i++)
+    const MixtureGD& mGD = static_cast<const MixtureGD&>(m);
+    const MixtureGDCompiled& cm = mGD.getCompiled();
+    const MixtureGDSelector* pSelector =
+                        (_gaussianSelection ? mGD.getSelector() : NULL);
+    if (pSelector != NULL)
     {
-      c = v[i].idx;
-      sumTopDistribWeights += w[c];
-      //lk += w[c] * d[c]->computeLK(f);
-      lk +=(v[c].lk =(w[c] * d[c]->computeLK(f)));
+      pSelector->selectDistribs(f, _clusterLKVect, _selectedVect,
+                                _searchedClusterCount);
+      const unsigned long n = _selectedVect.size();
+      if (n < _config.getParam_topDistribsCount() && n < distribCount)
+        pSelector = NULL; // too few candidates : no arbitrary top distribs
+    }
+    // the distributions which are not computed get EPS_LK
+    if (pSelector != NULL) // only the distributions of the best clusters
+    {
+      const ULongVector& s = _selectedVect;
+      for (c=0; c<distribCount; c++)
+      {
+        v[c].idx = c;
+        v[c].lk = EPS_LK;
+      }
+      lk = (distribCount-s.size())*EPS_LK;
+      for (unsigned long i=0; i<s.size(); i++)
+      {
+        c = s[i];
+        lk += (v[c].lk = w[c] * cm.computeLK(f, c));
+      }
+    }
+    else if (_topDistribsPruning) // only the distributions kept by the
+    {                             // partial distance search
+      cm.searchTopDistribs(f, _config.getParam_topDistribsCount(),
+                           _searchVect, _tmpVect);
+      const LKVector::type* s = _searchVect.getArray();
+      for (c=0; c<distribCount; c++)
+      {
+        v[c].idx = c;
+        v[c].lk = EPS_LK;
+      }
+      lk = (distribCount-_searchVect.size())*EPS_LK;
+      for (unsigned long i=0; i<_searchVect.size(); i++)
+      {
+        c = s[i].idx;
+        lk += (v[c].lk = w[c] * cm.computeLK(f, c));
+      }
+    }
+    else // same code as computeLLKBatch()
+    {
+      _tmpVect.setSize(distribCount);
+      cm.computeWeightedLK(f, _tmpVect.getArray());
+      return determineTopDistribs(m, _tmpVect.getArray(), lkVect);
     }
-    if (_config.getParam_computeLLKWithTopDistribs()) // COMPLETE
-      lk += lkVect.sumNonTopDistribLK *
-          (1.0 - sumTopDistribWeights) / lkVect.sumNonTopDistribWeights;
-    else // PARTIAL
-      if (nTop != 0)
-        lk /= sumTopDistribWeights;
-    return computeLLK(lk);
   }
-  // a == DETERMINE_TOP_DISTRIBS
+  else
+    for (c=0; c<distribCount; c++)
+    {
+      v[c].idx = c;
+      lk += (v[c].lk = w[c] * d[c]->computeLK(f));
+    }
+  return sortTopDistribs(m, lkVect, lk);
+}
+//-------------------------------------------------------------------------
+// lk : the weighted likelihoods of all the distributions. Shared by the
+// per-frame and the batch versions, which get the same sums.
+//-------------------------------------------------------------------------
+lk_t S::determineTopDistribs(const Mixture& m, const lk_t* lk,
+                             LKVector& lkVect) const // private
+{
+  const unsigned long distribCount = m.getDistribCount();
   lkVect.setSize(distribCount);
   LKVector::type* v = lkVect.getArray();
-  lkVect.topDistribsCount = nTop;
-
-  for (c=0; c<distribCount; c++)
+  lk_t sum = 0.0;
+  for (unsigned long c=0; c<distribCount; c++)
   {
     v[c].idx = c;
-    lk += (v[c].lk = w[c] * d[c]->computeLK(f));
+    sum += (v[c].lk = lk[c]);
+  }
+  return sortTopDistribs(m, lkVect, sum);
+}
+//-------------------------------------------------------------------------
+lk_t S::useTopDistribs(const Mixture& m, const Feature& f,
+                       LKVector& lkVect) const // private
+{
+  lk_t lk = 0.0;
+  weight_t* w = m.getTabWeight().getArray();
+  Distrib** d = m.getTabDistrib();
+  unsigned long distribCount = m.getDistribCount();
+  unsigned long c, i, nTop = _config.getParam_topDistribsCount();
+  const MixtureGDCompiled* pCompiled = NULL;
+  if (m.getType() == DistribType_GD)
+    pCompiled = &static_cast<const MixtureGD&>(m).getCompiled();
+
+  if (nTop >= distribCount)
+    nTop = distribCount;
+  if (lkVect.size() < nTop)
+    throw Exception("Top distributions not determined", __FILE__, __LINE__);
+  LKVector::type* v = lkVect.getArray();
+  real_t sumTopDistribWeights = 0.0;
+
+  for (i=0; i<nTop; i++)
+  {
+    c = v[i].idx;
+    sumTopDistribWeights += w[c];
+    //lk += w[c] * d[c]->computeLK(f);
+    if (pCompiled != NULL)
+      lk +=(v[i].lk =(w[c] * pCompiled->computeLK(f, c)));
+    else
+      lk +=(v[i].lk =(w[c] * d[c]->computeLK(f)));
   }
-  lkVect.descendingSort();
+  if (_config.getParam_computeLLKWithTopDistribs()) // COMPLETE
+    lk += lkVect.sumNonTopDistribLK *
+        (1.0 - sumTopDistribWeights) / lkVect.sumNonTopDistribWeights;
+  else // PARTIAL
+    if (nTop != 0)
+      lk /= sumTopDistribWeights;
+  return computeLLK(lk);
+}
+//-------------------------------------------------------------------------
+// lkVect contains the weighted likelihoods of all the distributions and lk
+// their sum
+//-------------------------------------------------------------------------
+lk_t S::sortTopDistribs(const Mixture& m, LKVector& lkVect,
+                        lk_t lk) const // private
+{
+  weight_t* w = m.getTabWeight().getArray();
+  unsigned long i, nTop = _config.getParam_topDistribsCount();
+  LKVector::type* v = lkVect.getArray();
+  lkVect.topDistribsCount = nTop;
+  lkVect.descendingPartialSort(nTop);
   //
   if (_config.getParam_computeLLKWithTopDistribs() == true) // COMPLETE
   {
@@ -261,6 +424,118 @@ lk_t S::computeLLK(const K&, const Mixture& m, const Feature& f,
   return computeLLK(lk);
 }
 //-------------------------------------------------------------------------
+void S::computeLLKBatch(const Mixture& m, const FrameBlock& b,
+                        lk_t* llk) const
+{
+  const unsigned long frameCount = b.getFrameCount();
+  unsigned long t;
+  if (m.getType() == DistribType_GD) // all the frames at once
+  {
+    const MixtureGDCompiled& cm =
+                     static_cast<const MixtureGD&>(m).getCompiled();
+    if (_logDomain)
+    {
+      cm.computeWeightedLogLKSum(b, llk);
+      for (t=0; t<frameCount; t++)
+        llk[t] = computeLogLLK(llk[t]);
+    }
+    else
+    {
+      cm.computeWeightedLKSum(b, llk);
+      for (t=0; t<frameCount; t++)
+        llk[t] = computeLLK(llk[t]);
+    }
+    return;
+  }
+  Feature f(b.getVectSize());
+  for (t=0; t<frameCount; t++)
+  {
+    b.getFeature(t, f);
+    llk[t] = computeLLK(m, f);
+  }
+}
+//-------------------------------------------------------------------------
+void S::computeLLKBatch(const Mixture& m, const FrameBlock& b, lk_t* llk,
+                        const TopDistribsAction& a)
+{
+  const unsigned long frameCount = b.getFrameCount();
+  unsigned long t;
+  if (a == TOP_DISTRIBS_NO_ACTION)
+  {
+    computeLLKBatch(m, b, llk);
+    return;
+  }
+  if (a == USE_TOP_DISTRIBS)
+  {
+    if (frameCount > _topDistribsBlockVect.size())
+      throw Exception("Top distributions not determined for all the frames"
+                      " of the block", __FILE__, __LINE__);
+    Feature f(b.getVectSize());
+    for (t=0; t<frameCount; t++)
+    {
+      b.getFeature(t, f);
+      llk[t] = useTopDistribs(m, f, _topDistribsBlockVect[t]);
+    }
+    return;
+  }
+  // a == DETERMINE_TOP_DISTRIBS
+  if (frameCount == 0)
+    return;
+  if (m.getType() != DistribType_GD || _topDistribsPruning
+      || (_gaussianSelection
+      && static_cast<const MixtureGD&>(m).getSelector() != NULL))
+  {
+    Feature f(b.getVectSize());
+    for (t=0; t<frameCount; t++)
+    {
+      b.getFeature(t, f);
+      llk[t] = determineTopDistribs(m, f, getTopDistribsBlockVect(t));
+    }
+  }
+  else // the likelihoods of a group of frames at once
+  {
+    const MixtureGDCompiled& cm = static_cast<const MixtureGD&>(m)
+                                                       .getCompiled();
+    const unsigned long distribCount = m.getDistribCount();
+    const unsigned long n = MixtureGDCompiled::getFrameBlockSize();
+    DoubleVector lkMatrix(n*distribCount, n*distribCount);
+    for (unsigned long t0=0; t0<frameCount; t0+=n)
+    {
+      const unsigned long count = (t0+n > frameCount ? frameCount-t0 : n);
+      cm.computeWeightedLK(b, t0, count, lkMatrix.getArray());
+      for (t=0; t<count; t++)
+        llk[t0+t] = determineTopDistribs(m,
+                    lkMatrix.getArray()+t*distribCount,
+                    getTopDistribsBlockVect(t0+t));
+    }
+  }
+  // same state as after the per-frame computation
+  const LKVector& last = _topDistribsBlockVect[frameCount-1];
+  _topDistribsVect.setSize(last.size());
+  memcpy(_topDistribsVect.getArray(), last.getArray(),
+         last.size()*sizeof(LKVector::type));
+  _topDistribsVect.sumNonTopDistribWeights = last.sumNonTopDistribWeights;
+  _topDistribsVect.sumNonTopDistribLK = last.sumNonTopDistribLK;
+  _topDistribsVect.topDistribsCount = last.topDistribsCount;
+}
+//-------------------------------------------------------------------------
+LKVector& S::getTopDistribsBlockVect(unsigned long t) // private
+{
+  while (t >= _topDistribsBlockVect.size())
+  {
+    LKVector* p = new (std::nothrow) LKVector(0, 0);
+    assertMemoryIsAllocated(p, __FILE__, __LINE__);
+    _topDistribsBlockVect.addObject(*p);
+  }
+  return _topDistribsBlockVect[t];
+}
+//-------------------------------------------------------------------------
+const LKVector& S::getTopDistribIndexVector(unsigned long t) const
+{
+  assertIsInBounds(__FILE__, __LINE__, t, _topDistribsBlockVect.size());
+  return _topDistribsBlockVect[t];
+}
+//-------------------------------------------------------------------------
 lk_t S::computeLLK(const K&, const Mixture& m, const Feature& f,
                    const LKVector& lkVect)
 {
@@ -269,7 +544,9 @@ lk_t S::computeLLK(const K&, const Mixture& m, const Feature& f,
   Distrib** d = m.getTabDistrib();
   unsigned long distribCount = m.getDistribCount();
   unsigned long c, i, nTop = _config.getParam_topDistribsCount();
-
+  const MixtureGDCompiled* pCompiled = NULL;
+  if (m.getType() == DistribType_GD)
+    pCompiled = &static_cast<const MixtureGD&>(m).getCompiled();
 
   if (nTop >= distribCount)
     nTop = distribCount;
@@ -280,7 +557,10 @@ lk_t S::computeLLK(const K&, const Mixture& m, const Feature& f,
   {
     c = v[i].idx;
     sumTopDistribWeights += w[c];
-    lk += w[c] * d[c]->computeLK(f);
+    if (pCompiled != NULL)
+      lk += w[c] * pCompiled->computeLK(f, c);
+    else
+      lk += w[c] * d[c]->computeLK(f);
   }
   if (_config.getParam_computeLLKWithTopDistribs()) {// COMPLETE
     lk += lkVect.sumNonTopDistribLK *
@@ -295,15 +575,159 @@ lk_t S::computeLLK(const K&, const Mixture& m, const Feature& f,
   return computeLLK(lk);
 }
 //-------------------------------------------------------------------------
+lk_t S::computeMultiModelLLK(const Mixture& world,
+                  const RefVector<Mixture>& modelVect, FeatureInputStream& fs,
+                  unsigned long begin, unsigned long count,
+                  DoubleVector& llkVect)
+{
+  const unsigned long modelCount = modelVect.size();
+  const unsigned long distribCount = world.getDistribCount();
+  unsigned long i, j, c;
+  // packed parameters fetched once for the whole segment
+  RefVector<const MixtureGDCompiled> compiledVect(modelCount);
+  for (j=0; j<modelCount; j++)
+  {
+    const Mixture& m = modelVect.getObject(j);
+    if (m.getDistribCount() != distribCount)
+      throw Exception("Model '" + m.getId() + "' and world model do not"
+                " have the same number of distributions", __FILE__, __LINE__);
+    if (m.getType() == DistribType_GD)
+      compiledVect.addObject(static_cast<const MixtureGD&>(m).getCompiled());
+  }
+  llkVect.setSize(modelCount);
+  for (j=0; j<modelCount; j++)
+    llkVect[j] = 0.0;
+  unsigned long nTop = _config.getParam_topDistribsCount();
+  if (nTop > distribCount)
+    nTop = distribCount;
+  const bool complete = _config.getParam_computeLLKWithTopDistribs();
+  ULongVector topVect(nTop, nTop);
+  const unsigned long* top = topVect.getArray();
+  Feature f(fs.getVectSize());
+  lk_t worldLLK = 0.0;
+
+  fs.seekFeature(begin);
+  for (unsigned long t=0; t<count; t++)
+  {
+    if (!fs.readFeature(f))
+      throw Exception("End of the feature stream before the end of the"
+                      " segment", __FILE__, __LINE__);
+    worldLLK += determineTopDistribs(world, f, _topDistribsVect);
+    const LKVector::type* v = _topDistribsVect.getArray();
+    for (i=0; i<nTop; i++)
+      topVect[i] = v[i].idx;
+    // same computation as useTopDistribs()
+    unsigned long gd = 0;
+    for (j=0; j<modelCount; j++)
+    {
+      const Mixture& m = modelVect.getObject(j);
+      const weight_t* w = m.getTabWeight().getArray();
+      real_t sumTopDistribWeights = 0.0;
+      lk_t lk = 0.0;
+      if (m.getType() == DistribType_GD)
+      {
+        const MixtureGDCompiled& cm = compiledVect.getObject(gd++);
+        for (i=0; i<nTop; i++)
+        {
+          c = top[i];
+          sumTopDistribWeights += w[c];
+          lk += w[c] * cm.computeLK(f, c);
+        }
+      }
+      else
+      {
+        Distrib** d = m.getTabDistrib();
+        for (i=0; i<nTop; i++)
+        {
+          c = top[i];
+          sumTopDistribWeights += w[c];
+          lk += w[c] * d[c]->computeLK(f);
+        }
+      }
+      if (complete)
+        lk += _topDistribsVect.sumNonTopDistribLK *
+          (1.0 - sumTopDistribWeights) /
+          _topDistribsVect.sumNonTopDistribWeights;
+      else if (nTop != 0)
+        lk /= sumTopDistribWeights;
+      llkVect[j] += computeLLK(lk);
+    }
+  }
+  return worldLLK;
+}
+//-------------------------------------------------------------------------
 void S::computeAllDistribLK(const Feature& f)
+{ computeAllDistribLK(f, NULL); }
+//-------------------------------------------------------------------------
+void S::computeAllDistribLK(const Feature& f, ThreadPool& pool)
+{ computeAllDistribLK(f, &pool); }
+//-------------------------------------------------------------------------
+void S::computeAllDistribLK(const Feature& f, ThreadPool* pPool) // private
 {
   if (_pMixtureServer == NULL)
     throw Exception("No mixture server connected to this stat server"
         , __FILE__, __LINE__);
-  _distribLKVect.clear();
-  unsigned long n = _pMixtureServer->getDistribCount();
-  for (unsigned long i=0; i<n; i++)
-    _distribLKVect.addValue(_pMixtureServer->getDistrib(i).computeLK(f));
+  const unsigned long n = _pMixtureServer->getDistribCount();
+  _distribLKVect.setSize(n);
+  lk_t* lk = _distribLKVect.getArray();
+  const DistribDictCompiled& dc = _pMixtureServer->getCompiledDistribs();
+  if (!dc.isPacked()) // not only GD distributions
+    for (unsigned long i=0; i<n; i++)
+      lk[i] = _pMixtureServer->getDistrib(i).computeLK(f);
+  else if (pPool != NULL)
+    dc.computeLK(f, lk, *pPool);
+  else
+    dc.computeLK(f, lk);
+}
+//-------------------------------------------------------------------------
+void S::computeAllDistribLK(const FrameBlock& b)
+{ computeAllDistribLK(b, NULL); }
+//-------------------------------------------------------------------------
+void S::computeAllDistribLK(const FrameBlock& b, ThreadPool& pool)
+{ computeAllDistribLK(b, &pool); }
+//-------------------------------------------------------------------------
+void S::computeAllDistribLK(const FrameBlock& b, ThreadPool* pPool) // private
+{
+  if (_pMixtureServer == NULL)
+    throw Exception("No mixture server connected to this stat server"
+        , __FILE__, __LINE__);
+  const unsigned long n = _pMixtureServer->getDistribCount();
+  const unsigned long frameCount = b.getFrameCount();
+  _distribLKMatrix.setSize(frameCount*n);
+  _distribLKFrameCount = frameCount;
+  lk_t* lk = _distribLKMatrix.getArray();
+  const DistribDictCompiled& dc = _pMixtureServer->getCompiledDistribs();
+  if (!dc.isPacked()) // not only GD distributions
+  {
+    Feature f(b.getVectSize());
+    for (unsigned long t=0; t<frameCount; t++)
+    {
+      b.getFeature(t, f);
+      for (unsigned long i=0; i<n; i++)
+        lk[t*n+i] = _pMixtureServer->getDistrib(i).computeLK(f);
+    }
+  }
+  else if (pPool != NULL)
+    dc.computeLK(b, lk, *pPool);
+  else
+    dc.computeLK(b, lk);
+}
+//-------------------------------------------------------------------------
+void S::computeSharedLLKBatch(const Mixture& m, lk_t* llk) const
+{
+  const weight_t* weightVect = m.getTabWeight().getArray();
+  Distrib** distribVect = m.getTabDistrib();
+  const unsigned long distribCount = m.getDistribCount();
+  const unsigned long n = (_distribLKFrameCount == 0 ? 0 :
+                           _distribLKMatrix.size()/_distribLKFrameCount);
+  for (unsigned long t=0; t<_distribLKFrameCount; t++)
+  {
+    const lk_t* lkVect = _distribLKMatrix.getArray()+t*n;
+    lk_t lk = 0.0;
+    for (unsigned long c=0; c<distribCount; c++)
+      lk += lkVect[distribVect[c]->dictIndex(K::k)] * weightVect[c];
+    llk[t] = computeLLK(lk);
+  }
 }
 //-------------------------------------------------------------------------
 void S::resetOcc(const Mixture& m) { getMixtureStat(m).resetOcc(); }
@@ -324,11 +748,15 @@ void S::setTopDistribIndexVector(const ULongVector& indexVect,
                                   real_t w, real_t l)
 {
   unsigned long topDistribCount = indexVect.size();
-  if (topDistribCount>_topDistribsVect.size()) // TODO gerer ce cas
-    throw Exception("", __FILE__, __LINE__);
+  if (topDistribCount>_topDistribsVect.size()) // top distribs never determined
+    _topDistribsVect.setSize(topDistribCount);
   LKVector::type* v = _topDistribsVect.getArray();
   for (unsigned long i=0; i<topDistribCount; i++)
+  {
     v[i].idx = indexVect[i];
+    v[i].lk = 0.0;
+  }
+  _topDistribsVect.topDistribsCount = topDistribCount;
   _topDistribsVect.sumNonTopDistribWeights = w;
   _topDistribsVect.sumNonTopDistribLK = l;
 }
@@ -504,6 +932,7 @@ S::~StatServer()
 {
   //_mixtureStatVect.deleteAllObjects();
   _viterbiAccumVect.deleteAllObjects();
+  _topDistribsBlockVect.deleteAllObjects();
 }
 //-------------------------------------------------------------------------
 
@@ -0,0 +1,287 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+#if !defined(ALIZE_ThreadPool_cpp)
+#define ALIZE_ThreadPool_cpp
+
+#include <new>
+#include <exception>
+#if defined(THREAD) && !defined(_WIN32)
+#include <pthread.h>
+#include <unistd.h> // for sysconf()
+#endif
+#include "ThreadPool.h"
+#include "Exception.h"
+
+using namespace alize;
+typedef ThreadPool P;
+
+#if defined(THREAD) && !defined(_WIN32)
+struct ThreadArg
+{
+  ThreadPool*   pPool;
+  unsigned long index;
+};
+struct P::Workers
+{
+  pthread_mutex_t mutex;
+  pthread_cond_t  startCond;  // new task or end of the pool
+  pthread_cond_t  endCond;    // all the threads have finished the task
+  pthread_t*      threadArray;
+  ThreadArg*      argArray;
+  unsigned long   threadCount; // threads created
+  unsigned long   generation;  // incremented for each task
+  unsigned long   busyCount;   // threads still running the task
+  bool            stop;
+};
+#else
+struct P::Workers {};
+#endif
+
+//-------------------------------------------------------------------------
+ThreadTask::~ThreadTask() {}
+//-------------------------------------------------------------------------
+P::ThreadPool(unsigned long threadCount)
+:Object(), _threadCount(threadCount), _pWorkers(NULL), _pTask(NULL),
+ _jobCount(0), _nextJob(0), _failed(false), _errorLine(0)
+{
+#if defined(THREAD) && !defined(_WIN32)
+  if (_threadCount == 0)
+    _threadCount = getProcessorCount();
+  if (_threadCount == 1)
+    return;
+  _pWorkers = new (std::nothrow) Workers;
+  assertMemoryIsAllocated(_pWorkers, __FILE__, __LINE__);
+  Workers& w = *_pWorkers;
+  pthread_mutex_init(&w.mutex, NULL);
+  pthread_cond_init(&w.startCond, NULL);
+  pthread_cond_init(&w.endCond, NULL);
+  w.threadCount = 0;
+  w.generation = 0;
+  w.busyCount = 0;
+  w.stop = false;
+  // the caller is thread 0
+  w.threadArray = new (std::nothrow) pthread_t[_threadCount-1];
+  w.argArray = new (std::nothrow) ThreadArg[_threadCount-1];
+  if (w.threadArray == NULL || w.argArray == NULL)
+  {
+    stopThreads();
+    assertMemoryIsAllocated(NULL, __FILE__, __LINE__);
+  }
+  for (unsigned long i=0; i<_threadCount-1; i++)
+  {
+    w.argArray[i].pPool = this;
+    w.argArray[i].index = i+1;
+    if (pthread_create(&w.threadArray[i], NULL, threadMain,
+                       &w.argArray[i]) != 0)
+    {
+      stopThreads();
+      throw Exception("Cannot create thread #" + String::valueOf(i+1),
+                      __FILE__, __LINE__);
+    }
+    w.threadCount++;
+  }
+#else
+  _threadCount = 1;
+#endif
+}
+//-------------------------------------------------------------------------
+unsigned long P::getThreadCount() const { return _threadCount; }
+//-------------------------------------------------------------------------
+unsigned long P::getProcessorCount() // static
+{
+#if defined(THREAD) && !defined(_WIN32) && defined(_SC_NPROCESSORS_ONLN)
+  long n = sysconf(_SC_NPROCESSORS_ONLN);
+  return (n > 0 ? (unsigned long)n : 1);
+#else
+  return 1;
+#endif
+}
+//-------------------------------------------------------------------------
+void P::run(ThreadTask& t, unsigned long jobCount)
+{
+  _pTask = &t;
+  _jobCount = jobCount;
+  _nextJob = 0;
+  _failed = false;
+#if defined(THREAD) && !defined(_WIN32)
+  if (_pWorkers != NULL)
+  {
+    Workers& w = *_pWorkers;
+    pthread_mutex_lock(&w.mutex);
+    w.generation++;
+    w.busyCount = w.threadCount;
+    pthread_cond_broadcast(&w.startCond);
+    pthread_mutex_unlock(&w.mutex);
+    runJobs(0);
+    pthread_mutex_lock(&w.mutex);
+    while (w.busyCount != 0)
+      pthread_cond_wait(&w.endCond, &w.mutex);
+    pthread_mutex_unlock(&w.mutex);
+  }
+  else
+#endif
+    runJobs(0);
+  _pTask = NULL;
+  if (_failed)
+    throw Exception(_errorMsg, _errorSourceFile, _errorLine);
+}
+//-------------------------------------------------------------------------
+bool P::getNextJob(unsigned long& job) // private
+{
+#if defined(THREAD) && !defined(_WIN32)
+  if (_pWorkers != NULL)
+    pthread_mutex_lock(&_pWorkers->mutex);
+#endif
+  const bool found = (!_failed && _nextJob < _jobCount);
+  if (found)
+    job = _nextJob++;
+#if defined(THREAD) && !defined(_WIN32)
+  if (_pWorkers != NULL)
+    pthread_mutex_unlock(&_pWorkers->mutex);
+#endif
+  return found;
+}
+//-------------------------------------------------------------------------
+void P::setError(const String& msg, const String& sourceFile,
+                 int line) // private
+{
+#if defined(THREAD) && !defined(_WIN32)
+  if (_pWorkers != NULL)
+    pthread_mutex_lock(&_pWorkers->mutex);
+#endif
+  if (!_failed) // keeps the first one
+  {
+    _failed = true;
+    _errorMsg = msg;
+    _errorSourceFile = sourceFile;
+    _errorLine = line;
+  }
+#if defined(THREAD) && !defined(_WIN32)
+  if (_pWorkers != NULL)
+    pthread_mutex_unlock(&_pWorkers->mutex);
+#endif
+}
+//-------------------------------------------------------------------------
+void P::runJobs(unsigned long thread) // private
+{
+  unsigned long job;
+  while (getNextJob(job))
+  {
+    try { _pTask->runJob(job, thread); }
+    catch (Exception& e) { setError(e.msg, e.sourceFile, e.line); }
+    catch (std::exception& e) { setError(e.what(), __FILE__, __LINE__); }
+  }
+}
+//-------------------------------------------------------------------------
+void* P::threadMain(void* p) // private static
+{
+#if defined(THREAD) && !defined(_WIN32)
+  ThreadArg& a = *static_cast<ThreadArg*>(p);
+  ThreadPool& pool = *a.pPool;
+  Workers& w = *pool._pWorkers;
+  unsigned long generation = 0;
+  pthread_mutex_lock(&w.mutex);
+  while (true)
+  {
+    while (!w.stop && w.generation == generation)
+      pthread_cond_wait(&w.startCond, &w.mutex);
+    if (w.stop)
+      break;
+    generation = w.generation;
+    pthread_mutex_unlock(&w.mutex);
+    pool.runJobs(a.index);
+    pthread_mutex_lock(&w.mutex);
+    if (--w.busyCount == 0)
+      pthread_cond_signal(&w.endCond);
+  }
+  pthread_mutex_unlock(&w.mutex);
+#endif
+  return p;
+}
+//-------------------------------------------------------------------------
+void P::stopThreads() // private
+{
+#if defined(THREAD) && !defined(_WIN32)
+  if (_pWorkers == NULL)
+    return;
+  Workers& w = *_pWorkers;
+  pthread_mutex_lock(&w.mutex);
+  w.stop = true;
+  pthread_cond_broadcast(&w.startCond);
+  pthread_mutex_unlock(&w.mutex);
+  for (unsigned long i=0; i<w.threadCount; i++)
+    pthread_join(w.threadArray[i], NULL);
+  pthread_cond_destroy(&w.endCond);
+  pthread_cond_destroy(&w.startCond);
+  pthread_mutex_destroy(&w.mutex);
+  delete[] w.threadArray;
+  delete[] w.argArray;
+  delete _pWorkers;
+  _pWorkers = NULL;
+#endif
+}
+//-------------------------------------------------------------------------
+String P::getClassName() const { return "ThreadPool"; }
+//-------------------------------------------------------------------------
+String P::toString() const
+{
+  return Object::toString()
+    + "\n  threadCount = " + String::valueOf(_threadCount);
+}
+//-------------------------------------------------------------------------
+P::~ThreadPool() { stopThreads(); }
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_ThreadPool_cpp)
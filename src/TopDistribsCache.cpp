@@ -0,0 +1,278 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_TopDistribsCache_cpp)
+#define ALIZE_TopDistribsCache_cpp
+
+#if defined(_WIN32)
+#define uint16_t unsigned __int16
+#define uint32_t unsigned __int32
+#else
+#include <stdint.h>
+#endif
+
+#include <fstream>
+#include <memory.h>
+#include "TopDistribsCache.h"
+#include "LKVector.h"
+#include "StatServer.h"
+#include "Feature.h"
+#include "FeatureInputStream.h"
+#include "Exception.h"
+#include "alizeString.h"
+
+using namespace alize;
+using namespace std;
+typedef TopDistribsCache T;
+
+static const char FILE_MAGIC[4] = {'T', 'D', 'C', '1'};
+
+namespace
+{
+  void writeUInt4(ofstream& s, unsigned long v)
+  {
+    uint32_t x = (uint32_t)v;
+    s.write((const char*)&x, sizeof(x));
+  }
+
+  unsigned long readUInt4(ifstream& s)
+  {
+    uint32_t x = 0;
+    s.read((char*)&x, sizeof(x));
+    return x;
+  }
+}
+
+//-------------------------------------------------------------------------
+T::TopDistribsCache(unsigned long worldChecksum,
+                    unsigned long featureChecksum)
+:Object() { reset(worldChecksum, featureChecksum); }
+//-------------------------------------------------------------------------
+void T::reset(unsigned long worldChecksum, unsigned long featureChecksum)
+{
+  _worldChecksum = worldChecksum;
+  _featureChecksum = featureChecksum;
+  _frameCount = 0;
+  _topDistribsCount = 0;
+  _indexVect.clear();
+  _sumNonTopDistribWeightsVect.clear();
+  _sumNonTopDistribLKVect.clear();
+}
+//-------------------------------------------------------------------------
+void T::addFrame(const LKVector& v)
+{
+  unsigned long n = v.topDistribsCount;
+  if (n > v.size())
+    n = v.size();
+  if (_frameCount == 0)
+    _topDistribsCount = n;
+  else if (n != _topDistribsCount)
+    throw Exception("Number of top distributions (" + String::valueOf(n)
+      + ") != number of top distributions of the previous frames ("
+      + String::valueOf(_topDistribsCount) + ")", __FILE__, __LINE__);
+  const LKVector::type* a = v.getArray();
+  for (unsigned long i=0; i<n; i++)
+    _indexVect.addValue(a[i].idx);
+  _sumNonTopDistribWeightsVect.addValue(v.sumNonTopDistribWeights);
+  _sumNonTopDistribLKVect.addValue(v.sumNonTopDistribLK);
+  _frameCount++;
+}
+//-------------------------------------------------------------------------
+unsigned long T::getFrameCount() const { return _frameCount; }
+//-------------------------------------------------------------------------
+unsigned long T::getTopDistribsCount() const { return _topDistribsCount; }
+//-------------------------------------------------------------------------
+unsigned long T::getWorldChecksum() const { return _worldChecksum; }
+//-------------------------------------------------------------------------
+unsigned long T::getFeatureChecksum() const { return _featureChecksum; }
+//-------------------------------------------------------------------------
+unsigned long T::getTopDistribIndex(unsigned long t, unsigned long i) const
+{
+  assertIsInBounds(__FILE__, __LINE__, t, _frameCount);
+  assertIsInBounds(__FILE__, __LINE__, i, _topDistribsCount);
+  return _indexVect[t*_topDistribsCount+i];
+}
+//-------------------------------------------------------------------------
+real_t T::getSumNonTopDistribWeights(unsigned long t) const
+{
+  assertIsInBounds(__FILE__, __LINE__, t, _frameCount);
+  return _sumNonTopDistribWeightsVect[t];
+}
+//-------------------------------------------------------------------------
+real_t T::getSumNonTopDistribLK(unsigned long t) const
+{
+  assertIsInBounds(__FILE__, __LINE__, t, _frameCount);
+  return _sumNonTopDistribLKVect[t];
+}
+//-------------------------------------------------------------------------
+void T::setTopDistribIndexVector(StatServer& ss, unsigned long t) const
+{
+  assertIsInBounds(__FILE__, __LINE__, t, _frameCount);
+  _tmpVect.setSize(_topDistribsCount);
+  memcpy(_tmpVect.getArray(), _indexVect.getArray()+t*_topDistribsCount,
+         _topDistribsCount*sizeof(unsigned long));
+  ss.setTopDistribIndexVector(_tmpVect, _sumNonTopDistribWeightsVect[t],
+                              _sumNonTopDistribLKVect[t]);
+}
+//-------------------------------------------------------------------------
+unsigned long T::computeChecksum(FeatureInputStream& fs)
+{
+  unsigned long h = updateChecksum(NULL, 0);
+  Feature f(fs.getVectSize());
+  fs.seekFeature(0);
+  while (fs.readFeature(f))
+    h = updateChecksum(f.getDataVector(), f.getVectSize()*sizeof(real_t),
+                       h);
+  fs.seekFeature(0);
+  return h;
+}
+//-------------------------------------------------------------------------
+// magic, checksums, frame count, top distributions count, size of an index
+// (2 or 4 bytes), indices, sums of the weights, sums of the likelihoods
+//-------------------------------------------------------------------------
+void T::save(const FileName& f) const
+{
+  ofstream out(f.c_str(), ios::out|ios::binary);
+  if (!out)
+    throw IOException("Cannot open file", __FILE__, __LINE__, f);
+  const unsigned long n = _frameCount*_topDistribsCount;
+  const unsigned long* idx = _indexVect.getArray();
+  unsigned long i, indexSize = 2;
+  for (i=0; i<n; i++)
+    if (idx[i] > 0xffff)
+      indexSize = 4;
+  out.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+  writeUInt4(out, _worldChecksum);
+  writeUInt4(out, _featureChecksum);
+  writeUInt4(out, _frameCount);
+  writeUInt4(out, _topDistribsCount);
+  writeUInt4(out, indexSize);
+  for (i=0; i<n; i++)
+    if (indexSize == 2)
+    {
+      uint16_t x = (uint16_t)idx[i];
+      out.write((const char*)&x, sizeof(x));
+    }
+    else
+      writeUInt4(out, idx[i]);
+  out.write((const char*)_sumNonTopDistribWeightsVect.getArray(),
+            _frameCount*sizeof(real_t));
+  out.write((const char*)_sumNonTopDistribLKVect.getArray(),
+            _frameCount*sizeof(real_t));
+  if (!out)
+    throw IOException("Cannot write file", __FILE__, __LINE__, f);
+}
+//-------------------------------------------------------------------------
+bool T::load(const FileName& f, unsigned long worldChecksum,
+             unsigned long featureChecksum)
+{
+  ifstream in(f.c_str(), ios::in|ios::binary);
+  if (!in)
+    return false;
+  char magic[sizeof(FILE_MAGIC)];
+  in.read(magic, sizeof(magic));
+  if (!in || memcmp(magic, FILE_MAGIC, sizeof(magic)) != 0)
+    throw IOException("Not a top distributions file", __FILE__, __LINE__,
+                      f);
+  if (readUInt4(in) != worldChecksum || readUInt4(in) != featureChecksum)
+    return false;
+  const unsigned long frameCount = readUInt4(in);
+  const unsigned long topDistribsCount = readUInt4(in);
+  const unsigned long indexSize = readUInt4(in);
+  if (!in || (indexSize != 2 && indexSize != 4))
+    throw IOException("Cannot read file", __FILE__, __LINE__, f);
+  const unsigned long n = frameCount*topDistribsCount;
+  ULongVector indexVect(n, n);
+  unsigned long* idx = indexVect.getArray();
+  for (unsigned long i=0; i<n; i++)
+    if (indexSize == 2)
+    {
+      uint16_t x = 0;
+      in.read((char*)&x, sizeof(x));
+      idx[i] = x;
+    }
+    else
+      idx[i] = readUInt4(in);
+  DoubleVector weightsVect(frameCount, frameCount);
+  DoubleVector lkVect(frameCount, frameCount);
+  in.read((char*)weightsVect.getArray(), frameCount*sizeof(real_t));
+  in.read((char*)lkVect.getArray(), frameCount*sizeof(real_t));
+  if (!in)
+    throw IOException("Cannot read file", __FILE__, __LINE__, f);
+  _worldChecksum = worldChecksum;
+  _featureChecksum = featureChecksum;
+  _frameCount = frameCount;
+  _topDistribsCount = topDistribsCount;
+  _indexVect = indexVect;
+  _sumNonTopDistribWeightsVect = weightsVect;
+  _sumNonTopDistribLKVect = lkVect;
+  return true;
+}
+//-------------------------------------------------------------------------
+String T::getClassName() const { return "TopDistribsCache"; }
+//-------------------------------------------------------------------------
+String T::toString() const
+{
+  return Object::toString()
+    + "\n  frameCount       = " + String::valueOf(_frameCount)
+    + "\n  topDistribsCount = " + String::valueOf(_topDistribsCount)
+    + "\n  worldChecksum    = " + String::valueOf(_worldChecksum)
+    + "\n  featureChecksum  = " + String::valueOf(_featureChecksum);
+}
+//-------------------------------------------------------------------------
+T::~TopDistribsCache() {}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_TopDistribsCache_cpp)
@@ -0,0 +1,322 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+#if !defined(ALIZE_TrialScorer_cpp)
+#define ALIZE_TrialScorer_cpp
+
+#if defined(_WIN32)
+#include <sys/timeb.h>
+#else
+#include <sys/time.h>
+#endif
+
+#include <new>
+#include "TrialScorer.h"
+#include "Mixture.h"
+#include "MixtureGD.h"
+#include "MixtureServer.h"
+#include "StatServer.h"
+#include "FeatureServer.h"
+#include "ThreadPool.h"
+#include "XList.h"
+#include "Config.h"
+#include "Exception.h"
+#include "alizeString.h"
+
+using namespace alize;
+typedef TrialScorer T;
+
+namespace alize
+{
+// One job per test file. Each thread has its own stat server.
+class TrialScorerTask : public ThreadTask
+{
+public :
+  TrialScorerTask(TrialScorer& s, unsigned long threadCount)
+    :_s(s), _firstVect(s.getTestCount()+1, s.getTestCount()+1),
+     _orderVect(s.getTrialCount(), s.getTrialCount())
+  {
+    unsigned long i;
+    for (i=0; i<threadCount; i++)
+    {
+      StatServer* p = new (std::nothrow) StatServer(s._config);
+      Object::assertMemoryIsAllocated(p, __FILE__, __LINE__);
+      _ssVect.addObject(*p);
+      RefVector<Mixture>* pm = new (std::nothrow) RefVector<Mixture>;
+      Object::assertMemoryIsAllocated(pm, __FILE__, __LINE__);
+      _modelVectVect.addObject(*pm);
+      DoubleVector* pl = new (std::nothrow) DoubleVector;
+      Object::assertMemoryIsAllocated(pl, __FILE__, __LINE__);
+      _llkVectVect.addObject(*pl);
+    }
+    // trials sorted by test file (counting sort)
+    const unsigned long testCount = s.getTestCount();
+    const unsigned long trialCount = s.getTrialCount();
+    _firstVect.setAllValues(0);
+    for (i=0; i<trialCount; i++)
+      _firstVect[s._trialTestVect[i]+1]++;
+    for (i=0; i<testCount; i++)
+      _firstVect[i+1] += _firstVect[i];
+    ULongVector posVect(_firstVect);
+    for (i=0; i<trialCount; i++)
+      _orderVect[posVect[s._trialTestVect[i]]++] = i;
+  }
+  ~TrialScorerTask()
+  {
+    _llkVectVect.deleteAllObjects();
+    _modelVectVect.deleteAllObjects();
+    _ssVect.deleteAllObjects();
+  }
+  void runJob(unsigned long test, unsigned long thread)
+  {
+    const unsigned long first = _firstVect[test];
+    const unsigned long last = _firstVect[test+1];
+    if (first == last)
+      return;
+    RefVector<Mixture>& modelVect = _modelVectVect.getObject(thread);
+    modelVect.clear();
+    unsigned long i;
+    for (i=first; i<last; i++)
+      modelVect.addObject(_s._trialModelVect.getObject(_orderVect[i]));
+    FeatureServer fs(_s._config, _s.getTestName(test));
+    const unsigned long count = fs.getFeatureCount();
+    StatServer& ss = _ssVect.getObject(thread);
+    DoubleVector& llkVect = _llkVectVect.getObject(thread);
+    const lk_t worldLLK = ss.computeMultiModelLLK(_s._world, modelVect, fs,
+                                                  0, count, llkVect);
+    for (i=first; i<last; i++)
+      _s._scoreVect[_orderVect[i]] = (count == 0 ? 0.0 :
+                          (llkVect[i-first]-worldLLK)/count);
+    _s._testFrameCountVect[test] = count;
+    Object::incrementCounter(_s._processedTestCount);
+    Object::addToCounter(_s._processedTrialCount, last-first);
+    Object::addToCounter(_s._processedFrameCount, count);
+    if (_s._pListener != NULL)
+      _s._pListener->testScored(_s, test);
+  }
+private :
+  TrialScorer&                    _s;
+  ULongVector                     _firstVect; // first trial of each test
+  ULongVector                     _orderVect; // trials sorted by test
+  RefVector<StatServer>           _ssVect;
+  RefVector<RefVector<Mixture> >  _modelVectVect; // models of a test
+  RefVector<DoubleVector>         _llkVectVect;
+};
+} // end namespace alize
+
+//-------------------------------------------------------------------------
+TrialScorerListener::~TrialScorerListener() {}
+//-------------------------------------------------------------------------
+T::TrialScorer(const Config& c, MixtureServer& ms, const Mixture& world,
+               ThreadPool& pool)
+:Object(), _config(c), _ms(ms), _world(world), _pool(pool),
+ _pListener(NULL), _processedTestCount(0), _processedTrialCount(0),
+ _processedFrameCount(0), _startTime(0.0), _endTime(0.0), _running(false)
+{}
+//-------------------------------------------------------------------------
+unsigned long T::addTrial(const String& test, const String& model)
+{
+  // the trials of a test file are usually consecutive
+  const unsigned long testCount = _testNameLine.getElementCount();
+  long t;
+  if (testCount != 0
+      && _testNameLine.getElement(testCount-1, false) == test)
+    t = testCount-1;
+  else
+  {
+    t = _testNameLine.getIndex(test);
+    if (t == -1)
+    {
+      t = testCount;
+      _testNameLine.addElement(test);
+      _testFrameCountVect.addValue(0);
+    }
+  }
+  const long idx = _ms.getMixtureIndex(model);
+  Mixture& m = (idx == -1 ? _ms.loadMixture(model)
+                          : _ms.getMixture(idx));
+  _trialTestVect.addValue(t);
+  _trialModelVect.addObject(m);
+  _scoreVect.addValue(0.0);
+  return _trialTestVect.size()-1;
+}
+//-------------------------------------------------------------------------
+void T::addTrials(const XList& l)
+{
+  for (unsigned long i=0; i<l.getLineCount(); i++)
+  {
+    const XLine& line = l.getLine(i);
+    if (line.getElementCount() == 0)
+      continue;
+    const String& test = line.getElement(0, false);
+    for (unsigned long j=1; j<line.getElementCount(); j++)
+      addTrial(test, line.getElement(j, false));
+  }
+}
+//-------------------------------------------------------------------------
+unsigned long T::getTrialCount() const { return _trialTestVect.size(); }
+//-------------------------------------------------------------------------
+unsigned long T::getTestCount() const
+{ return _testNameLine.getElementCount(); }
+//-------------------------------------------------------------------------
+const String& T::getTestName(unsigned long test) const
+{
+  assertIsInBounds(__FILE__, __LINE__, test, getTestCount());
+  return _testNameLine.getElement(test, false);
+}
+//-------------------------------------------------------------------------
+unsigned long T::getTrialTest(unsigned long trial) const
+{
+  assertIsInBounds(__FILE__, __LINE__, trial, getTrialCount());
+  return _trialTestVect[trial];
+}
+//-------------------------------------------------------------------------
+const Mixture& T::getTrialModel(unsigned long trial) const
+{ return _trialModelVect.getObject(trial); }
+//-------------------------------------------------------------------------
+void T::setListener(TrialScorerListener* p) { _pListener = p; }
+//-------------------------------------------------------------------------
+void T::run()
+{
+  _ms.prepareMixtures(); // read-only for the threads
+  _world.prepare();
+  if (_world.getType() == DistribType_GD) // top distributions of the world
+    static_cast<const MixtureGD&>(_world).prepareTopDistribs(_config);
+  _processedTestCount = 0;
+  _processedTrialCount = 0;
+  _processedFrameCount = 0;
+  _startTime = getTime();
+  _running = true;
+  try
+  {
+    TrialScorerTask task(*this, _pool.getThreadCount());
+    _pool.run(task, getTestCount());
+  }
+  catch (...) // std::bad_alloc too
+  {
+    _endTime = getTime();
+    _running = false;
+    throw;
+  }
+  _endTime = getTime();
+  _running = false;
+}
+//-------------------------------------------------------------------------
+real_t T::getScore(unsigned long trial) const
+{
+  assertIsInBounds(__FILE__, __LINE__, trial, getTrialCount());
+  return _scoreVect[trial];
+}
+//-------------------------------------------------------------------------
+unsigned long T::getTestFrameCount(unsigned long test) const
+{
+  assertIsInBounds(__FILE__, __LINE__, test, getTestCount());
+  return _testFrameCountVect[test];
+}
+//-------------------------------------------------------------------------
+unsigned long T::getProcessedTestCount() const
+{ return _processedTestCount; }
+//-------------------------------------------------------------------------
+unsigned long T::getProcessedTrialCount() const
+{ return _processedTrialCount; }
+//-------------------------------------------------------------------------
+unsigned long T::getProcessedFrameCount() const
+{ return _processedFrameCount; }
+//-------------------------------------------------------------------------
+real_t T::getElapsedTime() const
+{ return (_running ? getTime() : _endTime)-_startTime; }
+//-------------------------------------------------------------------------
+real_t T::getTrialThroughput() const
+{
+  const real_t t = getElapsedTime();
+  return (t > 0.0 ? _processedTrialCount/t : 0.0);
+}
+//-------------------------------------------------------------------------
+real_t T::getFrameThroughput() const
+{
+  const real_t t = getElapsedTime();
+  return (t > 0.0 ? _processedFrameCount/t : 0.0);
+}
+//-------------------------------------------------------------------------
+double T::getTime() // private
+{
+#if defined(_WIN32)
+  struct _timeb t;
+  _ftime(&t);
+  return t.time+t.millitm/1000.0;
+#else
+  struct timeval t;
+  gettimeofday(&t, NULL);
+  return t.tv_sec+t.tv_usec/1000000.0;
+#endif
+}
+//-------------------------------------------------------------------------
+String T::getClassName() const { return "TrialScorer"; }
+//-------------------------------------------------------------------------
+String T::toString() const
+{
+  return Object::toString()
+    + "\n  trialCount     = " + String::valueOf(getTrialCount())
+    + "\n  testCount      = " + String::valueOf(getTestCount())
+    + "\n  processedTests = " + String::valueOf(_processedTestCount)
+    + "\n  elapsedTime    = " + String::valueOf(getElapsedTime())
+    + "\n  trials/s       = " + String::valueOf(getTrialThroughput())
+    + "\n  frames/s       = " + String::valueOf(getFrameThroughput());
+}
+//-------------------------------------------------------------------------
+T::~TrialScorer() {}
+//-------------------------------------------------------------------------
+
+#endif // !defined(ALIZE_TrialScorer_cpp)
@@ -0,0 +1,155 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+// Measures the per-frame cost of the top distribution selection done by
+// StatServer with DETERMINE_TOP_DISTRIBS : qsort of the likelihoods of all
+// the components with a function pointer comparison (former code),
+// LKVector::descendingSort() and LKVector::descendingPartialSort() of the
+// n best ones. Their agreement is checked by TestLKVector.
+//
+// usage : BenchTopDistribs [topDistribsCount [nbFrames]]
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include "LKVector.h"
+#include "Exception.h"
+
+using namespace alize;
+
+static const unsigned long SIZES[] = {512, 1024, 2048, 4096};
+static const unsigned long NB_SIZES = sizeof(SIZES)/sizeof(SIZES[0]);
+
+enum Method {QSORT, SORT, PARTIAL_SORT};
+
+static unsigned long seed = 12345;
+//-------------------------------------------------------------------------
+static unsigned long randomBits() // 15 bits
+{
+  seed = seed*1103515245 + 12345;
+  return (seed/65536)%32768;
+}
+//-------------------------------------------------------------------------
+static real_t randomValue() // 30 bits : no ties between the likelihoods
+{ return (randomBits()*32768 + randomBits()) / 1073741824.0; }
+//-------------------------------------------------------------------------
+static int compare(const void* s1, const void* s2) // former comparison
+{
+  if (((LKVector::type*)s1)->lk > ((LKVector::type*)s2)->lk)
+    return -1;
+  if (((LKVector::type*)s1)->lk < ((LKVector::type*)s2)->lk)
+    return 1;
+  return 0;
+}
+//-------------------------------------------------------------------------
+// per-frame time in microseconds
+//-------------------------------------------------------------------------
+static double run(const LKVector::type* values, LKVector& v,
+                  unsigned long nbFrames, unsigned long topCount,
+                  Method method)
+{
+  const unsigned long size = v.size();
+  const clock_t start = clock();
+  for (unsigned long f=0; f<nbFrames; f++)
+  {
+    // likelihoods of the frame, as written by StatServer
+    LKVector::type* a = v.getArray();
+    const LKVector::type* p = values + f*size;
+    for (unsigned long i=0; i<size; i++)
+      a[i] = p[i];
+    if (method == QSORT)
+      qsort(a, size, sizeof(LKVector::type), compare);
+    else if (method == SORT)
+      v.descendingSort();
+    else
+      v.descendingPartialSort(topCount);
+  }
+  return (double)(clock()-start) / CLOCKS_PER_SEC * 1e6 / nbFrames;
+}
+//-------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  try
+  {
+    const unsigned long topCount = (argc > 1 ? atol(argv[1]) : 10);
+    const unsigned long nbFrames = (argc > 2 ? atol(argv[2]) : 500);
+    printf("top %lu, %lu frames, time per frame\n", topCount, nbFrames);
+    printf("components       qsort        sort   partial sort\n");
+    for (unsigned long s=0; s<NB_SIZES; s++)
+    {
+      const unsigned long size = SIZES[s];
+      const unsigned long n = (topCount < size ? topCount : size);
+      LKVector::type* values = new LKVector::type[nbFrames*size];
+      for (unsigned long i=0; i<nbFrames*size; i++)
+      {
+        values[i].idx = i%size;
+        values[i].lk = randomValue();
+      }
+      LKVector ref(size, size), full(size, size), partial(size, size);
+      const double qsortTime = run(values, ref, nbFrames, n, QSORT);
+      const double fullTime = run(values, full, nbFrames, n, SORT);
+      const double partialTime = run(values, partial, nbFrames, n,
+                                     PARTIAL_SORT);
+      printf("%10lu %8.1f us %8.1f us %11.1f us\n", size, qsortTime,
+             fullTime, partialTime);
+      delete[] values;
+    }
+    return 0;
+  }
+  catch (Exception& e)
+  {
+    printf("%s\n", e.toString().c_str());
+    return 1;
+  }
+}
@@ -0,0 +1,232 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+// Checks that the batched scoring of StatServer and MixtureStat gives
+// exactly the results of the per-frame scoring : log-likelihoods, with
+// and without top distributions, top distributions and occupations, in
+// the linear and in the log domain.
+// Returns 0 if all the checks pass.
+
+#include <cstdio>
+#include "alize.h"
+
+using namespace alize;
+
+static const unsigned long VECT_SIZE = 13;
+static const unsigned long DISTRIB_COUNT = 64;
+static const unsigned long FRAME_COUNT = 150; // not a multiple of a group
+
+static unsigned long seed = 12345;
+//-------------------------------------------------------------------------
+static real_t randomValue(real_t min, real_t max)
+{
+  seed = seed*1103515245 + 12345;
+  return min + (max-min)*((seed/65536)%32768)/32767.0;
+}
+//-------------------------------------------------------------------------
+static void initMixture(MixtureGD& m)
+{
+  weight_t sum = 0.0;
+  for (unsigned long c=0; c<DISTRIB_COUNT; c++)
+  {
+    DistribGD& d = m.getDistrib(c);
+    for (unsigned long i=0; i<VECT_SIZE; i++)
+    {
+      d.setMean(randomValue(-2.0, 2.0), i);
+      d.setCov(randomValue(0.3, 1.3), i);
+    }
+    m.weight(c) = randomValue(0.1, 1.0);
+    sum += m.weight(c);
+  }
+  for (unsigned long c=0; c<DISTRIB_COUNT; c++)
+    m.weight(c) /= sum;
+  m.computeAll();
+}
+//-------------------------------------------------------------------------
+static bool check(const char* step, unsigned long t, lk_t v, lk_t ref)
+{
+  if (v == ref)
+    return true;
+  printf("FAILED %s %lu : %.17g instead of %.17g\n", step, t, v, ref);
+  return false;
+}
+//-------------------------------------------------------------------------
+// Returns the number of failed checks
+//-------------------------------------------------------------------------
+static unsigned long checkBatch(const Config& c, MixtureServer& ms,
+                                MixtureGD& world, MixtureGD& target,
+                                const FrameBlock& b, unsigned long& nbChecked)
+{
+  unsigned long nbFailed = 0, t, i;
+  Feature f(VECT_SIZE);
+  lk_t llk[FRAME_COUNT], targetRef[FRAME_COUNT];
+
+  // no top distributions
+  StatServer ss(c, ms);
+  ss.computeLLKBatch(world, b, llk);
+  for (t=0; t<FRAME_COUNT; t++)
+  {
+    b.getFeature(t, f);
+    nbChecked++;
+    if (!check("computeLLKBatch frame", t, llk[t], ss.computeLLK(world, f)))
+      nbFailed++;
+  }
+
+  // top distributions determined on the world and used on the target
+  StatServer ssFrame(c, ms);
+  MixtureStat& worldFrame = ssFrame.createAndStoreMixtureStat(world);
+  MixtureStat& targetFrame = ssFrame.createAndStoreMixtureStat(target);
+  StatServer ssBatch(c, ms);
+  MixtureStat& worldBatch = ssBatch.createAndStoreMixtureStat(world);
+  MixtureStat& targetBatch = ssBatch.createAndStoreMixtureStat(target);
+  worldBatch.computeAndAccumulateLLKBatch(b, llk, 1.0,
+                                          DETERMINE_TOP_DISTRIBS);
+  for (t=0; t<FRAME_COUNT; t++)
+  {
+    b.getFeature(t, f);
+    nbChecked += 2;
+    if (!check("DETERMINE_TOP_DISTRIBS frame", t, llk[t],
+        worldFrame.computeAndAccumulateLLK(f, 1.0, DETERMINE_TOP_DISTRIBS)))
+      nbFailed++;
+    const LKVector& top = ssFrame.getTopDistribIndexVector();
+    const LKVector& topBatch = ssBatch.getTopDistribIndexVector(t);
+    for (i=0; i<top.size(); i++)
+      if (top[i].idx != topBatch[i].idx || top[i].lk != topBatch[i].lk)
+        break;
+    if (top.size() != topBatch.size() || i != top.size())
+    {
+      printf("FAILED top distributions frame %lu : rank %lu differs\n",
+             t, i);
+      nbFailed++;
+    }
+    targetRef[t] = targetFrame.computeAndAccumulateLLK(f, 1.0,
+                                                       USE_TOP_DISTRIBS);
+  }
+  // the top distributions of each frame are kept by the server
+  targetBatch.computeAndAccumulateLLKBatch(b, llk, 1.0, USE_TOP_DISTRIBS);
+  for (t=0; t<FRAME_COUNT; t++)
+  {
+    nbChecked++;
+    if (!check("USE_TOP_DISTRIBS frame", t, llk[t], targetRef[t]))
+      nbFailed++;
+  }
+  nbChecked += 2;
+  if (!check("accumulated world, frames", FRAME_COUNT,
+      worldBatch.getAccumulatedLLK(), worldFrame.getAccumulatedLLK()))
+    nbFailed++;
+  if (!check("accumulated target, frames", FRAME_COUNT,
+      targetBatch.getAccumulatedLLK(), targetFrame.getAccumulatedLLK()))
+    nbFailed++;
+
+  // occupations
+  worldFrame.resetOcc();
+  worldBatch.resetOcc();
+  worldBatch.computeAndAccumulateOccBatch(b);
+  for (t=0; t<FRAME_COUNT; t++)
+  {
+    b.getFeature(t, f);
+    worldFrame.computeAndAccumulateOcc(f);
+  }
+  const DoubleVector& occ = worldBatch.getAccumulatedOccVect();
+  const DoubleVector& occRef = worldFrame.getAccumulatedOccVect();
+  for (i=0; i<DISTRIB_COUNT; i++)
+  {
+    nbChecked++;
+    if (!check("occupation of distrib", i, occ[i], occRef[i]))
+      nbFailed++;
+  }
+  return nbFailed;
+}
+//-------------------------------------------------------------------------
+int main()
+{
+  try
+  {
+    Config c;
+    c.setParam("vectSize", String::valueOf(VECT_SIZE));
+    c.setParam("minLLK", "-200");
+    c.setParam("maxLLK", "200");
+    c.setParam("topDistribsCount", "10");
+    c.setParam("computeLLKWithTopDistribs", "COMPLETE");
+    MixtureServer ms(c);
+    MixtureGD& world = ms.createMixtureGD(DISTRIB_COUNT);
+    MixtureGD& target = ms.createMixtureGD(DISTRIB_COUNT);
+    initMixture(world);
+    initMixture(target);
+
+    FrameBlock b(VECT_SIZE);
+    Feature f(VECT_SIZE);
+    for (unsigned long t=0; t<FRAME_COUNT; t++)
+    {
+      for (unsigned long i=0; i<VECT_SIZE; i++)
+        f[i] = randomValue(-3.0, 3.0);
+      b.addFeature(f);
+    }
+
+    unsigned long nbFailed = 0, nbChecked = 0;
+    for (int logDomain=0; logDomain<2; logDomain++)
+    {
+      c.setParam("computeLLKInLogDomain", logDomain ? "true" : "false");
+      nbFailed += checkBatch(c, ms, world, target, b, nbChecked);
+    }
+    printf("%lu/%lu checks passed\n", nbChecked-nbFailed, nbChecked);
+    return (nbFailed == 0 ? 0 : 1);
+  }
+  catch (Exception& e)
+  {
+    printf("%s\n", e.toString().c_str());
+    return 1;
+  }
+}
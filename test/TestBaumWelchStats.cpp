@@ -0,0 +1,287 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+// Checks the Baum-Welch statistics : the statistics of a stream are the
+// occupations, weighted frames and squared frames of the EM accumulation,
+// a saved file has the announced size and is loaded back unchanged, with
+// and without the second order, and the files written by the threads of
+// computeAndSaveStats() are the statistics computed by the caller.
+// load() must refuse a file which is not a statistics file.
+// Returns 0 if all the checks pass.
+
+#include <cstdio>
+#include <cmath>
+#include "alize.h"
+
+using namespace alize;
+
+static const unsigned long VECT_SIZE = 6;
+static const unsigned long DISTRIB_COUNT = 16;
+static const unsigned long FILE_COUNT = 5;
+static const real_t TOLERANCE = 1e-6; // float32 statistics
+
+static unsigned long seed = 12345;
+//-------------------------------------------------------------------------
+static real_t randomValue(real_t min, real_t max)
+{
+  seed = seed*1103515245 + 12345;
+  return min + (max-min)*((seed/65536)%32768)/32767.0;
+}
+//-------------------------------------------------------------------------
+static String getFileName(unsigned long k)
+{ return "TestBaumWelchStats" + String::valueOf(k); }
+//-------------------------------------------------------------------------
+static void writeFeatureFile(unsigned long k, unsigned long frameCount)
+{
+  FILE* f = fopen((getFileName(k)+".raw").c_str(), "wb");
+  if (f == NULL)
+    throw Exception("Cannot create the feature file", __FILE__, __LINE__);
+  for (unsigned long t=0; t<frameCount*VECT_SIZE; t++)
+  {
+    const float v = (float)randomValue(-3.0, 3.0);
+    fwrite(&v, sizeof(v), 1, f);
+  }
+  fclose(f);
+}
+//-------------------------------------------------------------------------
+static long getFileSize(const String& f)
+{
+  FILE* p = fopen(f.c_str(), "rb");
+  if (p == NULL)
+    return -1;
+  fseek(p, 0, SEEK_END);
+  const long size = ftell(p);
+  fclose(p);
+  return size;
+}
+//-------------------------------------------------------------------------
+static bool check(const String& step, bool ok)
+{
+  if (!ok)
+    printf("FAILED %s\n", step.c_str());
+  return ok;
+}
+//-------------------------------------------------------------------------
+// exact if tolerance is 0
+//-------------------------------------------------------------------------
+static bool check(const String& step, const FloatVector& v,
+                  const DoubleVector& ref, real_t tolerance)
+{
+  if (v.size() != ref.size())
+    return check(step + " : size", false);
+  for (unsigned long i=0; i<ref.size(); i++)
+    if (!(fabs(v[i]-ref[i]) <= tolerance*fabs(ref[i])))
+    {
+      printf("FAILED %s %lu : %.9g instead of %.9g\n", step.c_str(), i,
+             v[i], ref[i]);
+      return false;
+    }
+  return true;
+}
+//-------------------------------------------------------------------------
+static bool check(const String& step, const FloatVector& v,
+                  const FloatVector& ref)
+{
+  DoubleVector d(ref.size(), ref.size());
+  for (unsigned long i=0; i<ref.size(); i++)
+    d[i] = ref[i];
+  return check(step, v, d, 0.0);
+}
+//-------------------------------------------------------------------------
+static bool checkEqual(const String& step, const BaumWelchStats& s,
+                       const BaumWelchStats& ref)
+{
+  return check(step + " : header", s.getDistribCount()
+               == ref.getDistribCount() && s.getVectSize()
+               == ref.getVectSize() && s.hasSecondOrder()
+               == ref.hasSecondOrder() && s.getFrameCount()
+               == ref.getFrameCount() && s.getWorldChecksum()
+               == ref.getWorldChecksum())
+      && check(step + " : N", s.getZeroOrderVect(), ref.getZeroOrderVect())
+      && check(step + " : F", s.getFirstOrderVect(),
+               ref.getFirstOrderVect())
+      && check(step + " : S", s.getSecondOrderVect(),
+               ref.getSecondOrderVect());
+}
+//-------------------------------------------------------------------------
+int main()
+{
+  try
+  {
+    XLine l;
+    unsigned long k, t, i, c0;
+    for (k=0; k<FILE_COUNT; k++)
+    {
+      writeFeatureFile(k, 300+70*k);
+      l.addElement(getFileName(k));
+    }
+    Config c;
+    c.setParam("vectSize", String::valueOf(VECT_SIZE));
+    c.setParam("minLLK", "-200");
+    c.setParam("maxLLK", "200");
+    c.setParam("emTopDistribsCount", "5");
+    c.setParam("loadFeatureFileFormat", "RAW");
+    c.setParam("loadFeatureFileVectSize", String::valueOf(VECT_SIZE));
+    c.setParam("loadFeatureFileExtension", ".raw");
+    c.setParam("featureFilesPath", "./");
+    c.setParam("bigEndian", "false");
+    c.setParam("sampleRate", "100");
+    MixtureServer ms(c);
+    MixtureGD& world = ms.createMixtureGD(DISTRIB_COUNT);
+    for (c0=0; c0<DISTRIB_COUNT; c0++)
+    {
+      DistribGD& d = world.getDistrib(c0);
+      for (i=0; i<VECT_SIZE; i++)
+      {
+        d.setMean(randomValue(-2.0, 2.0), i);
+        d.setCov(randomValue(0.3, 1.3), i);
+      }
+    }
+    world.equalizeWeights();
+    world.computeAll();
+    ThreadPool pool(3);
+    BaumWelchStatExtractor extractor(c, world, pool);
+    extractor.setSecondOrder(true);
+    unsigned long nbFailed = 0, nbChecked = 0;
+
+    // the statistics of the EM accumulation
+    FeatureServer fs(c, getFileName(0));
+    BaumWelchStats s;
+    extractor.computeStats(fs, s);
+    StatServer ss(c, ms);
+    MixtureGDStat& stat = ss.createAndStoreMixtureStat(world);
+    stat.resetEM();
+    Feature f;
+    fs.seekFeature(0);
+    for (t=0; fs.readFeature(f); t++)
+      stat.computeAndAccumulateEM(f);
+    nbChecked += 5;
+    if (!check("frame count", s.getFrameCount() == t))
+      nbFailed++;
+    if (!check("world checksum",
+               s.getWorldChecksum() == world.computeChecksum()))
+      nbFailed++;
+    if (!check("N", s.getZeroOrderVect(), stat.getAccumulatedOccVect(),
+               TOLERANCE))
+      nbFailed++;
+    if (!check("F", s.getFirstOrderVect(), stat.getAccumulatedMeanVect(),
+               TOLERANCE))
+      nbFailed++;
+    if (!check("S", s.getSecondOrderVect(), stat.getAccumulatedCovVect(),
+               TOLERANCE))
+      nbFailed++;
+
+    // round-trip, with and without the second order
+    for (int secondOrder=1; secondOrder>=0; secondOrder--)
+    {
+      const String step = secondOrder ? "second order" : "no second order";
+      extractor.setSecondOrder(secondOrder != 0);
+      BaumWelchStats saved, loaded;
+      extractor.computeStats(fs, saved);
+      saved.save("TestBaumWelchStats.bws");
+      loaded.load("TestBaumWelchStats.bws");
+      nbChecked += 3;
+      if (!check(step + " : file size", getFileSize("TestBaumWelchStats.bws")
+          == (long)BaumWelchStats::getFileSize(DISTRIB_COUNT, VECT_SIZE,
+                                               secondOrder != 0)))
+        nbFailed++;
+      if (!check(step + " : S", loaded.getSecondOrderVect().size()
+                 == (secondOrder ? DISTRIB_COUNT*VECT_SIZE : 0)))
+        nbFailed++;
+      if (!checkEqual(step + " : loaded", loaded, saved))
+        nbFailed++;
+    }
+
+    // one job per file
+    extractor.setSecondOrder(true);
+    FeatureFileList list(l, c);
+    extractor.computeAndSaveStats(list, "./", ".bws");
+    for (k=0; k<FILE_COUNT; k++)
+    {
+      FeatureServer fsk(c, getFileName(k));
+      BaumWelchStats ref, loaded;
+      extractor.computeStats(fsk, ref);
+      loaded.load(getFileName(k)+".bws");
+      nbChecked++;
+      if (!checkEqual(getFileName(k)+".bws", loaded, ref))
+        nbFailed++;
+    }
+
+    // not a statistics file
+    nbChecked++;
+    try
+    {
+      BaumWelchStats bad;
+      bad.load(getFileName(0)+".raw");
+      check("load of a feature file", false);
+      nbFailed++;
+    }
+    catch (Exception&) {}
+
+    for (k=0; k<FILE_COUNT; k++)
+    {
+      remove((getFileName(k)+".raw").c_str());
+      remove((getFileName(k)+".bws").c_str());
+    }
+    remove("TestBaumWelchStats.bws");
+    printf("%lu/%lu checks passed\n", nbChecked-nbFailed, nbChecked);
+    return (nbFailed == 0 ? 0 : 1);
+  }
+  catch (Exception& e)
+  {
+    printf("%s\n", e.toString().c_str());
+    return 1;
+  }
+}
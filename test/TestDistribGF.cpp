@@ -0,0 +1,191 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+// Checks the likelihood of the full covariance distributions, computed with
+// the Cholesky factor of the inverse covariance matrix, against the dense
+// quadratic form, with each instruction set supported by the processor.
+// The inverse covariance matrix is then modified (the factor must be
+// recomputed) and made not positive definite (the dense form is used).
+// Returns 0 if all the checks pass.
+
+#include <cstdio>
+#include <cmath>
+#include "DistribGF.h"
+#include "DistribKernel.h"
+#include "Feature.h"
+#include "Exception.h"
+
+namespace alize
+{
+  // friend of DistribGF
+  class TestDistribGF
+  {
+  public :
+    static bool isCholDefined(const DistribGF& d)
+    { return d._cholDefined; }
+  };
+}
+
+using namespace alize;
+typedef DistribKernel DK;
+
+static const unsigned long DIMS[] = {1, 7, 13, 39, 60};
+static const unsigned long NB_DIMS = sizeof(DIMS)/sizeof(DIMS[0]);
+static const real_t TOLERANCE = 1e-10;
+
+static unsigned long seed = 12345;
+//-------------------------------------------------------------------------
+static real_t randomValue(real_t min, real_t max)
+{
+  seed = seed*1103515245 + 12345;
+  return min + (max-min)*((seed/65536)%32768)/32767.0;
+}
+//-------------------------------------------------------------------------
+// cst*exp(-0.5*(x-mean)'*covInv*(x-mean)) with the full matrix
+//-------------------------------------------------------------------------
+static real_t computeDenseLK(const DistribGF& d, const Feature& f)
+{
+  const unsigned long n = d.getVectSize();
+  real_t tmp = 0.0;
+  for (unsigned long i=0; i<n; i++)
+    for (unsigned long j=0; j<n; j++)
+      tmp += (f[i]-d.getMean(i)) * d.getCovInv(j, i) * (f[j]-d.getMean(j));
+  return d.getCst() * exp(-0.5*tmp);
+}
+//-------------------------------------------------------------------------
+static bool check(const char* step, const DistribGF& d, const Feature& f,
+                  bool cholDefined)
+{
+  const unsigned long n = d.getVectSize();
+  bool ok = true;
+  const real_t ref = computeDenseLK(d, f);
+  for (int is=DK::InstructionSet_SCALAR; is<=DK::InstructionSet_AVX512; is++)
+  {
+    const DK::InstructionSet s = (DK::InstructionSet)is;
+    if (!DK::isSupported(s))
+      continue;
+    DK::setInstructionSet(s);
+    const real_t lk = d.computeLK(f);
+    const real_t e = fabs(lk - ref)/ref;
+    if (!(e <= TOLERANCE))
+    {
+      printf("FAILED %s %s n=%lu : %.17g instead of %.17g (%g)\n", step,
+             DK::getInstructionSetName(s).c_str(), n, lk, ref, e);
+      ok = false;
+    }
+  }
+  // the factor has been updated by computeLK()
+  if (TestDistribGF::isCholDefined(d) != cholDefined)
+  {
+    printf("FAILED %s n=%lu : Cholesky factor %s\n", step, n,
+           cholDefined ? "not defined" : "defined");
+    ok = false;
+  }
+  return ok;
+}
+//-------------------------------------------------------------------------
+int main()
+{
+  try
+  {
+    unsigned long nbFailed = 0, nbChecked = 0;
+    for (unsigned long k=0; k<NB_DIMS; k++)
+    {
+      const unsigned long n = DIMS[k];
+      unsigned long i, j, l;
+      DistribGF d(n);
+      Feature f(n);
+      for (i=0; i<n; i++)
+      {
+        d.setMean(randomValue(-1.0, 1.0), i);
+        f[i] = d.getMean(i) + randomValue(-0.5, 0.5);
+      }
+      // cov = a*a'/n + identity : symmetric positive definite
+      DoubleSquareMatrix a(n);
+      for (i=0; i<n; i++)
+        for (j=0; j<n; j++)
+          a(j, i) = randomValue(-1.0, 1.0);
+      for (i=0; i<n; i++)
+        for (j=0; j<n; j++)
+        {
+          real_t v = (i == j ? 1.0 : 0.0);
+          for (l=0; l<n; l++)
+            v += a(l, i) * a(l, j) / n;
+          d.setCov(v, j, i);
+        }
+      d.computeAll();
+      nbChecked += 3;
+      if (!check("computeAll", d, f, true))
+        nbFailed++;
+      // larger diagonal : still positive definite, factor recomputed
+      for (i=0; i<n; i++)
+        d.getCovInvMatrix()(i, i) += 0.5;
+      d.markModified();
+      if (!check("modified", d, f, true))
+        nbFailed++;
+      // negative diagonal value : not positive definite
+      d.getCovInvMatrix()(0, 0) = -0.5;
+      d.markModified();
+      if (!check("not positive definite", d, f, false))
+        nbFailed++;
+    }
+    printf("%lu/%lu checks passed\n", nbChecked-nbFailed, nbChecked);
+    return (nbFailed == 0 ? 0 : 1);
+  }
+  catch (Exception& e)
+  {
+    printf("%s\n", e.toString().c_str());
+    return 1;
+  }
+}
@@ -0,0 +1,176 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+// Checks that every instruction set supported by the processor gives the
+// results of the portable kernels, on odd dimensions which exercise the
+// tails of the vectorized loops and on unaligned arrays.
+// Returns 0 if all the checks pass.
+
+#include <cstdio>
+#include <cmath>
+#include "DistribKernel.h"
+#include "Exception.h"
+
+using namespace alize;
+typedef DistribKernel DK;
+
+static const unsigned long DIMS[] = {1, 7, 13, 39, 60};
+static const unsigned long NB_DIMS = sizeof(DIMS)/sizeof(DIMS[0]);
+static const unsigned long MAX_DIM = 60;
+static const real_t TOLERANCE = 1e-12;
+
+static unsigned long seed = 12345;
+//-------------------------------------------------------------------------
+static real_t randomValue(real_t min, real_t max)
+{
+  seed = seed*1103515245 + 12345;
+  return min + (max-min)*((seed/65536)%32768)/32767.0;
+}
+//-------------------------------------------------------------------------
+static real_t relativeError(real_t x, real_t ref)
+{
+  const real_t d = fabs(x - ref);
+  return (ref == 0.0 ? d : d/fabs(ref));
+}
+//-------------------------------------------------------------------------
+static bool check(const char* kernel, DK::InstructionSet s, unsigned long n,
+                  unsigned long offset, real_t x, real_t ref)
+{
+  const real_t e = relativeError(x, ref);
+  if (e <= TOLERANCE && x == x)
+    return true;
+  printf("FAILED %s %s n=%lu offset=%lu : %.17g instead of %.17g (%g)\n",
+         kernel, DK::getInstructionSetName(s).c_str(), n, offset, x, ref, e);
+  return false;
+}
+//-------------------------------------------------------------------------
+int main()
+{
+  try
+  {
+    // one more value to test unaligned arrays
+    real_t* f = DK::allocArray(MAX_DIM+1);
+    real_t* m = DK::allocArray(MAX_DIM+1);
+    real_t* c = DK::allocArray(MAX_DIM+1);
+    real_t* a = DK::allocArray(MAX_DIM+1);
+    real_t* v = DK::allocArray(MAX_DIM+1);
+    real_t* e = DK::allocArray(MAX_DIM+1);
+    float ff[MAX_DIM+1];
+    unsigned long i, nbFailed = 0, nbChecked = 0;
+    for (i=0; i<MAX_DIM+1; i++)
+    {
+      ff[i] = (float)randomValue(-5.0, 5.0);
+      f[i] = ff[i];
+      m[i] = randomValue(-5.0, 5.0);
+      c[i] = randomValue(0.01, 10.0);
+      a[i] = randomValue(-2.0, 2.0);
+    }
+    for (unsigned long d=0; d<NB_DIMS; d++)
+      for (unsigned long o=0; o<2; o++)
+      {
+        const unsigned long n = DIMS[d];
+        DK::setInstructionSet(DK::InstructionSet_SCALAR);
+        const real_t dist = DK::computeWeightedDist(f+o, m+o, c+o, n);
+        const real_t distFloat = DK::computeWeightedDist(ff+o, m+o, c+o, n);
+        const real_t dot = DK::computeDotDiff(a+o, f+o, m+o, n);
+        real_t ref[MAX_DIM];
+        for (i=0; i<n; i++)
+          ref[i] = exp(v[i+o] = randomValue(-700.0, 700.0));
+        for (int is=DK::InstructionSet_SCALAR;
+             is<=DK::InstructionSet_AVX512; is++)
+        {
+          const DK::InstructionSet s = (DK::InstructionSet)is;
+          if (!DK::isSupported(s))
+            continue;
+          DK::setInstructionSet(s);
+          bool ok = check("weightedDist", s, n, o,
+                      DK::computeWeightedDist(f+o, m+o, c+o, n), dist);
+          ok &= check("weightedDistFloat", s, n, o,
+                      DK::computeWeightedDist(ff+o, m+o, c+o, n), distFloat);
+          // the float data converted in the registers : same result as
+          // the double precision kernel
+          ok &= check("weightedDistFloat/double", s, n, o,
+                      DK::computeWeightedDist(ff+o, m+o, c+o, n),
+                      DK::computeWeightedDist(f+o, m+o, c+o, n));
+          ok &= check("dotDiff", s, n, o,
+                      DK::computeDotDiff(a+o, f+o, m+o, n), dot);
+          for (i=0; i<n; i++)
+            e[i+o] = v[i+o];
+          DK::computeExp(e+o, n);
+          for (i=0; i<n; i++)
+            ok &= check("exp", s, n, o, e[i+o], ref[i]);
+          nbChecked++;
+          if (!ok)
+            nbFailed++;
+        }
+      }
+    DK::freeArray(f);
+    DK::freeArray(m);
+    DK::freeArray(c);
+    DK::freeArray(a);
+    DK::freeArray(v);
+    DK::freeArray(e);
+    for (int is=DK::InstructionSet_SCALAR; is<=DK::InstructionSet_AVX512; is++)
+      printf("%-8s %s\n",
+             DK::getInstructionSetName((DK::InstructionSet)is).c_str(),
+             DK::isSupported((DK::InstructionSet)is) ? "tested" : "not supported");
+    printf("%lu/%lu checks passed\n", nbChecked-nbFailed, nbChecked);
+    return (nbFailed == 0 ? 0 : 1);
+  }
+  catch (Exception& e)
+  {
+    printf("%s\n", e.toString().c_str());
+    return 1;
+  }
+}
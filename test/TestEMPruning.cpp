@@ -0,0 +1,241 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+// Checks the pruning of the occupations in the EM of GD mixtures
+// (params emOccThreshold and emTopDistribsCount) : the accumulated
+// occupations, weighted frames and squared frames are those of a direct
+// implementation (the best distribution of a frame is always kept and
+// the kept occupations are normalized to 1). Without the params, nothing
+// is pruned.
+// Returns 0 if all the checks pass.
+
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "alize.h"
+
+using namespace alize;
+
+static const unsigned long VECT_SIZE = 5;
+static const unsigned long DISTRIB_COUNT = 32;
+static const unsigned long FRAME_COUNT = 500;
+static const real_t TOLERANCE = 1e-12;
+
+struct Pruning
+{
+  const char*   threshold;
+  const char*   topCount;
+};
+static const Pruning PRUNINGS[] =
+{
+  {NULL, NULL}, // no pruning
+  {"0", "0"},   // no pruning either
+  {"0.01", "0"},
+  {"0", "3"},
+  {"0.05", "2"},
+  {"0.999", "0"} // only the best distribution
+};
+static const unsigned long NB_PRUNINGS = sizeof(PRUNINGS)/sizeof(PRUNINGS[0]);
+
+static unsigned long seed = 12345;
+//-------------------------------------------------------------------------
+static real_t randomValue(real_t min, real_t max)
+{
+  seed = seed*1103515245 + 12345;
+  return min + (max-min)*((seed/65536)%32768)/32767.0;
+}
+//-------------------------------------------------------------------------
+static void initMixture(MixtureGD& m)
+{
+  for (unsigned long c=0; c<DISTRIB_COUNT; c++)
+  {
+    DistribGD& d = m.getDistrib(c);
+    for (unsigned long i=0; i<VECT_SIZE; i++)
+    {
+      d.setMean(randomValue(-2.0, 2.0), i);
+      d.setCov(randomValue(0.3, 1.3), i);
+    }
+  }
+  m.equalizeWeights();
+  m.computeAll();
+}
+//-------------------------------------------------------------------------
+static bool greaterOcc(const std::pair<real_t, unsigned long>& a,
+                       const std::pair<real_t, unsigned long>& b)
+{ return a.first > b.first; }
+//-------------------------------------------------------------------------
+// occ : the occupations of a frame, normalized to 1
+//-------------------------------------------------------------------------
+static void prune(DoubleVector& occ, real_t threshold, unsigned long n)
+{
+  std::vector<std::pair<real_t, unsigned long> > v;
+  unsigned long c;
+  for (c=0; c<DISTRIB_COUNT; c++)
+    v.push_back(std::make_pair(occ[c], c));
+  std::sort(v.begin(), v.end(), greaterOcc);
+  if (n == 0 || n > DISTRIB_COUNT)
+    n = DISTRIB_COUNT;
+  real_t sum = 0.0;
+  for (c=0; c<n; c++)
+    if (c == 0 || v[c].first >= threshold)
+      sum += v[c].first;
+  DoubleVector pruned(DISTRIB_COUNT, DISTRIB_COUNT);
+  pruned.setAllValues(0.0);
+  for (c=0; c<n; c++)
+    if (c == 0 || v[c].first >= threshold)
+      pruned[v[c].second] = v[c].first/sum;
+  occ = pruned;
+}
+//-------------------------------------------------------------------------
+static unsigned long compare(const char* step, unsigned long k,
+                             const DoubleVector& v, const DoubleVector& ref,
+                             unsigned long& nbChecked)
+{
+  unsigned long nbFailed = 0;
+  for (unsigned long i=0; i<ref.size(); i++)
+  {
+    nbChecked++;
+    if (!(fabs(v[i]-ref[i]) <= TOLERANCE*fabs(ref[i])))
+    {
+      printf("FAILED pruning %lu, %s %lu : %.17g instead of %.17g\n", k,
+             step, i, v[i], ref[i]);
+      nbFailed++;
+    }
+  }
+  return nbFailed;
+}
+//-------------------------------------------------------------------------
+int main()
+{
+  try
+  {
+    Config c;
+    c.setParam("vectSize", String::valueOf(VECT_SIZE));
+    c.setParam("minLLK", "-200");
+    c.setParam("maxLLK", "200");
+    MixtureServer ms(c);
+    MixtureGD& m = ms.createMixtureGD(DISTRIB_COUNT);
+    initMixture(m);
+    FrameBlock b(VECT_SIZE);
+    Feature f(VECT_SIZE);
+    unsigned long t, i, c0;
+    for (t=0; t<FRAME_COUNT; t++)
+    {
+      for (i=0; i<VECT_SIZE; i++)
+        f[i] = randomValue(-3.0, 3.0);
+      b.addFeature(f);
+    }
+    // occupations without pruning
+    StatServer ssOcc(c, ms);
+    MixtureStat& occStat = ssOcc.createAndStoreMixtureStat(m);
+
+    unsigned long nbFailed = 0, nbChecked = 0;
+    for (unsigned long k=0; k<NB_PRUNINGS; k++)
+    {
+      const Pruning& p = PRUNINGS[k];
+      Config cp(c);
+      if (p.threshold != NULL)
+      {
+        cp.setParam("emOccThreshold", p.threshold);
+        cp.setParam("emTopDistribsCount", p.topCount);
+      }
+      const real_t threshold = (p.threshold == NULL ? 0.0 :
+                                String(p.threshold).toDouble());
+      const unsigned long n = (p.topCount == NULL ? 0 :
+                               String(p.topCount).toULong());
+      StatServer ss(cp, ms);
+      MixtureGDStat& s = ss.createAndStoreMixtureStat(m);
+      s.resetEM();
+      DoubleVector occRef(DISTRIB_COUNT, DISTRIB_COUNT);
+      DoubleVector meanRef(DISTRIB_COUNT*VECT_SIZE, DISTRIB_COUNT*VECT_SIZE);
+      DoubleVector covRef(DISTRIB_COUNT*VECT_SIZE, DISTRIB_COUNT*VECT_SIZE);
+      occRef.setAllValues(0.0);
+      meanRef.setAllValues(0.0);
+      covRef.setAllValues(0.0);
+      for (t=0; t<FRAME_COUNT; t++)
+      {
+        b.getFeature(t, f);
+        s.computeAndAccumulateEM(f);
+        occStat.computeAndAccumulateOcc(f);
+        DoubleVector occ(occStat.getOccVect());
+        prune(occ, threshold, n);
+        for (c0=0; c0<DISTRIB_COUNT; c0++)
+        {
+          occRef[c0] += occ[c0];
+          for (i=0; i<VECT_SIZE; i++)
+          {
+            const real_t x = occ[c0] * f[i];
+            covRef[c0*VECT_SIZE+i] += x * f[i];
+            meanRef[c0*VECT_SIZE+i] += x;
+          }
+        }
+      }
+      nbFailed += compare("occupation", k, s.getAccumulatedOccVect(),
+                          occRef, nbChecked);
+      nbFailed += compare("sum of the frames", k,
+                          s.getAccumulatedMeanVect(), meanRef, nbChecked);
+      nbFailed += compare("sum of the squared frames", k,
+                          s.getAccumulatedCovVect(), covRef, nbChecked);
+    }
+    printf("%lu/%lu checks passed\n", nbChecked-nbFailed, nbChecked);
+    return (nbFailed == 0 ? 0 : 1);
+  }
+  catch (Exception& e)
+  {
+    printf("%s\n", e.toString().c_str());
+    return 1;
+  }
+}
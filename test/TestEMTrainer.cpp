@@ -0,0 +1,222 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+// Checks MixtureEMTrainer : with one accumulator, an iteration gives
+// exactly the parameters of the EM done frame by frame with a
+// MixtureGDStat ; with a fixed number of accumulators, several iterations
+// give exactly the same parameters with 1, 2, 3 and 4 threads.
+// Returns 0 if all the checks pass.
+
+#include <cstdio>
+#include <cmath>
+#include "alize.h"
+
+using namespace alize;
+
+static const unsigned long VECT_SIZE = 4;
+static const unsigned long DISTRIB_COUNT = 16;
+static const unsigned long FRAME_COUNT = 10000; // several windows
+static const unsigned long ITERATION_COUNT = 3;
+static const unsigned long ACCUMULATOR_COUNT = 4;
+static const unsigned long THREAD_COUNTS[] = {1, 2, 3, 4};
+static const unsigned long NB_THREAD_COUNTS =
+                   sizeof(THREAD_COUNTS)/sizeof(THREAD_COUNTS[0]);
+static const char* FILE_NAME = "TestEMTrainer";
+
+static unsigned long seed = 12345;
+//-------------------------------------------------------------------------
+static real_t randomValue(real_t min, real_t max)
+{
+  seed = seed*1103515245 + 12345;
+  return min + (max-min)*((seed/65536)%32768)/32767.0;
+}
+//-------------------------------------------------------------------------
+static void initMixture(MixtureGD& m)
+{
+  seed = 777; // the same initial mixture each time
+  for (unsigned long c=0; c<DISTRIB_COUNT; c++)
+  {
+    DistribGD& d = m.getDistrib(c);
+    for (unsigned long i=0; i<VECT_SIZE; i++)
+    {
+      d.setMean(randomValue(-2.0, 6.0), i);
+      d.setCov(1.0, i);
+    }
+  }
+  m.equalizeWeights();
+  m.computeAll();
+}
+//-------------------------------------------------------------------------
+// 4 clusters
+//-------------------------------------------------------------------------
+static void writeFeatureFile()
+{
+  FILE* f = fopen((String(FILE_NAME)+".raw").c_str(), "wb");
+  if (f == NULL)
+    throw Exception("Cannot create the feature file", __FILE__, __LINE__);
+  for (unsigned long t=0; t<FRAME_COUNT; t++)
+  {
+    const unsigned long k = t%4;
+    for (unsigned long i=0; i<VECT_SIZE; i++)
+    {
+      const float v = (float)(1.5*k*(i == k) + randomValue(-1.0, 1.0));
+      fwrite(&v, sizeof(v), 1, f);
+    }
+  }
+  fclose(f);
+}
+//-------------------------------------------------------------------------
+static unsigned long compare(const char* step, const MixtureGD& m,
+                             const MixtureGD& ref, unsigned long& nbChecked)
+{
+  unsigned long nbFailed = 0;
+  for (unsigned long c=0; c<DISTRIB_COUNT; c++)
+  {
+    const DistribGD& d = m.getDistrib(c);
+    const DistribGD& dRef = ref.getDistrib(c);
+    bool ok = (m.weight(c) == ref.weight(c));
+    for (unsigned long i=0; i<VECT_SIZE; i++)
+      ok = ok && d.getMean(i) == dRef.getMean(i)
+              && d.getCov(i) == dRef.getCov(i);
+    nbChecked++;
+    if (!ok)
+    {
+      printf("FAILED %s : distrib %lu differs\n", step, c);
+      nbFailed++;
+    }
+  }
+  return nbFailed;
+}
+//-------------------------------------------------------------------------
+int main()
+{
+  try
+  {
+    writeFeatureFile();
+    Config c;
+    c.setParam("vectSize", String::valueOf(VECT_SIZE));
+    c.setParam("minLLK", "-200");
+    c.setParam("maxLLK", "200");
+    c.setParam("loadFeatureFileFormat", "RAW");
+    c.setParam("loadFeatureFileVectSize", String::valueOf(VECT_SIZE));
+    c.setParam("loadFeatureFileExtension", ".raw");
+    c.setParam("featureFilesPath", "./");
+    c.setParam("bigEndian", "false");
+    c.setParam("sampleRate", "100");
+    MixtureServer ms(c);
+    FeatureServer fs(c, FILE_NAME);
+    unsigned long nbFailed = 0, nbChecked = 0;
+
+    // reference : EM frame by frame
+    MixtureGD& ref = ms.createMixtureGD(DISTRIB_COUNT);
+    initMixture(ref);
+    StatServer ss(c, ms);
+    MixtureGDStat& stat = ss.createAndStoreMixtureStat(ref);
+    stat.resetEM();
+    Feature f;
+    fs.seekFeature(0);
+    while (fs.readFeature(f))
+      stat.computeAndAccumulateEM(f);
+    const MixtureGD& em = static_cast<const MixtureGD&>(stat.getEM());
+    for (unsigned long k=0; k<DISTRIB_COUNT; k++)
+    {
+      ref.getDistrib(k) = em.getDistrib(k);
+      ref.weight(k) = em.weight(k);
+    }
+    ref.markModified();
+    {
+      ThreadPool pool(1);
+      MixtureGD& m = ms.createMixtureGD(DISTRIB_COUNT);
+      initMixture(m);
+      MixtureEMTrainer trainer(c, pool);
+      trainer.addFeatureStream(fs);
+      trainer.iterate(m);
+      nbFailed += compare("one accumulator", m, ref, nbChecked);
+    }
+
+    // fixed number of accumulators
+    MixtureGD& m1 = ms.createMixtureGD(DISTRIB_COUNT);
+    lk_t llk1 = 0.0;
+    for (unsigned long k=0; k<NB_THREAD_COUNTS; k++)
+    {
+      ThreadPool pool(THREAD_COUNTS[k]);
+      MixtureGD& m = (k == 0 ? m1 : ms.createMixtureGD(DISTRIB_COUNT));
+      initMixture(m);
+      MixtureEMTrainer trainer(c, pool);
+      trainer.addFeatureStream(fs);
+      trainer.setAccumulatorCount(ACCUMULATOR_COUNT);
+      const lk_t llk = trainer.train(m, ITERATION_COUNT);
+      if (k == 0)
+        llk1 = llk;
+      String step = String::valueOf(pool.getThreadCount()) + " threads";
+      nbFailed += compare(step.c_str(), m, m1, nbChecked);
+      nbChecked++;
+      if (llk != llk1)
+      {
+        printf("FAILED %s : mean LLK %.17g instead of %.17g\n",
+               step.c_str(), llk, llk1);
+        nbFailed++;
+      }
+    }
+    remove((String(FILE_NAME)+".raw").c_str());
+    printf("%lu/%lu checks passed\n", nbChecked-nbFailed, nbChecked);
+    return (nbFailed == 0 ? 0 : 1);
+  }
+  catch (Exception& e)
+  {
+    printf("%s\n", e.toString().c_str());
+    return 1;
+  }
+}
@@ -0,0 +1,224 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+// Checks the features read without copy (FeatureView) : a feature server
+// gives views with the values of readFeature(), buffered or mapped, and
+// the log-likelihoods of GD mixtures (linear and log domain) and of GF
+// mixtures computed on the views, frame by frame or accumulated by a
+// MixtureStat, are exactly those of the features. A stream which copies
+// its features (mask) refuses the views.
+// Returns 0 if all the checks pass.
+
+#include <cstdio>
+#include "alize.h"
+
+using namespace alize;
+
+static const unsigned long VECT_SIZE = 13;
+static const unsigned long DISTRIB_COUNT = 32;
+static const unsigned long FRAME_COUNT = 300;
+static const char* FILE_NAME = "TestFeatureView";
+
+static unsigned long seed = 12345;
+//-------------------------------------------------------------------------
+static real_t randomValue(real_t min, real_t max)
+{
+  seed = seed*1103515245 + 12345;
+  return min + (max-min)*((seed/65536)%32768)/32767.0;
+}
+//-------------------------------------------------------------------------
+static void writeFeatureFile()
+{
+  FILE* f = fopen((String(FILE_NAME)+".raw").c_str(), "wb");
+  if (f == NULL)
+    throw Exception("Cannot create the feature file", __FILE__, __LINE__);
+  for (unsigned long t=0; t<FRAME_COUNT*VECT_SIZE; t++)
+  {
+    const float v = (float)randomValue(-3.0, 3.0);
+    fwrite(&v, sizeof(v), 1, f);
+  }
+  fclose(f);
+}
+//-------------------------------------------------------------------------
+static void initMixture(Mixture& m)
+{
+  for (unsigned long c=0; c<DISTRIB_COUNT; c++)
+  {
+    Distrib& d = m.getDistrib(c);
+    for (unsigned long i=0; i<VECT_SIZE; i++)
+    {
+      d.setMean(randomValue(-2.0, 2.0), i);
+      if (m.getType() == DistribType_GD)
+        static_cast<DistribGD&>(d).setCov(randomValue(0.5, 1.5), i);
+      else // diagonally dominant
+        for (unsigned long j=0; j<VECT_SIZE; j++)
+          static_cast<DistribGF&>(d).setCov(i == j ? randomValue(2.0, 3.0)
+                                   : randomValue(-0.1, 0.1), i, j);
+    }
+  }
+  m.equalizeWeights();
+  m.computeAll();
+}
+//-------------------------------------------------------------------------
+static bool check(const String& step, bool ok)
+{
+  if (!ok)
+    printf("FAILED %s\n", step.c_str());
+  return ok;
+}
+//-------------------------------------------------------------------------
+static Config getConfig(bool mapped, bool logDomain)
+{
+  Config c;
+  c.setParam("vectSize", String::valueOf(VECT_SIZE));
+  c.setParam("minLLK", "-200");
+  c.setParam("maxLLK", "200");
+  c.setParam("loadFeatureFileFormat", "RAW");
+  c.setParam("loadFeatureFileVectSize", String::valueOf(VECT_SIZE));
+  c.setParam("loadFeatureFileExtension", ".raw");
+  c.setParam("featureFilesPath", "./");
+  c.setParam("bigEndian", "false");
+  c.setParam("sampleRate", "100");
+  c.setParam("loadFeatureFileMemoryMap", mapped ? "true" : "false");
+  c.setParam("computeLLKInLogDomain", logDomain ? "true" : "false");
+  return c;
+}
+//-------------------------------------------------------------------------
+int main()
+{
+  try
+  {
+    writeFeatureFile();
+    unsigned long nbFailed = 0, nbChecked = 0;
+    for (int mapped=0; mapped<2; mapped++)
+      for (int logDomain=0; logDomain<2; logDomain++)
+      {
+        const String step = String(mapped ? "mapped" : "buffered")
+                          + (logDomain ? " log" : " linear");
+        Config c = getConfig(mapped != 0, logDomain != 0);
+        seed = 12345; // the same mixtures
+        MixtureServer ms(c);
+        MixtureGD& gd = ms.createMixtureGD(DISTRIB_COUNT);
+        MixtureGF& gf = ms.createMixtureGF(DISTRIB_COUNT);
+        initMixture(gd);
+        initMixture(gf);
+        StatServer ss(c, ms);
+        MixtureStat& gdViewStat = ss.createAndStoreMixtureStat(gd);
+        MixtureStat& gdStat = ss.createAndStoreMixtureStat(gd);
+        MixtureStat& gfViewStat = ss.createAndStoreMixtureStat(gf);
+        MixtureStat& gfStat = ss.createAndStoreMixtureStat(gf);
+        FeatureServer fs(c, FILE_NAME), views(c, FILE_NAME);
+        Feature f;
+        FeatureView v;
+        unsigned long t, i, badValues = 0, badGD = 0, badGF = 0;
+        for (t=0; fs.readFeature(f); t++)
+        {
+          if (!views.readFeature(v) || v.getVectSize() != VECT_SIZE)
+            break;
+          for (i=0; i<VECT_SIZE; i++)
+            if (v[i] != f[i])
+              badValues++;
+          if (ss.computeLLK(gd, v) != ss.computeLLK(gd, f))
+            badGD++;
+          if (ss.computeLLK(gf, v) != ss.computeLLK(gf, f))
+            badGF++;
+          gdViewStat.computeAndAccumulateLLK(v);
+          gdStat.computeAndAccumulateLLK(f);
+          gfViewStat.computeAndAccumulateLLK(v, 0.5);
+          gfStat.computeAndAccumulateLLK(f, 0.5);
+        }
+        nbChecked += 6;
+        if (!check(step + " : frame count", t == FRAME_COUNT
+                   && !views.readFeature(v)))
+          nbFailed++;
+        if (!check(step + " : values", badValues == 0))
+          nbFailed++;
+        if (!check(step + " : GD", badGD == 0))
+          nbFailed++;
+        if (!check(step + " : GF", badGF == 0))
+          nbFailed++;
+        if (!check(step + " : GD accumulated", gdViewStat.getMeanLLK()
+                   == gdStat.getMeanLLK()))
+          nbFailed++;
+        if (!check(step + " : GF accumulated", gfViewStat.getMeanLLK()
+                   == gfStat.getMeanLLK()))
+          nbFailed++;
+      }
+
+    // the modifier copies the features
+    Config c = getConfig(false, false);
+    c.setParam("featureServerMask", "0-5");
+    c.setParam("vectSize", "6");
+    FeatureServer fs(c, FILE_NAME);
+    FeatureView v;
+    nbChecked++;
+    try
+    {
+      fs.readFeature(v);
+      check("mask", false);
+      nbFailed++;
+    }
+    catch (Exception&) {}
+
+    remove((String(FILE_NAME)+".raw").c_str());
+    printf("%lu/%lu checks passed\n", nbChecked-nbFailed, nbChecked);
+    return (nbFailed == 0 ? 0 : 1);
+  }
+  catch (Exception& e)
+  {
+    printf("%s\n", e.toString().c_str());
+    return 1;
+  }
+}
@@ -0,0 +1,148 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+// Checks that LKVector::descendingSort() and
+// LKVector::descendingPartialSort(), used by StatServer to determine the
+// top distributions, give the order of the former qsort with a function
+// pointer comparison. The timing of the three methods is measured by
+// BenchTopDistribs.
+// Returns 0 if all the checks pass.
+
+#include <cstdio>
+#include <cstdlib>
+#include "LKVector.h"
+#include "Exception.h"
+
+using namespace alize;
+
+static const unsigned long SIZES[] = {1, 2, 10, 11, 512, 2048};
+static const unsigned long NB_SIZES = sizeof(SIZES)/sizeof(SIZES[0]);
+static const unsigned long TOPS[] = {1, 10, 64};
+static const unsigned long NB_TOPS = sizeof(TOPS)/sizeof(TOPS[0]);
+
+static unsigned long seed = 12345;
+//-------------------------------------------------------------------------
+static unsigned long randomBits() // 15 bits
+{
+  seed = seed*1103515245 + 12345;
+  return (seed/65536)%32768;
+}
+//-------------------------------------------------------------------------
+static int compare(const void* s1, const void* s2) // former comparison
+{
+  if (((LKVector::type*)s1)->lk > ((LKVector::type*)s2)->lk)
+    return -1;
+  if (((LKVector::type*)s1)->lk < ((LKVector::type*)s2)->lk)
+    return 1;
+  return 0;
+}
+//-------------------------------------------------------------------------
+// the indices are compared only without ties : their order is unspecified
+//-------------------------------------------------------------------------
+static bool check(const char* method, const LKVector& v,
+                  const LKVector& ref, unsigned long n, bool ties)
+{
+  for (unsigned long i=0; i<n; i++)
+    if (v[i].lk != ref[i].lk || (!ties && v[i].idx != ref[i].idx))
+    {
+      printf("FAILED %s size=%lu top=%lu : rank %lu differs\n", method,
+             ref.size(), n, i);
+      return false;
+    }
+  return true;
+}
+//-------------------------------------------------------------------------
+int main()
+{
+  try
+  {
+    unsigned long nbFailed = 0, nbChecked = 0;
+    for (unsigned long s=0; s<NB_SIZES; s++)
+      for (int ties=0; ties<2; ties++)
+      {
+        const unsigned long size = SIZES[s];
+        LKVector ref(size, size), full(size, size);
+        for (unsigned long i=0; i<size; i++)
+        {
+          ref[i].idx = i;
+          // 30 bits : no ties; 4 bits : many ties
+          ref[i].lk = (ties ? randomBits()%16 :
+                       randomBits()*32768 + randomBits()) / 1073741824.0;
+          full[i] = ref[i];
+        }
+        LKVector values(ref);
+        qsort(ref.getArray(), size, sizeof(LKVector::type), compare);
+        full.descendingSort();
+        nbChecked++;
+        if (!check("descendingSort", full, ref, size, ties != 0))
+          nbFailed++;
+        for (unsigned long t=0; t<NB_TOPS; t++)
+        {
+          const unsigned long n = (TOPS[t] < size ? TOPS[t] : size);
+          LKVector partial(values);
+          partial.descendingPartialSort(n);
+          nbChecked++;
+          if (!check("descendingPartialSort", partial, ref, n, ties != 0))
+            nbFailed++;
+        }
+      }
+    printf("%lu/%lu checks passed\n", nbChecked-nbFailed, nbChecked);
+    return (nbFailed == 0 ? 0 : 1);
+  }
+  catch (Exception& e)
+  {
+    printf("%s\n", e.toString().c_str());
+    return 1;
+  }
+}
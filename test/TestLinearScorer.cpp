@@ -0,0 +1,278 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+// Checks LinearScorer : the score is the dot product of the mean offsets
+// of a model with the centered and normalized first order statistics of
+// the segment, whether the model is given as a mixture or by its offsets,
+// the world model scores 0, and for models close to the world model the
+// score is the first order approximation of the log-likelihood ratio
+// computed frame by frame (the second order term is removed by scoring
+// the opposite offsets too). Statistics of another world model, a missing
+// segment and offsets of the wrong size are refused.
+// Returns 0 if all the checks pass.
+
+#include <cstdio>
+#include <cmath>
+#include "alize.h"
+
+using namespace alize;
+
+static const unsigned long VECT_SIZE = 5;
+static const unsigned long DISTRIB_COUNT = 16;
+static const unsigned long FRAME_COUNT = 600;
+static const unsigned long MODEL_COUNT = 6;
+static const real_t OFFSET = 0.002; // small : first order approximation
+static const char* FILE_NAME = "TestLinearScorer";
+
+static unsigned long seed = 12345;
+//-------------------------------------------------------------------------
+static real_t randomValue(real_t min, real_t max)
+{
+  seed = seed*1103515245 + 12345;
+  return min + (max-min)*((seed/65536)%32768)/32767.0;
+}
+//-------------------------------------------------------------------------
+static void writeFeatureFile()
+{
+  FILE* f = fopen((String(FILE_NAME)+".raw").c_str(), "wb");
+  if (f == NULL)
+    throw Exception("Cannot create the feature file", __FILE__, __LINE__);
+  for (unsigned long t=0; t<FRAME_COUNT*VECT_SIZE; t++)
+  {
+    const float v = (float)randomValue(-3.0, 3.0);
+    fwrite(&v, sizeof(v), 1, f);
+  }
+  fclose(f);
+}
+//-------------------------------------------------------------------------
+// score computed from the statistics, without the normalized vector
+//-------------------------------------------------------------------------
+static real_t computeReferenceScore(const MixtureGD& world,
+                  const MixtureGD& m, const BaumWelchStats& s)
+{
+  const FloatVector& n = s.getZeroOrderVect();
+  const FloatVector& f = s.getFirstOrderVect();
+  real_t score = 0.0;
+  for (unsigned long c=0; c<DISTRIB_COUNT; c++)
+  {
+    const DistribGD& w = world.getDistrib(c);
+    for (unsigned long i=0; i<VECT_SIZE; i++)
+      score += (m.getDistrib(c).getMean(i)-w.getMean(i))*w.getCovInv(i)
+             *(f[c*VECT_SIZE+i]-n[c]*w.getMean(i));
+  }
+  return score/s.getFrameCount();
+}
+//-------------------------------------------------------------------------
+static bool check(const String& step, bool ok)
+{
+  if (!ok)
+    printf("FAILED %s\n", step.c_str());
+  return ok;
+}
+//-------------------------------------------------------------------------
+static bool check(const String& step, real_t v, real_t ref,
+                  real_t tolerance)
+{
+  if (fabs(v-ref) <= tolerance)
+    return true;
+  printf("FAILED %s : %.12g instead of %.12g\n", step.c_str(), v, ref);
+  return false;
+}
+//-------------------------------------------------------------------------
+int main()
+{
+  try
+  {
+    writeFeatureFile();
+    Config c;
+    c.setParam("vectSize", String::valueOf(VECT_SIZE));
+    c.setParam("minLLK", "-200");
+    c.setParam("maxLLK", "200");
+    c.setParam("loadFeatureFileFormat", "RAW");
+    c.setParam("loadFeatureFileVectSize", String::valueOf(VECT_SIZE));
+    c.setParam("loadFeatureFileExtension", ".raw");
+    c.setParam("featureFilesPath", "./");
+    c.setParam("bigEndian", "false");
+    c.setParam("sampleRate", "100");
+    MixtureServer ms(c);
+    MixtureGD& world = ms.createMixtureGD(DISTRIB_COUNT);
+    unsigned long c0, i, k;
+    for (c0=0; c0<DISTRIB_COUNT; c0++)
+    {
+      DistribGD& d = world.getDistrib(c0);
+      for (i=0; i<VECT_SIZE; i++)
+      {
+        d.setMean(randomValue(-2.0, 2.0), i);
+        d.setCov(randomValue(0.5, 1.5), i);
+      }
+    }
+    world.equalizeWeights();
+    world.computeAll();
+    // models : world means moved a little, covariances and weights
+    // shared, and the models with the opposite offsets
+    RefVector<MixtureGD> models, opposites;
+    for (k=0; k<MODEL_COUNT; k++)
+    {
+      MixtureGD& m = ms.duplicateMixture(world);
+      MixtureGD& o = ms.duplicateMixture(world);
+      for (c0=0; c0<DISTRIB_COUNT; c0++)
+        for (i=0; i<VECT_SIZE; i++)
+        {
+          const real_t mean = world.getDistrib(c0).getMean(i);
+          const real_t offset = randomValue(-OFFSET, OFFSET);
+          m.getDistrib(c0).setMean(mean+offset, i);
+          o.getDistrib(c0).setMean(mean-offset, i);
+        }
+      m.computeAll();
+      o.computeAll();
+      models.addObject(m);
+      opposites.addObject(o);
+    }
+    ThreadPool pool(1);
+    BaumWelchStatExtractor extractor(c, world, pool);
+    FeatureServer fs(c, FILE_NAME);
+    BaumWelchStats s;
+    extractor.computeStats(fs, s);
+    LinearScorer scorer(world);
+    unsigned long nbFailed = 0, nbChecked = 0;
+
+    nbChecked++;
+    try
+    {
+      scorer.computeScore(world);
+      check("score without statistics", false);
+      nbFailed++;
+    }
+    catch (Exception&) {}
+    scorer.setTestStats(s);
+
+    nbChecked++;
+    if (!check("world", scorer.computeScore(world), 0.0, 0.0))
+      nbFailed++;
+
+    StatServer ss(c, ms);
+    for (k=0; k<MODEL_COUNT; k++)
+    {
+      const MixtureGD& m = models.getObject(k);
+      const MixtureGD& o = opposites.getObject(k);
+      const String step = "model " + String::valueOf(k);
+      const real_t score = scorer.computeScore(m);
+      DoubleVector v;
+      scorer.computeOffsetVect(m, v);
+      nbChecked += 4;
+      if (!check(step + " : offsets", scorer.computeScore(v), score, 0.0))
+        nbFailed++;
+      if (!check(step + " : statistics", score,
+                 computeReferenceScore(world, m, s), 1e-9*fabs(score)))
+        nbFailed++;
+      if (!check(step + " : opposite offsets", scorer.computeScore(o),
+                 -score, 1e-12*fabs(score)))
+        nbFailed++;
+      // half the difference of the log-likelihood ratios : the error is
+      // O(OFFSET^3)
+      ss.resetLLK(m);
+      ss.resetLLK(o);
+      Feature f;
+      fs.seekFeature(0);
+      while (fs.readFeature(f))
+      {
+        ss.computeAndAccumulateLLK(m, f);
+        ss.computeAndAccumulateLLK(o, f);
+      }
+      const real_t llr = 0.5*(ss.getMeanLLK(m)-ss.getMeanLLK(o));
+      if (!check(step + " : log-likelihood ratio", score, llr,
+                 0.01*fabs(llr)))
+        nbFailed++;
+    }
+
+    // refused arguments
+    MixtureGD& other = ms.duplicateMixture(world);
+    other.getDistrib(0).setMean(world.getDistrib(0).getMean(0)+1.0, 0);
+    other.computeAll();
+    LinearScorer otherScorer(other);
+    DoubleVector shortVect(DISTRIB_COUNT, DISTRIB_COUNT);
+    nbChecked += 3;
+    try
+    {
+      otherScorer.setTestStats(s);
+      check("statistics of another world model", false);
+      nbFailed++;
+    }
+    catch (Exception&) {}
+    try
+    {
+      scorer.computeScore(shortVect);
+      check("offset vector size", false);
+      nbFailed++;
+    }
+    catch (Exception&) {}
+    try
+    {
+      LinearScorer gfScorer(ms.createMixtureGF(DISTRIB_COUNT));
+      check("world model GF", false);
+      nbFailed++;
+    }
+    catch (Exception&) {}
+
+    remove((String(FILE_NAME)+".raw").c_str());
+    printf("%lu/%lu checks passed\n", nbChecked-nbFailed, nbChecked);
+    return (nbFailed == 0 ? 0 : 1);
+  }
+  catch (Exception& e)
+  {
+    printf("%s\n", e.toString().c_str());
+    return 1;
+  }
+}
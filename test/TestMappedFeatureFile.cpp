@@ -0,0 +1,297 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+// Checks the memory mapped feature files (loadFeatureFileMemoryMap) :
+// RAW, SPro4 (unaligned frames after the text header) and HTK files of
+// both byte orders are read, in sequence, with a step and after seeks,
+// exactly like the buffered files, with the default and a small buffer.
+// Writing a feature leaves the mapping and the file is then read like a
+// writable buffered file. A HTK file shorter than its header announces is
+// read like a buffered file.
+// Returns 0 if all the checks pass.
+
+#include <cstdio>
+#include <cstring>
+#include "alize.h"
+
+using namespace alize;
+
+static const unsigned long VECT_SIZE = 5;
+static const unsigned long FRAME_COUNT = 37;
+
+static unsigned long seed = 12345;
+//-------------------------------------------------------------------------
+static real_t randomValue(real_t min, real_t max)
+{
+  seed = seed*1103515245 + 12345;
+  return min + (max-min)*((seed/65536)%32768)/32767.0;
+}
+//-------------------------------------------------------------------------
+static void writeBytes(FILE* f, const void* p, unsigned long n,
+                       bool bigEndian)
+{
+  const unsigned short one = 1;
+  const bool swap = (*(const unsigned char*)&one == 1) == bigEndian;
+  for (unsigned long i=0; i<n; i++)
+    fputc(((const unsigned char*)p)[swap ? n-1-i : i], f);
+}
+//-------------------------------------------------------------------------
+// announcedCount is only used by HTK
+//-------------------------------------------------------------------------
+static void writeFeatureFile(const String& name, const String& format,
+              bool bigEndian, const FloatVector& data,
+              unsigned long announcedCount)
+{
+  FILE* f = fopen(name.c_str(), "wb");
+  if (f == NULL)
+    throw Exception("Cannot create " + name, __FILE__, __LINE__);
+  if (format == "SPRO4")
+  {
+    const char* header = "<header>\nsource = TestMappedFeatureFile;\n"
+                         "</header>\n";
+    fwrite(header, 1, strlen(header), f);
+    const short vectSize = VECT_SIZE;
+    const unsigned int flags = 0;
+    const float sampleRate = 100.0;
+    writeBytes(f, &vectSize, 2, bigEndian);
+    writeBytes(f, &flags, 4, bigEndian);
+    writeBytes(f, &sampleRate, 4, bigEndian);
+  }
+  else if (format == "HTK")
+  {
+    const int count = announcedCount, period = 100000;
+    const short sampleSize = VECT_SIZE*4, kind = 6; // MFCC
+    writeBytes(f, &count, 4, bigEndian);
+    writeBytes(f, &period, 4, bigEndian);
+    writeBytes(f, &sampleSize, 2, bigEndian);
+    writeBytes(f, &kind, 2, bigEndian);
+  }
+  for (unsigned long i=0; i<data.size(); i++)
+  {
+    const float v = data[i];
+    writeBytes(f, &v, 4, bigEndian);
+  }
+  fclose(f);
+}
+//-------------------------------------------------------------------------
+static void setParams(Config& c, const String& format, bool bigEndian,
+                      unsigned long memAlloc, bool mapped, bool writable)
+{
+  c.setParam("vectSize", String::valueOf(VECT_SIZE));
+  c.setParam("loadFeatureFileFormat", format);
+  c.setParam("loadFeatureFileVectSize", String::valueOf(VECT_SIZE));
+  c.setParam("loadFeatureFileExtension", "");
+  c.setParam("loadFeatureFileBigEndian", bigEndian ? "true" : "false");
+  c.setParam("featureFilesPath", "./");
+  c.setParam("featureFlags", "100000");
+  c.setParam("sampleRate", "100");
+  if (memAlloc != 0)
+    c.setParam("loadFeatureFileMemAlloc", String::valueOf(memAlloc));
+  c.setParam("loadFeatureFileMemoryMap", mapped ? "true" : "false");
+  if (writable)
+    c.setParam("featureServerMode", "FEATURE_WRITABLE");
+}
+//-------------------------------------------------------------------------
+// the frames read in sequence, with a step of 3 and after seeks
+//-------------------------------------------------------------------------
+static void readAll(FeatureInputStream& r, DoubleVector& v)
+{
+  static const unsigned long SEEKS[] = {3, FRAME_COUNT-1, 0, 20, 19, 36};
+  Feature f;
+  unsigned long i;
+  v.clear();
+  v.addValue(r.getFeatureCount());
+  v.addValue(r.getVectSize());
+  try
+  {
+    r.seekFeature(0);
+    while (r.readFeature(f))
+      for (i=0; i<f.getVectSize(); i++)
+        v.addValue(f[i]);
+    r.seekFeature(1);
+    while (r.readFeature(f, 3))
+      for (i=0; i<f.getVectSize(); i++)
+        v.addValue(f[i]);
+    for (unsigned long k=0; k<sizeof(SEEKS)/sizeof(SEEKS[0]); k++)
+    {
+      r.seekFeature(SEEKS[k]);
+      v.addValue(r.readFeature(f) ? 1.0 : 0.0);
+      for (i=0; i<f.getVectSize(); i++)
+        v.addValue(f[i]);
+    }
+  }
+  catch (Exception&)
+  {
+    v.addValue(-1.0); // same failure expected
+  }
+}
+//-------------------------------------------------------------------------
+static bool check(const String& step, bool ok)
+{
+  if (!ok)
+    printf("FAILED %s\n", step.c_str());
+  return ok;
+}
+//-------------------------------------------------------------------------
+static bool check(const String& step, const DoubleVector& v,
+                  const DoubleVector& ref)
+{
+  if (v.size() != ref.size())
+  {
+    printf("FAILED %s : %lu values instead of %lu\n", step.c_str(),
+           v.size(), ref.size());
+    return false;
+  }
+  for (unsigned long i=0; i<ref.size(); i++)
+    if (v[i] != ref[i])
+    {
+      printf("FAILED %s : value %lu\n", step.c_str(), i);
+      return false;
+    }
+  return true;
+}
+//-------------------------------------------------------------------------
+int main()
+{
+  try
+  {
+    static const char* FORMATS[] = {"RAW", "SPRO4", "HTK"};
+    static const unsigned long MEM_ALLOCS[] = {0, 40, 84};
+    FloatVector data;
+    for (unsigned long i=0; i<FRAME_COUNT*VECT_SIZE; i++)
+      data.addValue((float)randomValue(-10.0, 10.0));
+    unsigned long nbFailed = 0, nbChecked = 0;
+
+    for (unsigned long k=0; k<3; k++)
+      for (int bigEndian=0; bigEndian<2; bigEndian++)
+      {
+        const String format = FORMATS[k];
+        const String file = "TestMappedFeatureFile."
+                            + String(bigEndian ? "be." : "le.") + format;
+        writeFeatureFile(file, format, bigEndian != 0, data, FRAME_COUNT);
+        DoubleVector ref, v;
+        {
+          Config c;
+          setParams(c, format, bigEndian != 0, 0, false, false);
+          FeatureFileReader r(file, c);
+          readAll(r, ref);
+        }
+        nbChecked++;
+        if (!check(file + " : buffered", ref.size() > FRAME_COUNT*VECT_SIZE
+                   && ref[0] == FRAME_COUNT && ref[2] == data[0]))
+          nbFailed++;
+        for (unsigned long m=0; m<3; m++)
+        {
+          const String step = file + " memAlloc "
+                              + String::valueOf(MEM_ALLOCS[m]);
+          Config c;
+          setParams(c, format, bigEndian != 0, MEM_ALLOCS[m], true, false);
+          FeatureFileReader r(file, c);
+          readAll(r, v);
+          nbChecked++;
+          if (!check(step + " : mapped", v, ref))
+            nbFailed++;
+        }
+
+        // writing leaves the mapping
+        DoubleVector written[2];
+        for (int mapped=0; mapped<2; mapped++)
+        {
+          Config c;
+          setParams(c, format, bigEndian != 0, 100000, mapped != 0, true);
+          FeatureFileReader r(file, c);
+          Feature f(VECT_SIZE);
+          r.seekFeature(7);
+          r.readFeature(f);
+          for (unsigned long i=0; i<VECT_SIZE; i++)
+            f[i] = -100.0-i;
+          r.seekFeature(4);
+          r.writeFeature(f);
+          readAll(r, written[mapped]);
+        }
+        nbChecked += 2;
+        if (!check(file + " : buffered write",
+                   written[0][2+4*VECT_SIZE] == -100.0))
+          nbFailed++;
+        if (!check(file + " : written", written[1], written[0]))
+          nbFailed++;
+        remove(file.c_str());
+      }
+
+    // HTK file shorter than announced
+    writeFeatureFile("TestMappedFeatureFile.short.HTK", "HTK", true, data,
+                     FRAME_COUNT+5);
+    DoubleVector shortRead[2];
+    for (int mapped=0; mapped<2; mapped++)
+    {
+      Config c;
+      setParams(c, "HTK", true, 0, mapped != 0, false);
+      FeatureFileReader r("TestMappedFeatureFile.short.HTK", c);
+      readAll(r, shortRead[mapped]);
+    }
+    nbChecked++;
+    if (!check("short HTK file", shortRead[1], shortRead[0]))
+      nbFailed++;
+    remove("TestMappedFeatureFile.short.HTK");
+
+    printf("%lu/%lu checks passed\n", nbChecked-nbFailed, nbChecked);
+    return (nbFailed == 0 ? 0 : 1);
+  }
+  catch (Exception& e)
+  {
+    printf("%s\n", e.toString().c_str());
+    return 1;
+  }
+}
@@ -0,0 +1,213 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+// Checks that StatServer::computeMultiModelLLK() gives exactly the
+// log-likelihoods of one pass with DETERMINE_TOP_DISTRIBS on the world
+// followed by USE_TOP_DISTRIBS on each model, for GD and GF models, with
+// COMPLETE and PARTIAL top distributions.
+// Returns 0 if all the checks pass.
+
+#include <cstdio>
+#include "alize.h"
+
+using namespace alize;
+
+static const unsigned long VECT_SIZE = 7;
+static const unsigned long DISTRIB_COUNT = 32;
+static const unsigned long FRAME_COUNT = 300;
+static const unsigned long BEGIN = 40; // the segment
+static const unsigned long COUNT = 200;
+static const char* FILE_NAME = "TestMultiModelLLK";
+
+static unsigned long seed = 12345;
+//-------------------------------------------------------------------------
+static real_t randomValue(real_t min, real_t max)
+{
+  seed = seed*1103515245 + 12345;
+  return min + (max-min)*((seed/65536)%32768)/32767.0;
+}
+//-------------------------------------------------------------------------
+static void initMixture(Mixture& m)
+{
+  weight_t sum = 0.0;
+  for (unsigned long c=0; c<DISTRIB_COUNT; c++)
+  {
+    Distrib& d = m.getDistrib(c);
+    for (unsigned long i=0; i<VECT_SIZE; i++)
+    {
+      d.setMean(randomValue(-2.0, 2.0), i);
+      if (m.getType() == DistribType_GD)
+        static_cast<DistribGD&>(d).setCov(randomValue(0.3, 1.3), i);
+      else // diagonally dominant
+      {
+        DistribGF& g = static_cast<DistribGF&>(d);
+        for (unsigned long j=0; j<i; j++)
+        {
+          const real_t v = randomValue(-0.1, 0.1);
+          g.setCov(v, i, j);
+          g.setCov(v, j, i);
+        }
+        g.setCov(randomValue(0.8, 1.3), i, i);
+      }
+    }
+    m.weight(c) = randomValue(0.1, 1.0);
+    sum += m.weight(c);
+  }
+  for (unsigned long c=0; c<DISTRIB_COUNT; c++)
+    m.weight(c) /= sum;
+  m.computeAll();
+}
+//-------------------------------------------------------------------------
+static void writeFeatureFile()
+{
+  FILE* f = fopen((String(FILE_NAME)+".raw").c_str(), "wb");
+  if (f == NULL)
+    throw Exception("Cannot create the feature file", __FILE__, __LINE__);
+  for (unsigned long t=0; t<FRAME_COUNT*VECT_SIZE; t++)
+  {
+    const float v = (float)randomValue(-3.0, 3.0);
+    fwrite(&v, sizeof(v), 1, f);
+  }
+  fclose(f);
+}
+//-------------------------------------------------------------------------
+static bool check(const char* step, const String& id, lk_t v, lk_t ref)
+{
+  if (v == ref)
+    return true;
+  printf("FAILED %s %s : %.17g instead of %.17g\n", step, id.c_str(), v,
+         ref);
+  return false;
+}
+//-------------------------------------------------------------------------
+int main()
+{
+  try
+  {
+    writeFeatureFile();
+    Config c;
+    c.setParam("vectSize", String::valueOf(VECT_SIZE));
+    c.setParam("minLLK", "-200");
+    c.setParam("maxLLK", "200");
+    c.setParam("topDistribsCount", "5");
+    c.setParam("loadFeatureFileFormat", "RAW");
+    c.setParam("loadFeatureFileVectSize", String::valueOf(VECT_SIZE));
+    c.setParam("loadFeatureFileExtension", ".raw");
+    c.setParam("featureFilesPath", "./");
+    c.setParam("bigEndian", "false");
+    c.setParam("sampleRate", "100");
+    MixtureServer ms(c);
+    Mixture& world = ms.createMixtureGD(DISTRIB_COUNT);
+    initMixture(world);
+    RefVector<Mixture> modelVect;
+    for (unsigned long j=0; j<4; j++)
+    {
+      Mixture& m = (j%2 == 0 ? (Mixture&)ms.createMixtureGD(DISTRIB_COUNT)
+                             : (Mixture&)ms.createMixtureGF(DISTRIB_COUNT));
+      m.setId("model" + String::valueOf(j));
+      initMixture(m);
+      modelVect.addObject(m);
+    }
+    FeatureServer fs(c, FILE_NAME);
+
+    unsigned long nbFailed = 0, nbChecked = 0;
+    for (int complete=0; complete<2; complete++)
+    {
+      c.setParam("computeLLKWithTopDistribs",
+                 complete ? "COMPLETE" : "PARTIAL");
+      const char* step = complete ? "COMPLETE" : "PARTIAL";
+      DoubleVector llkVect;
+      StatServer ss(c, ms);
+      const lk_t worldLLK = ss.computeMultiModelLLK(world, modelVect, fs,
+                                                    BEGIN, COUNT, llkVect);
+      // reference : one frame at a time
+      StatServer ssRef(c, ms);
+      MixtureStat& worldStat = ssRef.createAndStoreMixtureStat(world);
+      RefVector<MixtureStat> statVect;
+      unsigned long j;
+      for (j=0; j<modelVect.size(); j++)
+        statVect.addObject(ssRef.createAndStoreMixtureStat(
+                                             modelVect.getObject(j)));
+      Feature f;
+      fs.seekFeature(BEGIN);
+      for (unsigned long t=0; t<COUNT; t++)
+      {
+        fs.readFeature(f);
+        worldStat.computeAndAccumulateLLK(f, 1.0, DETERMINE_TOP_DISTRIBS);
+        for (j=0; j<statVect.size(); j++)
+          statVect.getObject(j).computeAndAccumulateLLK(f, 1.0,
+                                                        USE_TOP_DISTRIBS);
+      }
+      nbChecked++;
+      if (!check(step, "world", worldLLK, worldStat.getAccumulatedLLK()))
+        nbFailed++;
+      for (j=0; j<modelVect.size(); j++)
+      {
+        nbChecked++;
+        if (!check(step, modelVect.getObject(j).getId(), llkVect[j],
+                   statVect.getObject(j).getAccumulatedLLK()))
+          nbFailed++;
+      }
+    }
+    remove((String(FILE_NAME)+".raw").c_str());
+    printf("%lu/%lu checks passed\n", nbChecked-nbFailed, nbChecked);
+    return (nbFailed == 0 ? 0 : 1);
+  }
+  catch (Exception& e)
+  {
+    printf("%s\n", e.toString().c_str());
+    return 1;
+  }
+}
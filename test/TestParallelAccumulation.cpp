@@ -0,0 +1,217 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+// Checks that MixtureStat::computeAndAccumulateLLKParallel() and
+// computeAndAccumulateOccParallel() give exactly the same results with 1
+// and with several threads, and the results of the per-frame
+// accumulation up to the rounding of the sums by chunks.
+// Returns 0 if all the checks pass.
+
+#include <cstdio>
+#include <cmath>
+#include "alize.h"
+
+using namespace alize;
+
+static const unsigned long VECT_SIZE = 13;
+static const unsigned long DISTRIB_COUNT = 64;
+static const unsigned long FRAME_COUNT = 8500; // several windows
+static const unsigned long BEGIN = 7;
+static const unsigned long COUNT = FRAME_COUNT-20;
+static const double W = 0.5; // weight of the frames
+static const unsigned long THREAD_COUNTS[] = {1, 2, 3, 4};
+static const unsigned long NB_THREAD_COUNTS =
+                   sizeof(THREAD_COUNTS)/sizeof(THREAD_COUNTS[0]);
+static const real_t TOLERANCE = 1e-10;
+static const char* FILE_NAME = "TestParallelAccumulation";
+
+static unsigned long seed = 12345;
+//-------------------------------------------------------------------------
+static real_t randomValue(real_t min, real_t max)
+{
+  seed = seed*1103515245 + 12345;
+  return min + (max-min)*((seed/65536)%32768)/32767.0;
+}
+//-------------------------------------------------------------------------
+static void initMixture(MixtureGD& m)
+{
+  for (unsigned long c=0; c<DISTRIB_COUNT; c++)
+  {
+    DistribGD& d = m.getDistrib(c);
+    for (unsigned long i=0; i<VECT_SIZE; i++)
+    {
+      d.setMean(randomValue(-2.0, 2.0), i);
+      d.setCov(randomValue(0.3, 1.3), i);
+    }
+  }
+  m.equalizeWeights();
+  m.computeAll();
+}
+//-------------------------------------------------------------------------
+static void writeFeatureFile()
+{
+  FILE* f = fopen((String(FILE_NAME)+".raw").c_str(), "wb");
+  if (f == NULL)
+    throw Exception("Cannot create the feature file", __FILE__, __LINE__);
+  for (unsigned long t=0; t<FRAME_COUNT*VECT_SIZE; t++)
+  {
+    const float v = (float)randomValue(-3.0, 3.0);
+    fwrite(&v, sizeof(v), 1, f);
+  }
+  fclose(f);
+}
+//-------------------------------------------------------------------------
+// exact if tolerance is 0
+//-------------------------------------------------------------------------
+static bool check(const char* step, unsigned long threadCount, real_t v,
+                  real_t ref, real_t tolerance)
+{
+  if (v == ref || fabs(v-ref) <= tolerance*fabs(ref))
+    return true;
+  printf("FAILED %s, %lu threads : %.17g instead of %.17g\n", step,
+         threadCount, v, ref);
+  return false;
+}
+//-------------------------------------------------------------------------
+int main()
+{
+  try
+  {
+    writeFeatureFile();
+    Config c;
+    c.setParam("vectSize", String::valueOf(VECT_SIZE));
+    c.setParam("minLLK", "-200");
+    c.setParam("maxLLK", "200");
+    c.setParam("loadFeatureFileFormat", "RAW");
+    c.setParam("loadFeatureFileVectSize", String::valueOf(VECT_SIZE));
+    c.setParam("loadFeatureFileExtension", ".raw");
+    c.setParam("featureFilesPath", "./");
+    c.setParam("bigEndian", "false");
+    c.setParam("sampleRate", "100");
+    MixtureServer ms(c);
+    MixtureGD& m = ms.createMixtureGD(DISTRIB_COUNT);
+    initMixture(m);
+    FeatureServer fs(c, FILE_NAME);
+    unsigned long nbFailed = 0, nbChecked = 0, c0;
+
+    // reference : one frame at a time
+    StatServer ssRef(c, ms);
+    MixtureStat& ref = ssRef.createAndStoreMixtureStat(m);
+    Feature f;
+    fs.seekFeature(BEGIN);
+    for (unsigned long t=0; t<COUNT; t++)
+    {
+      fs.readFeature(f);
+      ref.computeAndAccumulateLLK(f, W);
+      ref.computeAndAccumulateOcc(f, W);
+    }
+
+    lk_t llk1 = 0.0;
+    DoubleVector occ1;
+    for (unsigned long k=0; k<NB_THREAD_COUNTS; k++)
+    {
+      const unsigned long n = THREAD_COUNTS[k];
+      ThreadPool pool(n);
+      StatServer ss(c, ms);
+      MixtureStat& s = ss.createAndStoreMixtureStat(m);
+      const lk_t llk = s.computeAndAccumulateLLKParallel(fs, BEGIN, COUNT,
+                                                          pool, W);
+      s.computeAndAccumulateOccParallel(fs, BEGIN, COUNT, pool, W);
+      const DoubleVector& occ = s.getAccumulatedOccVect();
+      if (k == 0)
+      {
+        llk1 = llk;
+        occ1 = occ;
+      }
+      nbChecked += 5+2*DISTRIB_COUNT;
+      // the same whatever the number of threads
+      if (!check("sum of the LLK", n, llk, llk1, 0.0))
+        nbFailed++;
+      for (c0=0; c0<DISTRIB_COUNT; c0++)
+        if (!check("accumulated occupation", n, occ[c0], occ1[c0], 0.0))
+          nbFailed++;
+      // the per-frame results
+      if (!check("accumulated LLK", n, s.getAccumulatedLLK(),
+                 ref.getAccumulatedLLK(), TOLERANCE))
+        nbFailed++;
+      if (!check("LLK of the last frame", n, s.getLLK(), ref.getLLK(), 0.0))
+        nbFailed++;
+      if (!check("LLK feature count", n, s.getAccumulatedLLKFeatureCount(),
+                 ref.getAccumulatedLLKFeatureCount(), 0.0))
+        nbFailed++;
+      if (!check("occupation feature count", n,
+                 s.getAccumulatedOccFeatureCount(),
+                 ref.getAccumulatedOccFeatureCount(), 0.0))
+        nbFailed++;
+      for (c0=0; c0<DISTRIB_COUNT; c0++)
+      {
+        if (!check("occupation", n, occ[c0],
+                   ref.getAccumulatedOccVect()[c0], TOLERANCE))
+          nbFailed++;
+        if (!check("occupation of the last frame", n, s.getOccVect()[c0],
+                   ref.getOccVect()[c0], 0.0))
+          nbFailed++;
+      }
+    }
+    remove((String(FILE_NAME)+".raw").c_str());
+    printf("%lu/%lu checks passed\n", nbChecked-nbFailed, nbChecked);
+    return (nbFailed == 0 ? 0 : 1);
+  }
+  catch (Exception& e)
+  {
+    printf("%s\n", e.toString().c_str());
+    return 1;
+  }
+}
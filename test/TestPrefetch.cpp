@@ -0,0 +1,245 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+// Checks the loading of the next block of a feature file in the
+// background (loadFeatureFilePrefetch) : with a buffer smaller than the
+// file, the features read in sequence, with a step, after seeks and by
+// blocks are the features read with the whole file in memory, whatever
+// the buffer size. Writing a feature needs the whole file in memory, with
+// or without the prefetch.
+// Returns 0 if all the checks pass.
+
+#include <cstdio>
+#include "alize.h"
+
+using namespace alize;
+
+static const unsigned long VECT_SIZE = 7;
+static const unsigned long FRAME_COUNT = 5003;
+static const char* FILE_NAME = "TestPrefetch";
+
+static unsigned long seed = 12345;
+//-------------------------------------------------------------------------
+static real_t randomValue(real_t min, real_t max)
+{
+  seed = seed*1103515245 + 12345;
+  return min + (max-min)*((seed/65536)%32768)/32767.0;
+}
+//-------------------------------------------------------------------------
+static void writeFeatureFile()
+{
+  FILE* f = fopen((String(FILE_NAME)+".raw").c_str(), "wb");
+  if (f == NULL)
+    throw Exception("Cannot create the feature file", __FILE__, __LINE__);
+  for (unsigned long t=0; t<FRAME_COUNT*VECT_SIZE; t++)
+  {
+    const float v = (float)randomValue(-10.0, 10.0);
+    fwrite(&v, sizeof(v), 1, f);
+  }
+  fclose(f);
+}
+//-------------------------------------------------------------------------
+// memAlloc 0 for the whole file
+//-------------------------------------------------------------------------
+static Config getConfig(unsigned long memAlloc, bool prefetch,
+                        bool writable)
+{
+  Config c;
+  c.setParam("vectSize", String::valueOf(VECT_SIZE));
+  c.setParam("loadFeatureFileFormat", "RAW");
+  c.setParam("loadFeatureFileVectSize", String::valueOf(VECT_SIZE));
+  c.setParam("loadFeatureFileExtension", ".raw");
+  c.setParam("featureFilesPath", "./");
+  c.setParam("bigEndian", "false");
+  c.setParam("sampleRate", "100");
+  c.setParam("loadFeatureFileMemAlloc", String::valueOf(memAlloc != 0 ?
+             memAlloc : FRAME_COUNT*VECT_SIZE*sizeof(float)));
+  c.setParam("loadFeatureFilePrefetch", prefetch ? "true" : "false");
+  if (writable)
+    c.setParam("featureServerMode", "FEATURE_WRITABLE");
+  return c;
+}
+//-------------------------------------------------------------------------
+static void addFeature(DoubleVector& v, const Feature& f)
+{
+  for (unsigned long i=0; i<f.getVectSize(); i++)
+    v.addValue(f[i]);
+}
+//-------------------------------------------------------------------------
+// the features read in sequence, with a step, after seeks and by blocks
+//-------------------------------------------------------------------------
+static void readAll(FeatureInputStream& r, DoubleVector& v)
+{
+  static const unsigned long SEEKS[] = {10, 4000, 3999, 0, 2500, 5002,
+                                        1234, 1233, 4999, 17};
+  Feature f;
+  FrameBlock b;
+  unsigned long k, t, n;
+  v.clear();
+  while (r.readFeature(f))
+    addFeature(v, f);
+  r.seekFeature(3);
+  while (r.readFeature(f, 37))
+    addFeature(v, f);
+  for (k=0; k<sizeof(SEEKS)/sizeof(SEEKS[0]); k++)
+  {
+    r.seekFeature(SEEKS[k]);
+    for (t=0; t<3 && r.readFeature(f); t++)
+      addFeature(v, f);
+  }
+  r.seekFeature(0);
+  while ((n = r.readFeatures(b, 300)) != 0)
+    for (t=0; t<n; t++)
+    {
+      b.getFeature(t, f);
+      addFeature(v, f);
+    }
+}
+//-------------------------------------------------------------------------
+static bool check(const String& step, bool ok)
+{
+  if (!ok)
+    printf("FAILED %s\n", step.c_str());
+  return ok;
+}
+//-------------------------------------------------------------------------
+static bool check(const String& step, const DoubleVector& v,
+                  const DoubleVector& ref)
+{
+  if (v.size() != ref.size())
+  {
+    printf("FAILED %s : %lu values instead of %lu\n", step.c_str(),
+           v.size(), ref.size());
+    return false;
+  }
+  for (unsigned long i=0; i<ref.size(); i++)
+    if (v[i] != ref[i])
+    {
+      printf("FAILED %s : value %lu\n", step.c_str(), i);
+      return false;
+    }
+  return true;
+}
+//-------------------------------------------------------------------------
+int main()
+{
+  try
+  {
+    // buffers of 1 feature, odd sizes, 1/3 of the file
+    static const unsigned long MEM_ALLOCS[] = {VECT_SIZE*sizeof(float),
+        1000, 4001, FRAME_COUNT*VECT_SIZE*sizeof(float)/3};
+    writeFeatureFile();
+    unsigned long nbFailed = 0, nbChecked = 0;
+    DoubleVector ref, v;
+    {
+      Config c = getConfig(0, false, false);
+      FeatureFileReader r(FILE_NAME, c);
+      readAll(r, ref);
+    }
+    nbChecked++;
+    if (!check("whole file", ref.size() > FRAME_COUNT*VECT_SIZE))
+      nbFailed++;
+    for (unsigned long m=0; m<sizeof(MEM_ALLOCS)/sizeof(MEM_ALLOCS[0]); m++)
+      for (int prefetch=0; prefetch<2; prefetch++)
+      {
+        const String step = "memAlloc " + String::valueOf(MEM_ALLOCS[m])
+                          + (prefetch ? " prefetch" : "");
+        Config c = getConfig(MEM_ALLOCS[m], prefetch != 0, false);
+        FeatureFileReader r(FILE_NAME, c);
+        readAll(r, v);
+        nbChecked++;
+        if (!check(step, v, ref))
+          nbFailed++;
+      }
+
+    // writing
+    for (int prefetch=0; prefetch<2; prefetch++)
+    {
+      const String step = String("write") + (prefetch ? " prefetch" : "");
+      Feature f(VECT_SIZE);
+      for (unsigned long i=0; i<VECT_SIZE; i++)
+        f[i] = -100.0-i;
+      Config c = getConfig(0, prefetch != 0, true);
+      FeatureFileReader r(FILE_NAME, c);
+      r.seekFeature(4321);
+      const bool written = r.writeFeature(f);
+      Feature g;
+      r.seekFeature(4321);
+      nbChecked += 2;
+      if (!check(step, written && r.readFeature(g) && g[0] == f[0]
+                 && g[VECT_SIZE-1] == f[VECT_SIZE-1]))
+        nbFailed++;
+      Config small = getConfig(1000, prefetch != 0, true);
+      FeatureFileReader rs(FILE_NAME, small);
+      try
+      {
+        rs.seekFeature(4321);
+        rs.writeFeature(f);
+        check(step + " : small buffer", false);
+        nbFailed++;
+      }
+      catch (Exception&) {}
+    }
+
+    remove((String(FILE_NAME)+".raw").c_str());
+    printf("%lu/%lu checks passed\n", nbChecked-nbFailed, nbChecked);
+    return (nbFailed == 0 ? 0 : 1);
+  }
+  catch (Exception& e)
+  {
+    printf("%s\n", e.toString().c_str());
+    return 1;
+  }
+}
@@ -0,0 +1,262 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+// Checks FeatureInputStream::readFeatures() : through a chain reader,
+// modifier and feature server, the blocks contain the features given by
+// readFeature(), for one file or a list of files, buffered or mapped,
+// with a small buffer, with and without a mask and for several block
+// sizes. Blocks and single features can be read alternately, and a block
+// read after a seek starts at the sought feature.
+// Returns 0 if all the checks pass.
+
+#include <cstdio>
+#include "alize.h"
+
+using namespace alize;
+
+static const unsigned long VECT_SIZE = 7;
+static const unsigned long FILE_COUNT = 4;
+static const unsigned long FRAME_COUNTS[FILE_COUNT] = {123, 40, 1, 57};
+
+static unsigned long seed = 12345;
+//-------------------------------------------------------------------------
+static real_t randomValue(real_t min, real_t max)
+{
+  seed = seed*1103515245 + 12345;
+  return min + (max-min)*((seed/65536)%32768)/32767.0;
+}
+//-------------------------------------------------------------------------
+static String getFileName(unsigned long k)
+{ return "TestReadFeatures" + String::valueOf(k); }
+//-------------------------------------------------------------------------
+static void writeFeatureFile(unsigned long k)
+{
+  FILE* f = fopen((getFileName(k)+".raw").c_str(), "wb");
+  if (f == NULL)
+    throw Exception("Cannot create the feature file", __FILE__, __LINE__);
+  for (unsigned long t=0; t<FRAME_COUNTS[k]*VECT_SIZE; t++)
+  {
+    const float v = (float)randomValue(-10.0, 10.0);
+    fwrite(&v, sizeof(v), 1, f);
+  }
+  fclose(f);
+}
+//-------------------------------------------------------------------------
+// reader, modifier and server
+//-------------------------------------------------------------------------
+class Chain
+{
+public :
+  Chain(const Config& c, const XLine& files, const String& mask)
+    :_reader(files, c), _modifier(_reader, mask), _config(c)
+  {
+    _config.setParam("vectSize", String::valueOf(_modifier.getVectSize()));
+    _pServer = new FeatureServer(_config, _modifier);
+  }
+  ~Chain() { delete _pServer; }
+  FeatureServer& server() { return *_pServer; }
+private :
+  FeatureFileReader          _reader;
+  FeatureInputStreamModifier _modifier;
+  Config                     _config;
+  FeatureServer*             _pServer;
+};
+//-------------------------------------------------------------------------
+static void addFrame(DoubleVector& v, const real_t* p, unsigned long n)
+{
+  for (unsigned long i=0; i<n; i++)
+    v.addValue(p[i]);
+}
+//-------------------------------------------------------------------------
+static bool check(const String& step, const DoubleVector& v,
+                  const DoubleVector& ref)
+{
+  if (v.size() != ref.size())
+  {
+    printf("FAILED %s : %lu values instead of %lu\n", step.c_str(),
+           v.size(), ref.size());
+    return false;
+  }
+  for (unsigned long i=0; i<ref.size(); i++)
+    if (v[i] != ref[i])
+    {
+      printf("FAILED %s : value %lu\n", step.c_str(), i);
+      return false;
+    }
+  return true;
+}
+//-------------------------------------------------------------------------
+int main()
+{
+  try
+  {
+    static const char* MASKS[] = {"NO_MASK", "0,2-4"};
+    static const unsigned long BLOCK_SIZES[] = {1, 7, 64, 1000};
+    XLine all, single;
+    unsigned long k, t;
+    for (k=0; k<FILE_COUNT; k++)
+    {
+      writeFeatureFile(k);
+      all.addElement(getFileName(k));
+    }
+    single.addElement(getFileName(0));
+    unsigned long nbFailed = 0, nbChecked = 0;
+
+    for (int list=0; list<2; list++)
+      for (int mapped=0; mapped<2; mapped++)
+        for (int smallBuffer=0; smallBuffer<2; smallBuffer++)
+          for (unsigned long m=0; m<2; m++)
+            for (unsigned long b=0; b<4; b++)
+            {
+              const unsigned long bs = BLOCK_SIZES[b];
+              const String step = String(list ? "list" : "file")
+                + (mapped ? " mapped" : " buffered")
+                + (smallBuffer ? " small buffer" : "") + " mask "
+                + MASKS[m] + " block " + String::valueOf(bs);
+              Config c;
+              c.setParam("vectSize", String::valueOf(VECT_SIZE));
+              c.setParam("loadFeatureFileFormat", "RAW");
+              c.setParam("loadFeatureFileVectSize",
+                         String::valueOf(VECT_SIZE));
+              c.setParam("loadFeatureFileExtension", ".raw");
+              c.setParam("featureFilesPath", "./");
+              c.setParam("bigEndian", "false");
+              c.setParam("sampleRate", "100");
+              c.setParam("loadFeatureFileMemoryMap",
+                         mapped ? "true" : "false");
+              if (smallBuffer)
+                c.setParam("loadFeatureFileMemAlloc",
+                           String::valueOf(10*VECT_SIZE*sizeof(float)));
+              const XLine& files = (list ? all : single);
+              Chain ref(c, files, MASKS[m]), blocks(c, files, MASKS[m]);
+              FeatureServer& rs = ref.server();
+              FeatureServer& ss = blocks.server();
+              const unsigned long vectSize = rs.getVectSize();
+              Feature f;
+              FrameBlock block;
+              DoubleVector refVect, v;
+              unsigned long n;
+
+              // whole stream
+              while (rs.readFeature(f))
+                addFrame(refVect, f.getDataVector(), vectSize);
+              while ((n = ss.readFeatures(block, bs)) != 0)
+              {
+                if (n > bs || block.getFrameCount() != n
+                    || block.getVectSize() != vectSize)
+                  v.addValue(-1.0);
+                for (t=0; t<n; t++)
+                  addFrame(v, block.getFrame(t), vectSize);
+              }
+              nbChecked++;
+              if (!check(step + " : stream", v, refVect))
+                nbFailed++;
+
+              // blocks and features alternately
+              ss.seekFeature(0);
+              v.clear();
+              for (bool feature=false; ; feature=!feature)
+              {
+                if (feature)
+                {
+                  if (!ss.readFeature(f))
+                    break;
+                  addFrame(v, f.getDataVector(), vectSize);
+                }
+                else
+                {
+                  if ((n = ss.readFeatures(block, bs)) == 0)
+                    break;
+                  for (t=0; t<n; t++)
+                    addFrame(v, block.getFrame(t), vectSize);
+                }
+              }
+              nbChecked++;
+              if (!check(step + " : alternately", v, refVect))
+                nbFailed++;
+
+              // seek
+              const unsigned long first = (list ? 160 : 50);
+              ss.seekFeature(first);
+              n = ss.readFeatures(block, bs);
+              v.clear();
+              for (t=0; t<n; t++)
+                addFrame(v, block.getFrame(t), vectSize);
+              DoubleVector seekRef;
+              rs.seekFeature(first);
+              for (t=0; t<n && rs.readFeature(f); t++)
+                addFrame(seekRef, f.getDataVector(), vectSize);
+              nbChecked++;
+              if (n == 0)
+              {
+                printf("FAILED %s : no feature after the seek\n",
+                       step.c_str());
+                nbFailed++;
+              }
+              else if (!check(step + " : seek", v, seekRef))
+                nbFailed++;
+            }
+
+    for (k=0; k<FILE_COUNT; k++)
+      remove((getFileName(k)+".raw").c_str());
+    printf("%lu/%lu checks passed\n", nbChecked-nbFailed, nbChecked);
+    return (nbFailed == 0 ? 0 : 1);
+  }
+  catch (Exception& e)
+  {
+    printf("%s\n", e.toString().c_str());
+    return 1;
+  }
+}
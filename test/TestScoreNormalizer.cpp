@@ -0,0 +1,362 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+// Checks ScoreCache and ScoreNormalizer : a saved cache is loaded back
+// unchanged and added to the scores already in the cache, a file saved for
+// another world model or missing is refused without modifying the cache.
+// The cohort scores of the normalizer are the TrialScorer scores, the Z,
+// T and ZT normalizations use the mean and standard deviation of these
+// scores, and a normalizer with a loaded cache scores nothing again and
+// gives the same normalized scores. Missing impostor sets and parameters
+// are refused.
+// Returns 0 if all the checks pass.
+
+#include <cstdio>
+#include <cmath>
+#include "alize.h"
+
+using namespace alize;
+
+static const unsigned long VECT_SIZE = 4;
+static const unsigned long DISTRIB_COUNT = 16;
+static const unsigned long MODEL_COUNT = 8; // 3 targets, 5 impostors
+static const unsigned long TARGET_COUNT = 3;
+static const unsigned long SEGMENT_COUNT = 10; // 4 tests, 6 impostors
+static const unsigned long TEST_COUNT = 4;
+static const char* CACHE_FILE = "TestScoreNormalizer.scc";
+
+static unsigned long seed = 12345;
+//-------------------------------------------------------------------------
+static real_t randomValue(real_t min, real_t max)
+{
+  seed = seed*1103515245 + 12345;
+  return min + (max-min)*((seed/65536)%32768)/32767.0;
+}
+//-------------------------------------------------------------------------
+static String getSegmentName(unsigned long k)
+{ return "TestScoreNormalizer" + String::valueOf(k); }
+//-------------------------------------------------------------------------
+static String getModelId(unsigned long j)
+{ return "spk" + String::valueOf(j); }
+//-------------------------------------------------------------------------
+static void writeFeatureFile(unsigned long k)
+{
+  FILE* f = fopen((getSegmentName(k)+".raw").c_str(), "wb");
+  if (f == NULL)
+    throw Exception("Cannot create the feature file", __FILE__, __LINE__);
+  for (unsigned long t=0; t<(100+20*k)*VECT_SIZE; t++)
+  {
+    const float v = (float)randomValue(0.0, 4.0);
+    fwrite(&v, sizeof(v), 1, f);
+  }
+  fclose(f);
+}
+//-------------------------------------------------------------------------
+static void initMixture(MixtureGD& m)
+{
+  for (unsigned long c=0; c<DISTRIB_COUNT; c++)
+  {
+    DistribGD& d = m.getDistrib(c);
+    for (unsigned long i=0; i<VECT_SIZE; i++)
+    {
+      d.setMean(randomValue(0.0, 4.0), i);
+      d.setCov(randomValue(0.5, 1.5), i);
+    }
+  }
+  m.equalizeWeights();
+  m.computeAll();
+}
+//-------------------------------------------------------------------------
+// (score - mean) / standard deviation of the cohort scores
+//-------------------------------------------------------------------------
+static real_t normalize(real_t score, const DoubleVector& cohort)
+{
+  real_t sum = 0.0, sum2 = 0.0;
+  for (unsigned long i=0; i<cohort.size(); i++)
+  {
+    sum += cohort[i];
+    sum2 += cohort[i]*cohort[i];
+  }
+  const real_t mean = sum/cohort.size();
+  const real_t var = sum2/cohort.size()-mean*mean;
+  return (var > 0.0 ? (score-mean)/sqrt(var) : score-mean);
+}
+//-------------------------------------------------------------------------
+static real_t getScore(const ScoreCache& cache, const String& model,
+                       const String& segment)
+{
+  real_t score;
+  if (!cache.getScore(model, segment, score))
+    throw Exception("No score for '" + model + "' and '" + segment + "'",
+                    __FILE__, __LINE__);
+  return score;
+}
+//-------------------------------------------------------------------------
+static real_t zNorm(const ScoreCache& cache, real_t score,
+                    const String& model, const XLine& zSegments)
+{
+  DoubleVector cohort;
+  for (unsigned long k=0; k<zSegments.getElementCount(); k++)
+    cohort.addValue(getScore(cache, model, zSegments.getElement(k, false)));
+  return normalize(score, cohort);
+}
+//-------------------------------------------------------------------------
+static bool check(const String& step, bool ok)
+{
+  if (!ok)
+    printf("FAILED %s\n", step.c_str());
+  return ok;
+}
+//-------------------------------------------------------------------------
+static bool check(const String& step, real_t v, real_t ref)
+{
+  if (fabs(v-ref) <= 1e-12*(1.0+fabs(ref)))
+    return true;
+  printf("FAILED %s : %.15g instead of %.15g\n", step.c_str(), v, ref);
+  return false;
+}
+//-------------------------------------------------------------------------
+int main()
+{
+  try
+  {
+    Config c;
+    c.setParam("vectSize", String::valueOf(VECT_SIZE));
+    c.setParam("minLLK", "-200");
+    c.setParam("maxLLK", "200");
+    c.setParam("topDistribsCount", "5");
+    c.setParam("computeLLKWithTopDistribs", "COMPLETE");
+    c.setParam("loadFeatureFileFormat", "RAW");
+    c.setParam("loadFeatureFileVectSize", String::valueOf(VECT_SIZE));
+    c.setParam("loadFeatureFileExtension", ".raw");
+    c.setParam("featureFilesPath", "./");
+    c.setParam("bigEndian", "false");
+    c.setParam("sampleRate", "100");
+    MixtureServer ms(c);
+    MixtureGD& world = ms.createMixtureGD(DISTRIB_COUNT);
+    ms.setMixtureId(world, "world");
+    initMixture(world);
+    const unsigned long worldChecksum = world.computeChecksum();
+    XLine targets, tModels, tests, zSegments;
+    unsigned long j, k;
+    for (j=0; j<MODEL_COUNT; j++)
+    {
+      MixtureGD& m = ms.createMixtureGD(DISTRIB_COUNT);
+      ms.setMixtureId(m, getModelId(j));
+      initMixture(m);
+      (j < TARGET_COUNT ? targets : tModels).addElement(getModelId(j));
+    }
+    for (k=0; k<SEGMENT_COUNT; k++)
+    {
+      writeFeatureFile(k);
+      (k < TEST_COUNT ? tests : zSegments).addElement(getSegmentName(k));
+    }
+    unsigned long nbFailed = 0, nbChecked = 0;
+    real_t score;
+
+    // cache
+    ScoreCache cache(worldChecksum);
+    cache.setScore("a", "x", 1.5);
+    cache.setScore("a", "y", -2.25);
+    cache.setScore("b", "x", 0.125);
+    cache.setScore("a", "x", 3.0); // replaced
+    nbChecked += 3;
+    if (!check("cache : count", cache.getScoreCount() == 3))
+      nbFailed++;
+    if (!check("cache : score", cache.getScore("a", "x", score)
+               && score == 3.0))
+      nbFailed++;
+    if (!check("cache : missing pair", !cache.getScore("b", "y", score)))
+      nbFailed++;
+    cache.save(CACHE_FILE);
+    ScoreCache loaded(worldChecksum), other(worldChecksum+1);
+    loaded.setScore("c", "z", 7.0);
+    nbChecked += 6;
+    if (!check("cache : load", loaded.load(CACHE_FILE)))
+      nbFailed++;
+    if (!check("cache : loaded count", loaded.getScoreCount() == 4))
+      nbFailed++;
+    if (!check("cache : loaded scores",
+               loaded.getScore("a", "x", score) && score == 3.0
+               && loaded.getScore("a", "y", score) && score == -2.25
+               && loaded.getScore("b", "x", score) && score == 0.125
+               && loaded.getScore("c", "z", score) && score == 7.0))
+      nbFailed++;
+    other.setScore("c", "z", 7.0);
+    if (!check("cache : other world model", !other.load(CACHE_FILE)))
+      nbFailed++;
+    if (!check("cache : missing file", !other.load("TestScoreNormalizer.no")))
+      nbFailed++;
+    if (!check("cache : refused file", other.getScoreCount() == 1
+               && !other.getScore("a", "x", score)))
+      nbFailed++;
+
+    // normalizer, with a cache of another world model
+    ThreadPool pool(3);
+    ScoreNormalizer n1(c, ms, world, pool, other);
+    nbChecked += 2;
+    if (!check("normalizer : cache reset", other.getScoreCount() == 0
+               && other.getWorldChecksum() == worldChecksum))
+      nbFailed++;
+    try
+    {
+      n1.prepare(targets, tests, ScoreNorm_Z);
+      check("normalizer : no Z-norm segment", false);
+      nbFailed++;
+    }
+    catch (Exception&) {}
+    n1.setZNormSegments(zSegments);
+    n1.setTNormModels(tModels);
+    n1.prepare(targets, tests, ScoreNorm_ZT);
+    n1.prepare(targets, tests, ScoreNorm_T);
+    nbChecked += 2;
+    if (!check("normalizer : cohort count", other.getScoreCount()
+               == TARGET_COUNT*zSegments.getElementCount()
+               + (MODEL_COUNT-TARGET_COUNT)*(SEGMENT_COUNT)))
+      nbFailed++;
+    try
+    {
+      n1.normalize(0.0, "world", getSegmentName(0), ScoreNorm_Z);
+      check("normalizer : model not prepared", false);
+      nbFailed++;
+    }
+    catch (Exception&) {}
+
+    // cohort scores
+    TrialScorer ts(c, ms, world, pool);
+    for (k=0; k<SEGMENT_COUNT; k++)
+      for (j=TARGET_COUNT; j<MODEL_COUNT; j++)
+        ts.addTrial(getSegmentName(k), getModelId(j));
+    ts.run();
+    for (unsigned long t=0; t<ts.getTrialCount(); t++)
+    {
+      nbChecked++;
+      if (!check("cohort score " + String::valueOf(t),
+                 getScore(other, ts.getTrialModel(t).getId(),
+                     ts.getTestName(ts.getTrialTest(t))) == ts.getScore(t)))
+        nbFailed++;
+    }
+
+    // normalized scores, then with the saved cache
+    other.save(CACHE_FILE);
+    ScoreCache reloaded(worldChecksum);
+    nbChecked++;
+    if (!check("reloaded cache : load", reloaded.load(CACHE_FILE)
+               && reloaded.getScoreCount() == other.getScoreCount()))
+      nbFailed++;
+    ScoreNormalizer n2(c, ms, world, pool, reloaded);
+    n2.setZNormSegments(zSegments);
+    n2.setTNormModels(tModels);
+    nbChecked++;
+    if (!check("reloaded cache : nothing scored",
+               n2.computeScores(targets, zSegments) == 0
+               && n2.computeScores(tModels, tests) == 0))
+      nbFailed++;
+    n2.prepare(targets, tests, ScoreNorm_ZT);
+    n2.prepare(targets, tests, ScoreNorm_T);
+    for (j=0; j<TARGET_COUNT; j++)
+      for (k=0; k<TEST_COUNT; k++)
+      {
+        const String& model = targets.getElement(j, false);
+        const String& segment = tests.getElement(k, false);
+        const String step = model + "/" + segment;
+        const real_t s = randomValue(-1.0, 1.0);
+        DoubleVector tCohort, ztCohort;
+        for (unsigned long i=0; i<tModels.getElementCount(); i++)
+        {
+          const String& tModel = tModels.getElement(i, false);
+          const real_t cs = getScore(other, tModel, segment);
+          tCohort.addValue(cs);
+          ztCohort.addValue(zNorm(other, cs, tModel, zSegments));
+        }
+        const real_t z = zNorm(other, s, model, zSegments);
+        const real_t t = normalize(s, tCohort);
+        const real_t zt = normalize(z, ztCohort);
+        nbChecked += 6;
+        if (!check(step + " : Z-norm",
+                   n1.normalize(s, model, segment, ScoreNorm_Z), z))
+          nbFailed++;
+        if (!check(step + " : T-norm",
+                   n1.normalize(s, model, segment, ScoreNorm_T), t))
+          nbFailed++;
+        if (!check(step + " : ZT-norm",
+                   n1.normalize(s, model, segment, ScoreNorm_ZT), zt))
+          nbFailed++;
+        if (!check(step + " : reloaded Z-norm",
+                   n2.normalize(s, model, segment, ScoreNorm_Z)
+                   == n1.normalize(s, model, segment, ScoreNorm_Z)))
+          nbFailed++;
+        if (!check(step + " : reloaded T-norm",
+                   n2.normalize(s, model, segment, ScoreNorm_T)
+                   == n1.normalize(s, model, segment, ScoreNorm_T)))
+          nbFailed++;
+        if (!check(step + " : reloaded ZT-norm",
+                   n2.normalize(s, model, segment, ScoreNorm_ZT)
+                   == n1.normalize(s, model, segment, ScoreNorm_ZT)))
+          nbFailed++;
+      }
+
+    for (k=0; k<SEGMENT_COUNT; k++)
+      remove((getSegmentName(k)+".raw").c_str());
+    remove(CACHE_FILE);
+    printf("%lu/%lu checks passed\n", nbChecked-nbFailed, nbChecked);
+    return (nbFailed == 0 ? 0 : 1);
+  }
+  catch (Exception& e)
+  {
+    printf("%s\n", e.toString().c_str());
+    return 1;
+  }
+}
@@ -0,0 +1,218 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+// Checks that several threads, each with its own StatServer, can score
+// against one MixtureServer prepared by prepareMixtures() : every thread
+// must get the results of the same computation done by one thread, in
+// the linear and the log domain and with top distributions determined
+// with a gaussian selection index or with the partial distance search.
+// Without THREAD, the jobs are run by the caller.
+// Returns 0 if all the checks pass.
+
+#include <cstdio>
+#include "alize.h"
+
+using namespace alize;
+
+static const unsigned long VECT_SIZE = 13;
+static const unsigned long DISTRIB_COUNT = 128;
+static const unsigned long FRAME_COUNT = 200;
+static const unsigned long VARIANT_COUNT = 4;
+static const unsigned long JOB_COUNT = 6*VARIANT_COUNT;
+
+static unsigned long seed = 12345;
+//-------------------------------------------------------------------------
+static real_t randomValue(real_t min, real_t max)
+{
+  seed = seed*1103515245 + 12345;
+  return min + (max-min)*((seed/65536)%32768)/32767.0;
+}
+//-------------------------------------------------------------------------
+static void initMixture(MixtureGD& m)
+{
+  for (unsigned long c=0; c<DISTRIB_COUNT; c++)
+  {
+    DistribGD& d = m.getDistrib(c);
+    for (unsigned long i=0; i<VECT_SIZE; i++)
+    {
+      d.setMean(randomValue(-2.0, 2.0), i);
+      d.setCov(randomValue(0.3, 1.3), i);
+    }
+  }
+  m.equalizeWeights();
+  m.computeAll();
+}
+//-------------------------------------------------------------------------
+// Scores all the frames with the config of a variant. The StatServer is
+// the context of the job.
+//-------------------------------------------------------------------------
+static lk_t score(const Config& c, MixtureServer& ms, const MixtureGD& world,
+                  const MixtureGD& target, const FrameBlock& b)
+{
+  StatServer ss(c, ms);
+  MixtureStat& worldStat = ss.createAndStoreMixtureStat(world);
+  MixtureStat& targetStat = ss.createAndStoreMixtureStat(target);
+  const bool topDistribs = c.existsParam("topDistribsCount");
+  Feature f(VECT_SIZE);
+  for (unsigned long t=0; t<b.getFrameCount(); t++)
+  {
+    b.getFeature(t, f);
+    if (topDistribs)
+    {
+      worldStat.computeAndAccumulateLLK(f, 1.0, DETERMINE_TOP_DISTRIBS);
+      targetStat.computeAndAccumulateLLK(f, 1.0, USE_TOP_DISTRIBS);
+    }
+    else
+      worldStat.computeAndAccumulateLLK(f);
+  }
+  return worldStat.getAccumulatedLLK() + targetStat.getAccumulatedLLK();
+}
+//-------------------------------------------------------------------------
+class ScoringTask : public ThreadTask
+{
+public :
+  ScoringTask(const Config* configArray, MixtureServer& ms,
+              const MixtureGD& world, const MixtureGD& target,
+              const FrameBlock& b)
+  :_configArray(configArray), _ms(ms), _world(world), _target(target),
+   _b(b) {}
+
+  virtual void runJob(unsigned long job, unsigned long)
+  {
+    _llk[job] = score(_configArray[job%VARIANT_COUNT], _ms, _world,
+                      _target, _b);
+  }
+
+  lk_t _llk[JOB_COUNT];
+private :
+  const Config*     _configArray;
+  MixtureServer&    _ms;
+  const MixtureGD&  _world;
+  const MixtureGD&  _target;
+  const FrameBlock& _b;
+};
+//-------------------------------------------------------------------------
+int main()
+{
+  try
+  {
+    Config configArray[VARIANT_COUNT];
+    unsigned long v;
+    for (v=0; v<VARIANT_COUNT; v++)
+    {
+      Config& c = configArray[v];
+      c.setParam("vectSize", String::valueOf(VECT_SIZE));
+      c.setParam("minLLK", "-200");
+      c.setParam("maxLLK", "200");
+    }
+    configArray[1].setParam("computeLLKInLogDomain", "true");
+    for (v=2; v<VARIANT_COUNT; v++)
+    {
+      configArray[v].setParam("topDistribsCount", "10");
+      configArray[v].setParam("computeLLKWithTopDistribs", "COMPLETE");
+    }
+    configArray[2].setParam("gaussianSelection", "true");
+    configArray[2].setParam("gaussianSelectionSearchedClusterCount", "3");
+    configArray[3].setParam("topDistribsPruning", "true");
+
+    MixtureServer ms(configArray[0]);
+    MixtureGD& world = ms.createMixtureGD(DISTRIB_COUNT);
+    MixtureGD& target = ms.createMixtureGD(DISTRIB_COUNT);
+    initMixture(world);
+    initMixture(target);
+    world.createSelector(8);
+    FrameBlock b(VECT_SIZE);
+    Feature f(VECT_SIZE);
+    for (unsigned long t=0; t<FRAME_COUNT; t++)
+    {
+      for (unsigned long i=0; i<VECT_SIZE; i++)
+        f[i] = randomValue(-3.0, 3.0);
+      b.addFeature(f);
+    }
+
+    // reference : one thread
+    lk_t ref[VARIANT_COUNT];
+    for (v=0; v<VARIANT_COUNT; v++)
+      ref[v] = score(configArray[v], ms, world, target, b);
+
+    // shared between the threads
+    ms.prepareMixtures();
+    for (v=0; v<VARIANT_COUNT; v++)
+      world.prepareTopDistribs(configArray[v]);
+    ThreadPool pool(4);
+    ScoringTask task(configArray, ms, world, target, b);
+    pool.run(task, JOB_COUNT);
+
+    unsigned long nbFailed = 0, nbChecked = 0;
+    for (unsigned long j=0; j<JOB_COUNT; j++)
+    {
+      nbChecked++;
+      if (task._llk[j] != ref[j%VARIANT_COUNT])
+      {
+        printf("FAILED job %lu, variant %lu : %.17g instead of %.17g\n", j,
+               j%VARIANT_COUNT, task._llk[j], ref[j%VARIANT_COUNT]);
+        nbFailed++;
+      }
+    }
+    printf("%lu threads, %lu/%lu checks passed\n", pool.getThreadCount(),
+           nbChecked-nbFailed, nbChecked);
+    return (nbFailed == 0 ? 0 : 1);
+  }
+  catch (Exception& e)
+  {
+    printf("%s\n", e.toString().c_str());
+    return 1;
+  }
+}
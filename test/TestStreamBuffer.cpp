@@ -0,0 +1,312 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+// Checks the buffer of a FeatureFileReaderSingle filled from another
+// FeatureInputStream : the features read through the buffer, in sequence,
+// after seeks, one by one or by blocks, are the features read from the
+// stream itself, whatever the buffer size. With a stream shorter than it
+// announces (an invalid feature in the middle), the three read paths stop
+// on it and return the features before it unshifted.
+// Returns 0 if all the checks pass.
+
+#include <cstdio>
+#include "alize.h"
+
+using namespace alize;
+
+static const unsigned long VECT_SIZE = 13;
+static const unsigned long FRAME_COUNT = 2011;
+static const char* FILE_NAME = "TestStreamBuffer";
+
+static unsigned long seed = 12345;
+//-------------------------------------------------------------------------
+static real_t randomValue(real_t min, real_t max)
+{
+  seed = seed*1103515245 + 12345;
+  return min + (max-min)*((seed/65536)%32768)/32767.0;
+}
+//-------------------------------------------------------------------------
+// A reader which buffers the features of another stream
+//-------------------------------------------------------------------------
+class StreamReader : public FeatureFileReaderSingle
+{
+public :
+  StreamReader(FeatureInputStream& s, const Config& c)
+  :FeatureFileReaderSingle(NULL, &s, c, NULL, BUFFER_AUTO, 0,
+                           ALL_FEATURES, 0), _s(s) {}
+  virtual unsigned long getFeatureCount() { return _s.getFeatureCount(); }
+  virtual unsigned long getVectSize() { return _s.getVectSize(); }
+  virtual const FeatureFlags& getFeatureFlags()
+  { return _s.getFeatureFlags(); }
+  virtual real_t getSampleRate() { return _s.getSampleRate(); }
+  virtual void reset() {}
+  virtual String getClassName() const { return "StreamReader"; }
+private :
+  FeatureInputStream& _s;
+};
+//-------------------------------------------------------------------------
+// A stream which announces 20 features but returns an invalid feature at
+// index 7 and stops after the feature 14. Feature t is (10t, 10t+1, 10t+2)
+//-------------------------------------------------------------------------
+class ShortStream : public FeatureInputStream
+{
+public :
+  ShortStream(const Config& c)
+  :FeatureInputStream(c), _flags("100000"), _pos(0), _name("short") {}
+  virtual bool readFeature(Feature& f, unsigned long s = 1)
+  {
+    if (_pos >= 15)
+      return false;
+    for (unsigned long i=0; i<3; i++)
+      f[i] = _pos*10.0+i;
+    f.setValidity(_pos != 7);
+    _pos += s;
+    return true;
+  }
+  virtual bool addFeature(const Feature&) { return false; }
+  virtual void reset() { _pos = 0; }
+  virtual void close() {}
+  virtual unsigned long getVectSize() { return 3; }
+  virtual const FeatureFlags& getFeatureFlags() { return _flags; }
+  virtual real_t getSampleRate() { return 100.0; }
+  virtual unsigned long getFeatureCount() { return 20; }
+  virtual void seekFeature(unsigned long n, const String&) { _pos = n; }
+  virtual unsigned long getSourceCount() { return 1; }
+  virtual unsigned long getFeatureCountOfASource(unsigned long)
+  { return 20; }
+  virtual unsigned long getFeatureCountOfASource(const String&)
+  { return 20; }
+  virtual unsigned long getFirstFeatureIndexOfASource(unsigned long)
+  { return 0; }
+  virtual unsigned long getFirstFeatureIndexOfASource(const String&)
+  { return 0; }
+  virtual const String& getNameOfASource(unsigned long) { return _name; }
+  virtual String getClassName() const { return "ShortStream"; }
+private :
+  FeatureFlags  _flags;
+  unsigned long _pos;
+  String        _name;
+};
+//-------------------------------------------------------------------------
+static void writeFeatureFile()
+{
+  FILE* f = fopen((String(FILE_NAME)+".raw").c_str(), "wb");
+  if (f == NULL)
+    throw Exception("Cannot create the feature file", __FILE__, __LINE__);
+  for (unsigned long t=0; t<FRAME_COUNT*VECT_SIZE; t++)
+  {
+    const float v = (float)randomValue(-10.0, 10.0);
+    fwrite(&v, sizeof(v), 1, f);
+  }
+  fclose(f);
+}
+//-------------------------------------------------------------------------
+static Config getConfig(const char* memAlloc)
+{
+  Config c;
+  c.setParam("vectSize", String::valueOf(VECT_SIZE));
+  c.setParam("loadFeatureFileFormat", "RAW");
+  c.setParam("loadFeatureFileVectSize", String::valueOf(VECT_SIZE));
+  c.setParam("loadFeatureFileExtension", ".raw");
+  c.setParam("featureFilesPath", "./");
+  c.setParam("featureFlags", "100000");
+  c.setParam("bigEndian", "false");
+  c.setParam("sampleRate", "100");
+  if (memAlloc != NULL)
+    c.setParam("loadFeatureFileMemAlloc", memAlloc);
+  return c;
+}
+//-------------------------------------------------------------------------
+static void addFeature(DoubleVector& v, const Feature& f)
+{
+  for (unsigned long i=0; i<f.getVectSize(); i++)
+    v.addValue(f[i]);
+}
+//-------------------------------------------------------------------------
+// the features read in sequence, with a step, after seeks and by blocks
+//-------------------------------------------------------------------------
+static void readAll(FeatureInputStream& r, DoubleVector& v)
+{
+  static const unsigned long SEEKS[] = {10, 2000, 1999, 0, 1500, 2010,
+                                        1234, 1233, 17};
+  Feature f;
+  FrameBlock b;
+  unsigned long k, t, n;
+  v.clear();
+  r.seekFeature(0);
+  while (r.readFeature(f))
+    addFeature(v, f);
+  r.seekFeature(3);
+  while (r.readFeature(f, 37))
+    addFeature(v, f);
+  for (k=0; k<sizeof(SEEKS)/sizeof(SEEKS[0]); k++)
+  {
+    r.seekFeature(SEEKS[k]);
+    for (t=0; t<3 && r.readFeature(f); t++)
+      addFeature(v, f);
+  }
+  r.seekFeature(0);
+  while ((n = r.readFeatures(b, 300)) != 0)
+    for (t=0; t<n; t++)
+    {
+      b.getFeature(t, f);
+      addFeature(v, f);
+    }
+}
+//-------------------------------------------------------------------------
+static bool check(const String& step, const DoubleVector& v,
+                  const DoubleVector& ref)
+{
+  if (v.size() != ref.size())
+  {
+    printf("FAILED %s : %lu values instead of %lu\n", step.c_str(),
+           v.size(), ref.size());
+    return false;
+  }
+  for (unsigned long i=0; i<ref.size(); i++)
+    if (v[i] != ref[i])
+    {
+      printf("FAILED %s : value %lu\n", step.c_str(), i);
+      return false;
+    }
+  return true;
+}
+//-------------------------------------------------------------------------
+int main()
+{
+  try
+  {
+    unsigned long nbFailed = 0, nbChecked = 0;
+    unsigned long m, mode, n, t;
+    writeFeatureFile();
+
+    // buffers of the whole stream, 1 feature, odd sizes, 1/3 of the stream
+    static const char* MEM_ALLOCS[] = {NULL, "52", "400", "4001", "34944"};
+    DoubleVector ref, v;
+    {
+      Config c = getConfig(NULL);
+      FeatureFileReader r(FILE_NAME, c);
+      readAll(r, ref);
+    }
+    for (m=0; m<sizeof(MEM_ALLOCS)/sizeof(MEM_ALLOCS[0]); m++)
+    {
+      const String step = String("memAlloc ")
+                        + (MEM_ALLOCS[m] != NULL ? MEM_ALLOCS[m] : "-");
+      Config c = getConfig(NULL);
+      Config cb = getConfig(MEM_ALLOCS[m]);
+      FeatureFileReader s(FILE_NAME, c);
+      StreamReader r(s, cb);
+      readAll(r, v);
+      nbChecked++;
+      if (!check(step, v, ref))
+        nbFailed++;
+    }
+
+    // short stream : features 0..6 only, with each read path
+    static const char* SHORT_MEM_ALLOCS[] = {NULL, "48", "60"};
+    for (m=0; m<sizeof(SHORT_MEM_ALLOCS)/sizeof(SHORT_MEM_ALLOCS[0]); m++)
+      for (mode=0; mode<3; mode++)
+      {
+        const String step = String("short stream, memAlloc ")
+            + (SHORT_MEM_ALLOCS[m] != NULL ? SHORT_MEM_ALLOCS[m] : "-")
+            + ", mode " + String::valueOf(mode);
+        Config c = getConfig(SHORT_MEM_ALLOCS[m]);
+        c.setParam("vectSize", "3");
+        ShortStream s(c);
+        StreamReader r(s, c);
+        DoubleVector expected;
+        v.clear();
+        for (t=0; t<7; t++)
+          for (unsigned long i=0; i<3; i++)
+            expected.addValue(t*10.0+i);
+        if (mode == 0)
+        {
+          Feature f;
+          while (r.readFeature(f))
+            addFeature(v, f);
+        }
+        else if (mode == 1)
+        {
+          FeatureView f;
+          while (r.readFeature(f))
+            for (unsigned long i=0; i<f.getVectSize(); i++)
+              v.addValue(f[i]);
+        }
+        else
+        {
+          FrameBlock b;
+          Feature f(3);
+          while ((n = r.readFeatures(b, 4)) != 0)
+            for (t=0; t<n; t++)
+            {
+              b.getFeature(t, f);
+              addFeature(v, f);
+            }
+        }
+        nbChecked++;
+        if (!check(step, v, expected))
+          nbFailed++;
+      }
+
+    remove((String(FILE_NAME)+".raw").c_str());
+    printf("%lu/%lu checks passed\n", nbChecked-nbFailed, nbChecked);
+    return (nbFailed == 0 ? 0 : 1);
+  }
+  catch (Exception& e)
+  {
+    printf("%s\n", e.toString().c_str());
+    return 1;
+  }
+}
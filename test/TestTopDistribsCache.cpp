@@ -0,0 +1,230 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+// Checks the save/load round-trip of TopDistribsCache : the log-likelihoods
+// of a model computed with the loaded top distributions are exactly those
+// of DETERMINE_TOP_DISTRIBS on the world model. Also checks that load()
+// refuses a file saved for another world model or for other features.
+// Returns 0 if all the checks pass.
+
+#include <cstdio>
+#include "alize.h"
+
+using namespace alize;
+
+static const unsigned long VECT_SIZE = 7;
+static const unsigned long DISTRIB_COUNT = 32;
+static const unsigned long FRAME_COUNT = 200;
+static const char* FEATURE_FILE = "TestTopDistribsCache";
+static const char* OTHER_FEATURE_FILE = "TestTopDistribsCache2";
+static const char* CACHE_FILE = "TestTopDistribsCache.tdc";
+
+static unsigned long seed = 12345;
+//-------------------------------------------------------------------------
+static real_t randomValue(real_t min, real_t max)
+{
+  seed = seed*1103515245 + 12345;
+  return min + (max-min)*((seed/65536)%32768)/32767.0;
+}
+//-------------------------------------------------------------------------
+static void initMixture(MixtureGD& m)
+{
+  for (unsigned long c=0; c<DISTRIB_COUNT; c++)
+  {
+    DistribGD& d = m.getDistrib(c);
+    for (unsigned long i=0; i<VECT_SIZE; i++)
+    {
+      d.setMean(randomValue(-2.0, 2.0), i);
+      d.setCov(randomValue(0.3, 1.3), i);
+    }
+  }
+  m.equalizeWeights();
+  m.computeAll();
+}
+//-------------------------------------------------------------------------
+// the second file differs from the first one by its last value
+//-------------------------------------------------------------------------
+static void writeFeatureFiles()
+{
+  FILE* f1 = fopen((String(FEATURE_FILE)+".raw").c_str(), "wb");
+  FILE* f2 = fopen((String(OTHER_FEATURE_FILE)+".raw").c_str(), "wb");
+  if (f1 == NULL || f2 == NULL)
+    throw Exception("Cannot create the feature files", __FILE__, __LINE__);
+  for (unsigned long t=0; t<FRAME_COUNT*VECT_SIZE; t++)
+  {
+    float v = (float)randomValue(-3.0, 3.0);
+    fwrite(&v, sizeof(v), 1, f1);
+    if (t == FRAME_COUNT*VECT_SIZE-1)
+      v += 1.0;
+    fwrite(&v, sizeof(v), 1, f2);
+  }
+  fclose(f1);
+  fclose(f2);
+}
+//-------------------------------------------------------------------------
+static bool check(const char* step, bool ok)
+{
+  if (!ok)
+    printf("FAILED %s\n", step);
+  return ok;
+}
+//-------------------------------------------------------------------------
+int main()
+{
+  try
+  {
+    writeFeatureFiles();
+    Config c;
+    c.setParam("vectSize", String::valueOf(VECT_SIZE));
+    c.setParam("minLLK", "-200");
+    c.setParam("maxLLK", "200");
+    c.setParam("topDistribsCount", "5");
+    c.setParam("computeLLKWithTopDistribs", "COMPLETE");
+    c.setParam("loadFeatureFileFormat", "RAW");
+    c.setParam("loadFeatureFileVectSize", String::valueOf(VECT_SIZE));
+    c.setParam("loadFeatureFileExtension", ".raw");
+    c.setParam("featureFilesPath", "./");
+    c.setParam("bigEndian", "false");
+    c.setParam("sampleRate", "100");
+    MixtureServer ms(c);
+    MixtureGD& world = ms.createMixtureGD(DISTRIB_COUNT);
+    MixtureGD& target = ms.createMixtureGD(DISTRIB_COUNT);
+    initMixture(world);
+    initMixture(target);
+    FeatureServer fs(c, FEATURE_FILE);
+    FeatureServer otherFs(c, OTHER_FEATURE_FILE);
+    const unsigned long worldChecksum = world.computeChecksum();
+    const unsigned long featureChecksum =
+                        TopDistribsCache::computeChecksum(fs);
+    unsigned long nbFailed = 0, nbChecked = 0;
+    Feature f;
+    unsigned long t;
+
+    // top distributions determined on the world model and saved
+    StatServer ss(c, ms);
+    MixtureStat& worldStat = ss.createAndStoreMixtureStat(world);
+    MixtureStat& targetStat = ss.createAndStoreMixtureStat(target);
+    TopDistribsCache cache(worldChecksum, featureChecksum);
+    for (t=0; fs.readFeature(f); t++)
+    {
+      worldStat.computeAndAccumulateLLK(f, 1.0, DETERMINE_TOP_DISTRIBS);
+      cache.addFrame(ss.getTopDistribIndexVector());
+      targetStat.computeAndAccumulateLLK(f, 1.0, USE_TOP_DISTRIBS);
+    }
+    cache.save(CACHE_FILE);
+
+    // loaded : same log-likelihoods without the world model
+    TopDistribsCache loaded;
+    nbChecked += 3;
+    if (!check("load", loaded.load(CACHE_FILE, worldChecksum,
+                                   featureChecksum)))
+      nbFailed++;
+    if (!check("frame count", loaded.getFrameCount() == FRAME_COUNT))
+      nbFailed++;
+    StatServer ss2(c, ms);
+    MixtureStat& targetStat2 = ss2.createAndStoreMixtureStat(target);
+    fs.seekFeature(0);
+    for (t=0; t<loaded.getFrameCount() && fs.readFeature(f); t++)
+    {
+      loaded.setTopDistribIndexVector(ss2, t);
+      targetStat2.computeAndAccumulateLLK(f, 1.0, USE_TOP_DISTRIBS);
+    }
+    if (!check("log-likelihood with the loaded cache",
+               targetStat2.getAccumulatedLLK()
+               == targetStat.getAccumulatedLLK()))
+    {
+      printf("  %.17g instead of %.17g\n", targetStat2.getAccumulatedLLK(),
+             targetStat.getAccumulatedLLK());
+      nbFailed++;
+    }
+
+    // refused for other features, another world model or no file
+    const unsigned long otherFeatureChecksum =
+                        TopDistribsCache::computeChecksum(otherFs);
+    world.getDistrib(3).setMean(world.getDistrib(3).getMean(0)+0.5, 0);
+    world.computeAll();
+    const unsigned long otherWorldChecksum = world.computeChecksum();
+    TopDistribsCache refused;
+    nbChecked += 6;
+    if (!check("checksum of other features",
+               otherFeatureChecksum != featureChecksum))
+      nbFailed++;
+    if (!check("checksum of another world model",
+               otherWorldChecksum != worldChecksum))
+      nbFailed++;
+    if (!check("load for other features", !refused.load(CACHE_FILE,
+               worldChecksum, otherFeatureChecksum)))
+      nbFailed++;
+    if (!check("load for another world model", !refused.load(CACHE_FILE,
+               otherWorldChecksum, featureChecksum)))
+      nbFailed++;
+    if (!check("load of a missing file", !refused.load("TestMissing.tdc",
+               worldChecksum, featureChecksum)))
+      nbFailed++;
+    if (!check("refused cache not modified", refused.getFrameCount() == 0))
+      nbFailed++;
+
+    remove((String(FEATURE_FILE)+".raw").c_str());
+    remove((String(OTHER_FEATURE_FILE)+".raw").c_str());
+    remove(CACHE_FILE);
+    printf("%lu/%lu checks passed\n", nbChecked-nbFailed, nbChecked);
+    return (nbFailed == 0 ? 0 : 1);
+  }
+  catch (Exception& e)
+  {
+    printf("%s\n", e.toString().c_str());
+    return 1;
+  }
+}
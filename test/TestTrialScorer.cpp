@@ -0,0 +1,261 @@
+/*
+	This file is part of ALIZE which is an open-source tool for 
+	speaker recognition.
+
+    ALIZE is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as 
+    published by the Free Software Foundation, either version 3 of 
+    the License, or any later version.
+
+    ALIZE is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public 
+    License along with ALIZE.
+    If not, see <http://www.gnu.org/licenses/>.
+        
+	ALIZE is a development project initiated by the ELISA consortium
+	[alize.univ-avignon.fr/] and funded by the French Research 
+	Ministry in the framework of the TECHNOLANGUE program 
+	[www.technolangue.net]
+
+	The ALIZE project team wants to highlight the limits of voice
+	authentication in a forensic context.
+	The "Person  Authentification by Voice: A Need of Caution" paper 
+	proposes a good overview of this point (cf. "Person  
+	Authentification by Voice: A Need of Caution", Bonastre J.F., 
+	Bimbot F., Boe L.J., Campbell J.P., Douglas D.A., Magrin-
+	chagnolleau I., Eurospeech 2003, Genova].
+	The conclusion of the paper of the paper is proposed bellow:
+	[Currently, it is not possible to completely determine whether the 
+	similarity between two recordings is due to the speaker or to other 
+	factors, especially when: (a) the speaker does not cooperate, (b) there 
+	is no control over recording equipment, (c) recording conditions are not 
+	known, (d) one does not know whether the voice was disguised and, to a 
+	lesser extent, (e) the linguistic content of the message is not 
+	controlled. Caution and judgment must be exercised when applying speaker 
+	recognition techniques, whether human or automatic, to account for these 
+	uncontrolled factors. Under more constrained or calibrated situations, 
+	or as an aid for investigative purposes, judicious application of these 
+	techniques may be suitable, provided they are not considered as infallible.
+	At the present time, there is no scientific process that enables one to 
+	uniquely characterize a person=92s voice or to identify with absolute 
+	certainty an individual from his or her voice.]
+	Contact Jean-Francois Bonastre for more information about the licence or
+	the use of ALIZE
+
+	Copyright (C) 2003-2010
+	Laboratoire d'informatique d'Avignon [lia.univ-avignon.fr]
+	ALIZE admin [alize@univ-avignon.fr]
+	Jean-Francois Bonastre [jean-francois.bonastre@univ-avignon.fr]
+*/
+
+
+// Checks TrialScorer : the score of each trial of a NDX list is the mean
+// log-likelihood ratio computed frame by frame with the top distributions
+// of the world model, the scores do not depend on the number of threads,
+// the listener is called once per test file and the counters and frame
+// counts are those of the test files. A missing test file makes run()
+// throw and stops the clock.
+// Returns 0 if all the checks pass.
+
+#include <cstdio>
+#include <cmath>
+#include "alize.h"
+
+using namespace alize;
+
+static const unsigned long VECT_SIZE = 4;
+static const unsigned long DISTRIB_COUNT = 16;
+static const unsigned long MODEL_COUNT = 5;
+static const unsigned long TEST_COUNT = 7;
+
+static unsigned long seed = 12345;
+//-------------------------------------------------------------------------
+static real_t randomValue(real_t min, real_t max)
+{
+  seed = seed*1103515245 + 12345;
+  return min + (max-min)*((seed/65536)%32768)/32767.0;
+}
+//-------------------------------------------------------------------------
+static String getTestName(unsigned long k)
+{ return "TestTrialScorer" + String::valueOf(k); }
+//-------------------------------------------------------------------------
+static unsigned long getTestFrameCount(unsigned long k)
+{ return 150+40*k; }
+//-------------------------------------------------------------------------
+static void writeFeatureFile(unsigned long k)
+{
+  FILE* f = fopen((getTestName(k)+".raw").c_str(), "wb");
+  if (f == NULL)
+    throw Exception("Cannot create the feature file", __FILE__, __LINE__);
+  for (unsigned long t=0; t<getTestFrameCount(k)*VECT_SIZE; t++)
+  {
+    const float v = (float)randomValue(0.0, 4.0);
+    fwrite(&v, sizeof(v), 1, f);
+  }
+  fclose(f);
+}
+//-------------------------------------------------------------------------
+static void initMixture(MixtureGD& m)
+{
+  for (unsigned long c=0; c<DISTRIB_COUNT; c++)
+  {
+    DistribGD& d = m.getDistrib(c);
+    for (unsigned long i=0; i<VECT_SIZE; i++)
+    {
+      d.setMean(randomValue(0.0, 4.0), i);
+      d.setCov(randomValue(0.5, 1.5), i);
+    }
+  }
+  m.equalizeWeights();
+  m.computeAll();
+}
+//-------------------------------------------------------------------------
+class Listener : public TrialScorerListener
+{
+public :
+  Listener() :_callVect(TEST_COUNT, TEST_COUNT)
+  { _callVect.setAllValues(0); }
+  virtual void testScored(const TrialScorer&, unsigned long test)
+  { Object::incrementCounter(_callVect[test]); }
+  ULongVector _callVect;
+};
+//-------------------------------------------------------------------------
+static bool check(const String& step, bool ok)
+{
+  if (!ok)
+    printf("FAILED %s\n", step.c_str());
+  return ok;
+}
+//-------------------------------------------------------------------------
+int main()
+{
+  try
+  {
+    Config c;
+    c.setParam("vectSize", String::valueOf(VECT_SIZE));
+    c.setParam("minLLK", "-200");
+    c.setParam("maxLLK", "200");
+    c.setParam("topDistribsCount", "5");
+    c.setParam("computeLLKWithTopDistribs", "COMPLETE");
+    c.setParam("loadFeatureFileFormat", "RAW");
+    c.setParam("loadFeatureFileVectSize", String::valueOf(VECT_SIZE));
+    c.setParam("loadFeatureFileExtension", ".raw");
+    c.setParam("featureFilesPath", "./");
+    c.setParam("bigEndian", "false");
+    c.setParam("sampleRate", "100");
+    MixtureServer ms(c);
+    MixtureGD& world = ms.createMixtureGD(DISTRIB_COUNT);
+    ms.setMixtureId(world, "world");
+    initMixture(world);
+    unsigned long k, j, t;
+    for (j=0; j<MODEL_COUNT; j++)
+    {
+      MixtureGD& m = ms.createMixtureGD(DISTRIB_COUNT);
+      ms.setMixtureId(m, "spk" + String::valueOf(j));
+      initMixture(m);
+    }
+    // each test file with some of the models
+    XList ndx;
+    for (k=0; k<TEST_COUNT; k++)
+    {
+      writeFeatureFile(k);
+      XLine& l = ndx.addLine();
+      l.addElement(getTestName(k));
+      for (j=0; j<MODEL_COUNT; j++)
+        if ((k+j)%3 != 0)
+          l.addElement("spk" + String::valueOf(j));
+    }
+    unsigned long nbFailed = 0, nbChecked = 0;
+
+    ThreadPool pool1(1), pool4(4);
+    TrialScorer s1(c, ms, world, pool1), s4(c, ms, world, pool4);
+    Listener listener;
+    s1.addTrials(ndx);
+    s4.addTrials(ndx);
+    s4.setListener(&listener);
+    s1.run();
+    s4.run();
+    const unsigned long trialCount = s4.getTrialCount();
+    unsigned long frameCount = 0;
+    for (k=0; k<TEST_COUNT; k++)
+    {
+      const String step = getTestName(k);
+      nbChecked += 3;
+      if (!check(step + " : name", s4.getTestName(k) == getTestName(k)))
+        nbFailed++;
+      if (!check(step + " : frame count",
+                 s4.getTestFrameCount(k) == getTestFrameCount(k)))
+        nbFailed++;
+      if (!check(step + " : listener", listener._callVect[k] == 1))
+        nbFailed++;
+      frameCount += getTestFrameCount(k);
+    }
+    nbChecked += 4;
+    if (!check("test count", s4.getTestCount() == TEST_COUNT
+               && s4.getProcessedTestCount() == TEST_COUNT))
+      nbFailed++;
+    if (!check("trial count", s4.getProcessedTrialCount() == trialCount))
+      nbFailed++;
+    if (!check("frame count", s4.getProcessedFrameCount() == frameCount))
+      nbFailed++;
+    if (!check("elapsed time", s4.getElapsedTime() >= 0.0))
+      nbFailed++;
+
+    StatServer ss(c, ms);
+    for (t=0; t<trialCount; t++)
+    {
+      const String step = "trial " + String::valueOf(t);
+      const Mixture& m = s4.getTrialModel(t);
+      FeatureServer fs(c, s4.getTestName(s4.getTrialTest(t)));
+      Feature f;
+      ss.resetLLK(world);
+      ss.resetLLK(m);
+      while (fs.readFeature(f))
+      {
+        ss.computeAndAccumulateLLK(world, f, 1.0, DETERMINE_TOP_DISTRIBS);
+        ss.computeAndAccumulateLLK(m, f, 1.0, USE_TOP_DISTRIBS);
+      }
+      const real_t ref = ss.getMeanLLK(m)-ss.getMeanLLK(world);
+      nbChecked += 2;
+      if (!check(step + " : threads", s4.getScore(t) == s1.getScore(t)))
+        nbFailed++;
+      if (!(fabs(s4.getScore(t)-ref) <= 1e-12*(1.0+fabs(ref))))
+      {
+        printf("FAILED %s : %.15g instead of %.15g\n", step.c_str(),
+               s4.getScore(t), ref);
+        nbFailed++;
+      }
+    }
+
+    // missing test file
+    TrialScorer bad(c, ms, world, pool4);
+    bad.addTrial(getTestName(0), "spk0");
+    bad.addTrial("TestTrialScorerMissing", "spk1");
+    nbChecked += 2;
+    try
+    {
+      bad.run();
+      check("missing test file", false);
+      nbFailed++;
+    }
+    catch (Exception&) {}
+    const real_t elapsedTime = bad.getElapsedTime();
+    for (volatile unsigned long i=0; i<1000000; i++) {}
+    if (!check("clock stopped", bad.getElapsedTime() == elapsedTime))
+      nbFailed++;
+
+    for (k=0; k<TEST_COUNT; k++)
+      remove((getTestName(k)+".raw").c_str());
+    printf("%lu/%lu checks passed\n", nbChecked-nbFailed, nbChecked);
+    return (nbFailed == 0 ? 0 : 1);
+  }
+  catch (Exception& e)
+  {
+    printf("%s\n", e.toString().c_str());
+    return 1;
+  }
+}